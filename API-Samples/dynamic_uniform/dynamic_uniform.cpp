@@ -118,38 +118,18 @@ int sample_main(int argc, char *argv[]) {
     res = vkCreateBuffer(info.device, &buf_info, NULL, &info.uniform_data.buf);
     assert(res == VK_SUCCESS);
 
-    VkMemoryRequirements mem_reqs;
-    vkGetBufferMemoryRequirements(info.device, info.uniform_data.buf, &mem_reqs);
-
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.pNext = NULL;
-    alloc_info.memoryTypeIndex = 0;
-
-    alloc_info.allocationSize = mem_reqs.size;
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits,
-                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                       &alloc_info.memoryTypeIndex);
+    pass = allocate_buffer_memory(info, info.uniform_data.buf,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  info.uniform_data.alloc);
     assert(pass && "No mappable, coherent memory");
 
-    res = vkAllocateMemory(info.device, &alloc_info, NULL, &(info.uniform_data.mem));
-    assert(res == VK_SUCCESS);
-
-    /* Map the buffer memory and copy both matrices */
-    uint8_t *pData;
-    res = vkMapMemory(info.device, info.uniform_data.mem, 0, mem_reqs.size, 0, (void **)&pData);
-    assert(res == VK_SUCCESS);
-
+    /* The allocator keeps the buffer memory mapped, copy both matrices */
+    uint8_t *pData = (uint8_t *)info.uniform_data.alloc.mapped;
     memcpy(pData, &info.MVP, sizeof(info.MVP));
 
     pData += buf_size;
     memcpy(pData, &MVP2, sizeof(MVP2));
 
-    vkUnmapMemory(info.device, info.uniform_data.mem);
-
-    res = vkBindBufferMemory(info.device, info.uniform_data.buf, info.uniform_data.mem, 0);
-    assert(res == VK_SUCCESS);
-
     info.uniform_data.buffer_info.buffer = info.uniform_data.buf;
     info.uniform_data.buffer_info.offset = 0;
     info.uniform_data.buffer_info.range = buf_size;
@@ -0,0 +1,153 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+VULKAN_SAMPLE_SHORT_DESCRIPTION
+Draw the cube continuously with several frames in flight
+*/
+
+#include <util_init.hpp>
+#include <assert.h>
+#include <string.h>
+#include <cstdlib>
+#include "cube_data.h"
+
+#define FRAME_COUNT 300
+
+/* Records the same commands as 15-draw_cube, into the frame's command buffer */
+static void record_frame(struct sample_info &info, uint32_t frame, void *user_data) {
+    VkClearValue clear_values[2];
+    init_clear_color_and_depth(info, clear_values);
+
+    VkRenderPassBeginInfo rp_begin;
+    init_render_pass_begin_info(info, rp_begin);
+    rp_begin.clearValueCount = 2;
+    rp_begin.pClearValues = clear_values;
+
+    vkCmdBeginRenderPass(info.cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindPipeline(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline);
+    vkCmdBindDescriptorSets(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline_layout, 0, NUM_DESCRIPTOR_SETS,
+                            info.desc_set.data(), 0, NULL);
+
+    const VkDeviceSize offsets[1] = {0};
+    vkCmdBindVertexBuffers(info.cmd, 0, 1, &info.vertex_buffer.buf, offsets);
+
+    init_viewports(info);
+    init_scissors(info);
+
+    vkCmdDraw(info.cmd, 12 * 3, 1, 0, 0);
+    vkCmdEndRenderPass(info.cmd);
+}
+
+int sample_main(int argc, char *argv[]) {
+    struct sample_info info = {};
+    char sample_title[] = "Frames in Flight";
+    const bool depthPresent = true;
+
+    process_command_line_args(info, argc, argv);
+    init_global_layer_properties(info);
+    init_instance_extension_names(info);
+    init_device_extension_names(info);
+    init_instance(info, sample_title);
+    init_enumerate_device(info);
+    init_window_size(info, 500, 500);
+    init_connection(info);
+    init_window(info);
+    init_swapchain_extension(info);
+    init_device(info);
+
+    init_command_pool(info);
+    init_command_buffer(info);
+    init_device_queue(info);
+    init_swap_chain(info);
+    init_depth_buffer(info);
+    init_uniform_buffer(info);
+    init_descriptor_and_pipeline_layouts(info, false);
+    init_renderpass(info, depthPresent);
+#include "frames_in_flight.vert.h"
+#include "frames_in_flight.frag.h"
+    VkShaderModuleCreateInfo vert_info = {};
+    VkShaderModuleCreateInfo frag_info = {};
+    vert_info.sType = frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    vert_info.codeSize = sizeof(frames_in_flight_vert);
+    vert_info.pCode = frames_in_flight_vert;
+    frag_info.codeSize = sizeof(frames_in_flight_frag);
+    frag_info.pCode = frames_in_flight_frag;
+    init_shaders(info, &vert_info, &frag_info);
+    init_framebuffers(info, depthPresent);
+    init_vertex_buffer(info, g_vb_solid_face_colors_Data, sizeof(g_vb_solid_face_colors_Data),
+                       sizeof(g_vb_solid_face_colors_Data[0]), false);
+    init_descriptor_pool(info, false);
+    init_descriptor_set(info, false);
+    init_pipeline_cache(info);
+    init_pipeline(info, depthPresent);
+
+    /* VULKAN_KEY_START */
+
+    /* With one frame in flight the CPU waits for every frame before
+     * recording the next, as the other samples do.  With more, it records
+     * while the GPU and the presentation engine are still busy. */
+    const uint32_t frames_in_flight[] = {1, 2, 3};
+    for (uint32_t i = 0; i < sizeof(frames_in_flight) / sizeof(frames_in_flight[0]); i++) {
+        frame_loop loop;
+        init_frame_loop(info, loop, record_frame, NULL, depthPresent, frames_in_flight[i]);
+
+        const double fps = execute_frame_loop(loop, FRAME_COUNT);
+        printf("%u frame(s) in flight: %u frames at %.1f frames per second", frames_in_flight[i], FRAME_COUNT, fps);
+        if (loop.swap_chain_recreations) printf(", swap chain recreated %u time(s)", loop.swap_chain_recreations);
+        printf("\n");
+
+        destroy_frame_loop(loop);
+    }
+
+    /* Capturing every frame copies each one into a host buffer in its own
+     * command buffer, and converts and writes it once the frame has come
+     * around again, so the GPU never waits for the disk. */
+    if (info.save_images) {
+        frame_loop loop;
+        init_frame_loop(info, loop, record_frame, NULL, depthPresent, 2);
+        init_frame_loop_capture(loop, "frames_in_flight");
+
+        const double fps = execute_frame_loop(loop, FRAME_COUNT);
+        printf("2 frame(s) in flight, capturing every frame: %u frames at %.1f frames per second\n", FRAME_COUNT, fps);
+
+        destroy_frame_loop(loop);
+    }
+
+    /* VULKAN_KEY_END */
+    if (info.save_images) write_ppm(info, "frames_in_flight");
+
+    destroy_pipeline(info);
+    destroy_pipeline_cache(info);
+    destroy_descriptor_pool(info);
+    destroy_vertex_buffer(info);
+    destroy_framebuffers(info);
+    destroy_shaders(info);
+    destroy_renderpass(info);
+    destroy_descriptor_and_pipeline_layouts(info);
+    destroy_uniform_buffer(info);
+    destroy_depth_buffer(info);
+    destroy_swap_chain(info);
+    destroy_command_buffer(info);
+    destroy_command_pool(info);
+    destroy_device(info);
+    destroy_window(info);
+    destroy_instance(info);
+    return 0;
+}
@@ -259,10 +259,10 @@ int sample_main(int argc, char *argv[]) {
     vkDestroySampler(info.device, immutableSampler, NULL);
     vkDestroyImageView(info.device, info.textures[0].view, NULL);
     vkDestroyImage(info.device, info.textures[0].image, NULL);
-    vkFreeMemory(info.device, info.textures[0].image_memory, NULL);
+    free_memory(info, info.textures[0].image_alloc);
     if (info.textures[0].needs_staging) {
         vkDestroyBuffer(info.device, info.textures[0].buffer, NULL);
-        vkFreeMemory(info.device, info.textures[0].buffer_memory, NULL);
+        free_memory(info, info.textures[0].buffer_alloc);
     }
 
     // instead of destroy_descriptor_pool(info);
@@ -25,12 +25,16 @@ This could be used to quickly determine if more expensive rendering should be
 done. Use vkCreateQueryPool, vkCmdResetQueryPool, and vkDestroyQueryPool to
 manage a pool. Use vkCmdBeginQuery and vkCmdEndQuery to enclose rendering.
 Use vkCmdCopyQueryPoolResults or vkGetQueryPoolResults to read query results.
-This example does one query with no rendering to give a zero result and a second
-query with rendering to give a non-zero result.  Note that exact counts are not
-guaranteed unless vkGetPhysicalDeviceFeatures sets occlusionQueryPrecise and the
-VK_QUERY_CONTROL_PRECISE_BIT is set for vkCmdBeginQuery.
-
-This example uses vkCmdCopyQueryPoolResults followed by vkMapMemory of a buffer.
+Every frame, this example does one query with no rendering to give a zero result
+and a second query with rendering to give a non-zero result.  Note that exact
+counts are not guaranteed unless vkGetPhysicalDeviceFeatures sets
+occlusionQueryPrecise and the VK_QUERY_CONTROL_PRECISE_BIT is set for
+vkCmdBeginQuery.
+
+This example copies the results of each frame with vkCmdCopyQueryPoolResults
+into a buffer that stays mapped, and reads them a frame or two later, once they
+have landed, rather than waiting for the queue to go idle.  Timestamps, and
+pipeline statistics where the device supports them, are read the same way.
 vkCmdCopyQueryPoolResults could also be used to set uniforms used later by
 shaders.
 */
@@ -42,15 +46,114 @@ shaders.
 #include "cube_data.h"
 
 #define DEPTH_PRESENT true
+#define FRAME_COUNT 120
+#define FRAMES_IN_FLIGHT 2
 
 /* We've setup cmake to process occlusion_query.vert and occlusion_query.frag             */
 /* files containing the glsl shader code for this sample.  The generate-spirv script uses */
 /* glslangValidator to compile the glsl into spir-v and places the spir-v into a struct   */
 /* into a generated header file                                                           */
 
+/* Results are kept for a frame more than there are in flight, so that the
+ * frame that finished last can always be read */
+#define QUERY_SLOTS (FRAMES_IN_FLIGHT + 1)
+
+struct query_state {
+    query_ring occlusion;
+    query_ring timestamps;
+    query_ring statistics;
+    bool has_timestamps;
+    bool has_statistics;
+
+    /* frames whose results were read, by how many frames later */
+    uint32_t frames_read[QUERY_SLOTS];
+    double gpu_ms;
+    std::vector<uint64_t> values;
+};
+
+/* Reads the newest occlusion results that have landed, without waiting */
+static void read_results(query_state &state) {
+    for (uint32_t frames_ago = 1; frames_ago < QUERY_SLOTS; frames_ago++) {
+        if (!get_query_ring_results(state.occlusion, frames_ago, state.values)) continue;
+        const bool first = (state.occlusion.results_read == 1);
+        state.frames_read[frames_ago]++;
+        if (first) {
+            std::cout << "occlusion results, " << frames_ago << " frame(s) later\n";
+            std::cout << "samples_passed[0] = " << state.values[0] << "\n";
+            std::cout << "samples_passed[1] = " << state.values[1] << "\n";
+        }
+
+        if (state.has_timestamps && get_query_ring_results(state.timestamps, frames_ago, state.values))
+            state.gpu_ms += get_query_ring_elapsed_ms(state.timestamps, state.values[0], state.values[1]);
+
+        if (first && state.has_statistics && get_query_ring_results(state.statistics, frames_ago, state.values)) {
+            std::cout << "input assembly vertices = " << state.values[0] << "\n";
+            std::cout << "vertex shader invocations = " << state.values[1] << "\n";
+            std::cout << "fragment shader invocations = " << state.values[2] << "\n";
+        }
+        break;
+    }
+}
+
+static void record_frame(struct sample_info &info, uint32_t frame, void *user_data) {
+    query_state &state = *(query_state *)user_data;
+
+    /* The frame loop waited for the frame that last used this frame's
+     * resources, so the slots that are reused are free */
+    execute_query_ring_begin_frame(state.occlusion, info.cmd);
+    if (state.has_timestamps) execute_query_ring_begin_frame(state.timestamps, info.cmd);
+    if (state.has_statistics) execute_query_ring_begin_frame(state.statistics, info.cmd);
+    read_results(state);
+
+    if (state.has_timestamps) execute_query_ring_timestamp(state.timestamps, info.cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+
+    VkClearValue clear_values[2];
+    clear_values[0].color.float32[0] = 0.2f;
+    clear_values[0].color.float32[1] = 0.2f;
+    clear_values[0].color.float32[2] = 0.2f;
+    clear_values[0].color.float32[3] = 0.2f;
+    clear_values[1].depthStencil.depth = 1.0f;
+    clear_values[1].depthStencil.stencil = 0;
+
+    VkRenderPassBeginInfo rp_begin;
+    init_render_pass_begin_info(info, rp_begin);
+    rp_begin.clearValueCount = 2;
+    rp_begin.pClearValues = clear_values;
+
+    vkCmdBeginRenderPass(info.cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindPipeline(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline);
+    vkCmdBindDescriptorSets(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline_layout, 0, NUM_DESCRIPTOR_SETS,
+                            info.desc_set.data(), 0, NULL);
+
+    const VkDeviceSize offsets[1] = {0};
+    vkCmdBindVertexBuffers(info.cmd, 0, 1, &info.vertex_buffer.buf, offsets);
+
+    init_viewports(info);
+    init_scissors(info);
+
+    uint32_t query = execute_query_ring_begin_query(state.occlusion, info.cmd);
+    execute_query_ring_end_query(state.occlusion, info.cmd, query);
+
+    query = execute_query_ring_begin_query(state.occlusion, info.cmd);
+    uint32_t statistics_query = 0;
+    if (state.has_statistics) statistics_query = execute_query_ring_begin_query(state.statistics, info.cmd);
+
+    vkCmdDraw(info.cmd, 12 * 3, 1, 0, 0);
+
+    if (state.has_statistics) execute_query_ring_end_query(state.statistics, info.cmd, statistics_query);
+    execute_query_ring_end_query(state.occlusion, info.cmd, query);
+
+    vkCmdEndRenderPass(info.cmd);
+
+    if (state.has_timestamps) execute_query_ring_timestamp(state.timestamps, info.cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+    execute_query_ring_end_frame(state.occlusion, info.cmd);
+    if (state.has_timestamps) execute_query_ring_end_frame(state.timestamps, info.cmd);
+    if (state.has_statistics) execute_query_ring_end_frame(state.statistics, info.cmd);
+}
+
 int sample_main(int argc, char *argv[]) {
-    VkResult U_ASSERT_ONLY res;
-    bool U_ASSERT_ONLY pass;
     struct sample_info info = {};
     char sample_title[] = "Draw Cube";
 
@@ -75,10 +178,12 @@ int sample_main(int argc, char *argv[]) {
     init_connection(info);
     init_window(info);
     init_swapchain_extension(info);
+
+    /* Pipeline statistics queries are an optional feature */
+    info.enabled_features.pipelineStatisticsQuery = info.gpu_features.pipelineStatisticsQuery;
     init_device(info);
     init_command_pool(info);
     init_command_buffer(info);
-    execute_begin_command_buffer(info);
     init_device_queue(info);
     init_swap_chain(info);
     init_depth_buffer(info);
@@ -105,211 +210,44 @@ int sample_main(int argc, char *argv[]) {
 
     /* VULKAN_KEY_START */
 
-    VkClearValue clear_values[2];
-    clear_values[0].color.float32[0] = 0.2f;
-    clear_values[0].color.float32[1] = 0.2f;
-    clear_values[0].color.float32[2] = 0.2f;
-    clear_values[0].color.float32[3] = 0.2f;
-    clear_values[1].depthStencil.depth = 1.0f;
-    clear_values[1].depthStencil.stencil = 0;
-
-    VkSemaphore imageAcquiredSemaphore;
-    VkSemaphoreCreateInfo imageAcquiredSemaphoreCreateInfo;
-    imageAcquiredSemaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-    imageAcquiredSemaphoreCreateInfo.pNext = NULL;
-    imageAcquiredSemaphoreCreateInfo.flags = 0;
-
-    res = vkCreateSemaphore(info.device, &imageAcquiredSemaphoreCreateInfo, NULL, &imageAcquiredSemaphore);
-    assert(res == VK_SUCCESS);
-
-    // Get the index of the next available swapchain image:
-    res = vkAcquireNextImageKHR(info.device, info.swap_chain, UINT64_MAX, imageAcquiredSemaphore, VK_NULL_HANDLE,
-                                &info.current_buffer);
-    // TODO: Deal with the VK_SUBOPTIMAL_KHR and VK_ERROR_OUT_OF_DATE_KHR
-    // return codes
-    assert(res == VK_SUCCESS);
-
-    /* Allocate a uniform buffer that will take query results. */
-    VkBuffer query_result_buf;
-    VkDeviceMemory query_result_mem;
-    VkBufferCreateInfo buf_info = {};
-    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    buf_info.pNext = NULL;
-    buf_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-    buf_info.size = 4 * sizeof(uint64_t);
-    buf_info.queueFamilyIndexCount = 0;
-    buf_info.pQueueFamilyIndices = NULL;
-    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    buf_info.flags = 0;
-    res = vkCreateBuffer(info.device, &buf_info, NULL, &query_result_buf);
-    assert(res == VK_SUCCESS);
-
-    VkMemoryRequirements mem_reqs;
-    vkGetBufferMemoryRequirements(info.device, query_result_buf, &mem_reqs);
-
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.pNext = NULL;
-    alloc_info.memoryTypeIndex = 0;
-    alloc_info.allocationSize = mem_reqs.size;
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits,
-                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                       &alloc_info.memoryTypeIndex);
-    assert(pass && "No mappable, coherent memory");
-
-    res = vkAllocateMemory(info.device, &alloc_info, NULL, &query_result_mem);
-    assert(res == VK_SUCCESS);
-
-    res = vkBindBufferMemory(info.device, query_result_buf, query_result_mem, 0);
-    assert(res == VK_SUCCESS);
-
-    VkQueryPool query_pool;
-    VkQueryPoolCreateInfo query_pool_info;
-    query_pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
-    query_pool_info.pNext = NULL;
-    query_pool_info.queryType = VK_QUERY_TYPE_OCCLUSION;
-    query_pool_info.flags = 0;
-    query_pool_info.queryCount = 2;
-    query_pool_info.pipelineStatistics = 0;
-
-    res = vkCreateQueryPool(info.device, &query_pool_info, NULL, &query_pool);
-    assert(res == VK_SUCCESS);
-
-    vkCmdResetQueryPool(info.cmd, query_pool, 0 /*startQuery*/, 2 /*queryCount*/);
-
-    VkRenderPassBeginInfo rp_begin;
-    rp_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    rp_begin.pNext = NULL;
-    rp_begin.renderPass = info.render_pass;
-    rp_begin.framebuffer = info.framebuffers[info.current_buffer];
-    rp_begin.renderArea.offset.x = 0;
-    rp_begin.renderArea.offset.y = 0;
-    rp_begin.renderArea.extent.width = info.width;
-    rp_begin.renderArea.extent.height = info.height;
-    rp_begin.clearValueCount = 2;
-    rp_begin.pClearValues = clear_values;
-
-    vkCmdBeginRenderPass(info.cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
-
-    vkCmdBindPipeline(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline);
-    vkCmdBindDescriptorSets(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline_layout, 0, NUM_DESCRIPTOR_SETS,
-                            info.desc_set.data(), 0, NULL);
-
-    const VkDeviceSize offsets[1] = {0};
-    vkCmdBindVertexBuffers(info.cmd, 0, 1, &info.vertex_buffer.buf, offsets);
-
-    VkViewport viewport;
-    viewport.height = (float)info.height;
-    viewport.width = (float)info.width;
-    viewport.minDepth = (float)0.0f;
-    viewport.maxDepth = (float)1.0f;
-    viewport.x = 0;
-    viewport.y = 0;
-    vkCmdSetViewport(info.cmd, 0, NUM_VIEWPORTS, &viewport);
-
-    VkRect2D scissor;
-    scissor.extent.width = info.width;
-    scissor.extent.height = info.height;
-    scissor.offset.x = 0;
-    scissor.offset.y = 0;
-    vkCmdSetScissor(info.cmd, 0, NUM_SCISSORS, &scissor);
-
-    vkCmdBeginQuery(info.cmd, query_pool, 0 /*slot*/, 0 /*flags*/);
-    vkCmdEndQuery(info.cmd, query_pool, 0 /*slot*/);
-
-    vkCmdBeginQuery(info.cmd, query_pool, 1 /*slot*/, 0 /*flags*/);
-
-    vkCmdDraw(info.cmd, 12 * 3, 1, 0, 0);
-    vkCmdEndRenderPass(info.cmd);
+    query_state state;
+    memset(state.frames_read, 0, sizeof(state.frames_read));
+    state.gpu_ms = 0.0;
+
+    init_query_ring(info, state.occlusion, VK_QUERY_TYPE_OCCLUSION, 2, QUERY_SLOTS);
+
+    /* Timestamps need a queue that supports them */
+    state.has_timestamps = info.queue_props[info.graphics_queue_family_index].timestampValidBits != 0;
+    if (state.has_timestamps) init_query_ring(info, state.timestamps, VK_QUERY_TYPE_TIMESTAMP, 2, QUERY_SLOTS);
+
+    state.has_statistics = info.enabled_features.pipelineStatisticsQuery != VK_FALSE;
+    if (state.has_statistics) {
+        init_query_ring(info, state.statistics, VK_QUERY_TYPE_PIPELINE_STATISTICS, 1, QUERY_SLOTS,
+                        VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+                            VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+                            VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT);
+    }
+
+    frame_loop loop;
+    init_frame_loop(info, loop, record_frame, &state, DEPTH_PRESENT, FRAMES_IN_FLIGHT);
+    const double fps = execute_frame_loop(loop, FRAME_COUNT);
+    destroy_frame_loop(loop);
+
+    std::cout << FRAME_COUNT << " frames at " << fps << " frames per second, results of "
+              << state.occlusion.results_read << " read\n";
+    for (uint32_t frames_ago = 1; frames_ago < QUERY_SLOTS; frames_ago++) {
+        std::cout << "  " << state.frames_read[frames_ago] << " read " << frames_ago << " frame(s) later\n";
+    }
+    if (state.has_timestamps && state.timestamps.results_read) {
+        std::cout << "average GPU time " << state.gpu_ms / state.timestamps.results_read << " ms\n";
+    }
 
-    vkCmdEndQuery(info.cmd, query_pool, 1 /*slot*/);
-
-    vkCmdCopyQueryPoolResults(info.cmd, query_pool, 0 /*firstQuery*/, 2 /*queryCount*/, query_result_buf, 0 /*dstOffset*/,
-                              sizeof(uint64_t) /*stride*/, VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-
-    res = vkEndCommandBuffer(info.cmd);
-    const VkCommandBuffer cmd_bufs[] = {info.cmd};
-    VkFenceCreateInfo fenceInfo;
-    VkFence drawFence;
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.pNext = NULL;
-    fenceInfo.flags = 0;
-    vkCreateFence(info.device, &fenceInfo, NULL, &drawFence);
-
-    VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    VkSubmitInfo submit_info[1] = {};
-    submit_info[0].pNext = NULL;
-    submit_info[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info[0].waitSemaphoreCount = 1;
-    submit_info[0].pWaitSemaphores = &imageAcquiredSemaphore;
-    submit_info[0].pWaitDstStageMask = &pipe_stage_flags;
-    submit_info[0].commandBufferCount = 1;
-    submit_info[0].pCommandBuffers = cmd_bufs;
-    submit_info[0].signalSemaphoreCount = 0;
-    submit_info[0].pSignalSemaphores = NULL;
-
-    /* Queue the command buffer for execution */
-    res = vkQueueSubmit(info.graphics_queue, 1, submit_info, drawFence);
-    assert(res == VK_SUCCESS);
-
-    res = vkQueueWaitIdle(info.graphics_queue);
-    assert(res == VK_SUCCESS);
-
-    uint64_t samples_passed[4];
-
-    samples_passed[0] = 0;
-    samples_passed[1] = 0;
-    res = vkGetQueryPoolResults(info.device, query_pool, 0 /*firstQuery*/, 2 /*queryCount*/, sizeof(samples_passed) /*dataSize*/,
-                                samples_passed, sizeof(uint64_t) /*stride*/, VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-    assert(res == VK_SUCCESS);
-
-    std::cout << "vkGetQueryPoolResults data"
-              << "\n";
-    std::cout << "samples_passed[0] = " << samples_passed[0] << "\n";
-    std::cout << "samples_passed[1] = " << samples_passed[1] << "\n";
-
-    /* Read back query result from buffer */
-    uint64_t *samples_passed_ptr;
-    res = vkMapMemory(info.device, query_result_mem, 0, mem_reqs.size, 0, (void **)&samples_passed_ptr);
-    assert(res == VK_SUCCESS);
-
-    std::cout << "vkCmdCopyQueryPoolResults data"
-              << "\n";
-    std::cout << "samples_passed[0] = " << samples_passed_ptr[0] << "\n";
-    std::cout << "samples_passed[1] = " << samples_passed_ptr[1] << "\n";
-
-    vkUnmapMemory(info.device, query_result_mem);
-
-    /* Now present the image in the window */
-
-    VkPresentInfoKHR present;
-    present.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-    present.pNext = NULL;
-    present.swapchainCount = 1;
-    present.pSwapchains = &info.swap_chain;
-    present.pImageIndices = &info.current_buffer;
-    present.pWaitSemaphores = NULL;
-    present.waitSemaphoreCount = 0;
-    present.pResults = NULL;
-
-    /* Make sure command buffer is finished before presenting */
-    do {
-        res = vkWaitForFences(info.device, 1, &drawFence, VK_TRUE, FENCE_TIMEOUT);
-    } while (res == VK_TIMEOUT);
-
-    assert(res == VK_SUCCESS);
-    res = vkQueuePresentKHR(info.present_queue, &present);
-    assert(res == VK_SUCCESS);
-
-    wait_seconds(1);
     /* VULKAN_KEY_END */
     if (info.save_images) write_ppm(info, "occlusion_query");
 
-    vkDestroyBuffer(info.device, query_result_buf, NULL);
-    vkFreeMemory(info.device, query_result_mem, NULL);
-    vkDestroySemaphore(info.device, imageAcquiredSemaphore, NULL);
-    vkDestroyQueryPool(info.device, query_pool, NULL);
-    vkDestroyFence(info.device, drawFence, NULL);
+    destroy_query_ring(state.occlusion);
+    if (state.has_timestamps) destroy_query_ring(state.timestamps);
+    if (state.has_statistics) destroy_query_ring(state.statistics);
     destroy_pipeline(info);
     destroy_pipeline_cache(info);
     destroy_descriptor_pool(info);
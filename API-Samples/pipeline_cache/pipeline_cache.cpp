@@ -32,9 +32,9 @@ Create and use a pipeline cache across runs.
 // This sample tries to save and reuse pipeline cache data between runs.
 // On first run, no cache will be found, it will be created and saved
 // to disk. On later runs, the cache should be found, loaded, and used.
-// Hopefully a speedup will observed.  In the future, the pipeline could
-// be complicated a bit, to show a greater cache benefit.  Also, two
-// caches could be created and merged.
+// Hopefully a speedup will observed.  Variants of the pipeline are also
+// created on several threads, each in a cache of its own, and the caches
+// are merged into the one that is saved.
 
 int sample_main(int argc, char *argv[]) {
     VkResult U_ASSERT_ONLY res;
@@ -80,163 +80,128 @@ int sample_main(int argc, char *argv[]) {
 
     /* VULKAN_KEY_START */
 
-    // Check disk for existing cache data
-    size_t startCacheSize = 0;
-    void *startCacheData = nullptr;
-
-    std::string directoryName = get_file_directory();
-    std::string readFileName = directoryName + "pipeline_cache_data.bin";
-    FILE *pReadFile = fopen(readFileName.c_str(), "rb");
-
-    if (pReadFile) {
-        // Determine cache size
-        fseek(pReadFile, 0, SEEK_END);
-        startCacheSize = ftell(pReadFile);
-        rewind(pReadFile);
-
-        // Allocate memory to hold the initial cache data
-        startCacheData = (char *)malloc(sizeof(char) * startCacheSize);
-        if (startCacheData == nullptr) {
-            fputs("Memory error", stderr);
-            exit(EXIT_FAILURE);
-        }
-
-        // Read the data into our buffer
-        size_t result = fread(startCacheData, 1, startCacheSize, pReadFile);
-        if (result != startCacheSize) {
-            fputs("Reading error", stderr);
-            free(startCacheData);
-            exit(EXIT_FAILURE);
-        }
-
-        // Clean up and print results
-        fclose(pReadFile);
+    // Create the cache, seeded with the data on disk if there is any.  The
+    // store keeps a file per pipelineCacheUUID and ignores data whose header
+    // does not match the device, so whatever it loads can go to the driver.
+    bool cacheHit = false;
+    res = load_pipeline_cache(info, "pipeline_cache", info.pipelineCache, &cacheHit);
+    assert(res == VK_SUCCESS);
+    if (cacheHit) {
         printf("  Pipeline cache HIT!\n");
-        printf("  cacheData loaded from %s\n", readFileName.c_str());
-
+        printf("  cacheData loaded from %s\n", get_pipeline_cache_path(info, "pipeline_cache").c_str());
     } else {
-        // No cache found on disk
         printf("  Pipeline cache miss!\n");
     }
 
-    if (startCacheData != nullptr) {
-        // clang-format off
-        //
-        // Check for cache validity
-        //
-        // TODO: Update this as the spec evolves. The fields are not defined by the header.
-        //
-        // The code below supports SDK 0.10 Vulkan spec, which contains the following table:
-        //
-        // Offset	 Size            Meaning
-        // ------    ------------    ------------------------------------------------------------------
-        //      0               4    a device ID equal to VkPhysicalDeviceProperties::DeviceId written
-        //                           as a stream of bytes, with the least significant byte first
-        //
-        //      4    VK_UUID_SIZE    a pipeline cache ID equal to VkPhysicalDeviceProperties::pipelineCacheUUID
-        //
-        //
-        // The code must be updated for latest Vulkan spec, which contains the following table:
-        //
-        // Offset	 Size            Meaning
-        // ------    ------------    ------------------------------------------------------------------
-        //      0               4    length in bytes of the entire pipeline cache header written as a
-        //                           stream of bytes, with the least significant byte first
-        //      4               4    a VkPipelineCacheHeaderVersion value written as a stream of bytes,
-        //                           with the least significant byte first
-        //      8               4    a vendor ID equal to VkPhysicalDeviceProperties::vendorID written
-        //                           as a stream of bytes, with the least significant byte first
-        //     12               4    a device ID equal to VkPhysicalDeviceProperties::deviceID written
-        //                           as a stream of bytes, with the least significant byte first
-        //     16    VK_UUID_SIZE    a pipeline cache ID equal to VkPhysicalDeviceProperties::pipelineCacheUUID
-        //
-        // clang-format on
-        uint32_t headerLength = 0;
-        uint32_t cacheHeaderVersion = 0;
-        uint32_t vendorID = 0;
-        uint32_t deviceID = 0;
-        uint8_t pipelineCacheUUID[VK_UUID_SIZE] = {};
-
-        memcpy(&headerLength, (uint8_t *)startCacheData + 0, 4);
-        memcpy(&cacheHeaderVersion, (uint8_t *)startCacheData + 4, 4);
-        memcpy(&vendorID, (uint8_t *)startCacheData + 8, 4);
-        memcpy(&deviceID, (uint8_t *)startCacheData + 12, 4);
-        memcpy(pipelineCacheUUID, (uint8_t *)startCacheData + 16, VK_UUID_SIZE);
-
-        // Check each field and report bad values before freeing existing cache
-        bool badCache = false;
-
-        if (headerLength <= 0) {
-            badCache = true;
-            printf("  Bad header length in %s.\n", readFileName.c_str());
-            printf("    Cache contains: 0x%.8x\n", headerLength);
-        }
-
-        if (cacheHeaderVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) {
-            badCache = true;
-            printf("  Unsupported cache header version in %s.\n", readFileName.c_str());
-            printf("    Cache contains: 0x%.8x\n", cacheHeaderVersion);
-        }
-
-        if (vendorID != info.gpu_props.vendorID) {
-            badCache = true;
-            printf("  Vendor ID mismatch in %s.\n", readFileName.c_str());
-            printf("    Cache contains: 0x%.8x\n", vendorID);
-            printf("    Driver expects: 0x%.8x\n", info.gpu_props.vendorID);
-        }
-
-        if (deviceID != info.gpu_props.deviceID) {
-            badCache = true;
-            printf("  Device ID mismatch in %s.\n", readFileName.c_str());
-            printf("    Cache contains: 0x%.8x\n", deviceID);
-            printf("    Driver expects: 0x%.8x\n", info.gpu_props.deviceID);
-        }
+    VkPipelineCacheCreateInfo emptyPipelineCache = {};
+    emptyPipelineCache.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
 
-        if (memcmp(pipelineCacheUUID, info.gpu_props.pipelineCacheUUID, sizeof(pipelineCacheUUID)) != 0) {
-            badCache = true;
-            printf("  UUID mismatch in %s.\n", readFileName.c_str());
-            printf("    Cache contains: ");
-            print_UUID(pipelineCacheUUID);
-            printf("\n");
-            printf("    Driver expects: ");
-            print_UUID(info.gpu_props.pipelineCacheUUID);
-            printf("\n");
-        }
-
-        if (badCache) {
-            // Don't submit initial cache data if any version info is incorrect
-            free(startCacheData);
-            startCacheSize = 0;
-            startCacheData = nullptr;
-
-            // And clear out the old cache file for use in next run
-            printf("  Deleting cache entry %s to repopulate.\n", readFileName.c_str());
-            if (remove(readFileName.c_str()) != 0) {
-                fputs("Reading error", stderr);
-                exit(EXIT_FAILURE);
+    // Time taken to create the graphics pipeline, as an application would at startup
+    timestamp_t elapsed = 0;
+    {
+        scoped_timer timer(elapsed);
+        init_pipeline(info, depthPresent);
+    }
+    printf("  vkCreateGraphicsPipeline time: %.3f ms\n", elapsed / 1000000.0);
+
+    // A single creation is too noisy to compare, so repeat it in fresh caches,
+    // empty and holding the data from the last run.  Drivers may keep caches
+    // of their own, which the empty cache trials after the first can hit.
+    const VkPipeline pipeline = info.pipeline;
+    const VkPipelineCache cache = info.pipelineCache;
+    auto loadCache = [&]() {
+        VkResult U_ASSERT_ONLY res = load_pipeline_cache(info, "pipeline_cache", info.pipelineCache);
+        assert(res == VK_SUCCESS);
+    };
+    auto createEmptyCache = [&]() {
+        VkResult U_ASSERT_ONLY res = vkCreatePipelineCache(info.device, &emptyPipelineCache, nullptr, &info.pipelineCache);
+        assert(res == VK_SUCCESS);
+    };
+    auto createPipeline = [&]() { init_pipeline(info, depthPresent); };
+    auto destroyPipelineAndCache = [&]() {
+        destroy_pipeline(info);
+        destroy_pipeline_cache(info);
+    };
+
+    const uint32_t trials = get_bench_trials(info, 20);
+    std::vector<bench_result> results;
+    if (cacheHit) {
+        results.push_back(run_bench_trials("vkCreateGraphicsPipelines, cache from last run", trials, loadCache, createPipeline,
+                                           destroyPipelineAndCache));
+    }
+    results.push_back(run_bench_trials("vkCreateGraphicsPipelines, empty cache", trials, createEmptyCache, createPipeline,
+                                       destroyPipelineAndCache));
+
+    info.pipeline = pipeline;
+    info.pipelineCache = cache;
+
+    // An application usually needs many pipelines at startup.  Warm up
+    // variants of this one on a thread per core; each thread creates its
+    // pipelines in a cache of its own, and the caches are merged into
+    // info.pipelineCache afterwards.
+    const VkCullModeFlags cullModes[] = {VK_CULL_MODE_NONE, VK_CULL_MODE_FRONT_BIT, VK_CULL_MODE_BACK_BIT};
+    const VkFrontFace frontFaces[] = {VK_FRONT_FACE_CLOCKWISE, VK_FRONT_FACE_COUNTER_CLOCKWISE};
+    const VkCompareOp depthCompareOps[] = {VK_COMPARE_OP_LESS, VK_COMPARE_OP_LESS_OR_EQUAL};
+    std::vector<pipeline_desc> variants;
+    for (uint32_t c = 0; c < sizeof(cullModes) / sizeof(cullModes[0]); c++) {
+        for (uint32_t f = 0; f < sizeof(frontFaces) / sizeof(frontFaces[0]); f++) {
+            for (uint32_t d = 0; d < sizeof(depthCompareOps) / sizeof(depthCompareOps[0]); d++) {
+                pipeline_desc desc;
+                init_pipeline_desc(desc, depthPresent);
+                desc.cull_mode = cullModes[c];
+                desc.front_face = frontFaces[f];
+                desc.depth_compare_op = depthCompareOps[d];
+                variants.push_back(desc);
             }
         }
     }
 
-    // Feed the initial cache data into cache creation
-    VkPipelineCacheCreateInfo pipelineCache;
-    pipelineCache.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-    pipelineCache.pNext = NULL;
-    pipelineCache.initialDataSize = startCacheSize;
-    pipelineCache.pInitialData = startCacheData;
-    pipelineCache.flags = 0;
-    res = vkCreatePipelineCache(info.device, &pipelineCache, nullptr, &info.pipelineCache);
+    std::vector<VkPipeline> variantPipelines;
+    elapsed = 0;
+    {
+        scoped_timer timer(elapsed);
+        res = warm_up_pipelines(info, info.pipelineCache, variants, variantPipelines);
+    }
     assert(res == VK_SUCCESS);
-
-    // Free our initialData now that pipeline cache has been created
-    free(startCacheData);
-    startCacheData = NULL;
-
-    // Time (roughly) taken to create the graphics pipeline
-    timestamp_t start = get_milliseconds();
-    init_pipeline(info, depthPresent);
-    timestamp_t elapsed = get_milliseconds() - start;
-    printf("  vkCreateGraphicsPipeline time: %0.f ms\n", (double)elapsed);
+    printf("  Warm-up of %u pipeline variants: %.3f ms\n", (uint32_t)variants.size(), elapsed / 1000000.0);
+
+    // How the warm-up scales with the thread count, cold into an empty cache,
+    // and warm into info.pipelineCache, which now holds the variants
+    VkPipelineCache warmUpCache = VK_NULL_HANDLE;
+    auto destroyVariants = [&]() {
+        for (size_t i = 0; i < variantPipelines.size(); i++) vkDestroyPipeline(info.device, variantPipelines[i], NULL);
+        variantPipelines.clear();
+    };
+    destroyVariants();
+
+    auto createEmptyWarmUpCache = [&]() {
+        VkResult U_ASSERT_ONLY res = vkCreatePipelineCache(info.device, &emptyPipelineCache, nullptr, &warmUpCache);
+        assert(res == VK_SUCCESS);
+    };
+    auto destroyVariantsAndCache = [&]() {
+        destroyVariants();
+        vkDestroyPipelineCache(info.device, warmUpCache, NULL);
+    };
+
+    const std::vector<uint32_t> threadCounts = get_bench_thread_counts(info);
+    for (int warm = 0; warm < 2; warm++) {
+        for (uint32_t threadCount : threadCounts) {
+            auto warmUp = [&]() {
+                VkResult U_ASSERT_ONLY res =
+                    warm_up_pipelines(info, warm ? info.pipelineCache : warmUpCache, variants, variantPipelines, threadCount);
+                assert(res == VK_SUCCESS);
+            };
+
+            char name[96];
+            snprintf(name, sizeof(name), "warm_up_pipelines, %u thread(s), %s cache", threadCount, warm ? "warm" : "cold");
+            const std::function<void()> setup = warm ? std::function<void()>() : createEmptyWarmUpCache;
+            const std::function<void()> teardown = warm ? std::function<void()>(destroyVariants) : destroyVariantsAndCache;
+            results.push_back(run_bench_trials(name, trials, setup, warmUp, teardown));
+            printf("  %u thread(s), %s cache: %.0f pipelines/s\n", threadCount, warm ? "warm" : "cold",
+                   variants.size() / (results.back().median_ms / 1000.0));
+        }
+    }
+    report_bench_results(info, "pipeline_cache", results);
 
     // Begin standard draw stuff
 
@@ -282,38 +247,11 @@ int sample_main(int argc, char *argv[]) {
 
     // End standard draw stuff
 
-    // TODO: Create another pipeline cache, preferably different from the first
-    // one and merge it here.  Then store the merged one.
-
     // Store away the cache that we've populated.  This could conceivably happen
     // earlier, depends on when the pipeline cache stops being populated
     // internally.
-    size_t endCacheSize = 0;
-    void *endCacheData = nullptr;
-
-    // Call with nullptr to get cache size
-    res = vkGetPipelineCacheData(info.device, info.pipelineCache, &endCacheSize, nullptr);
-    assert(res == VK_SUCCESS);
-
-    // Allocate memory to hold the populated cache data
-    endCacheData = (char *)malloc(sizeof(char) * endCacheSize);
-    if (!endCacheData) {
-        fputs("Memory error", stderr);
-        exit(EXIT_FAILURE);
-    }
-
-    // Call again with pointer to buffer
-    res = vkGetPipelineCacheData(info.device, info.pipelineCache, &endCacheSize, endCacheData);
-    assert(res == VK_SUCCESS);
-
-    // Write the file to disk, overwriting whatever was there
-    FILE *pWriteFile;
-    std::string writeFileName = directoryName + "pipeline_cache_data.bin";
-    pWriteFile = fopen(writeFileName.c_str(), "wb");
-    if (pWriteFile) {
-        fwrite(endCacheData, sizeof(char), endCacheSize, pWriteFile);
-        fclose(pWriteFile);
-        printf("  cacheData written to %s\n", writeFileName.c_str());
+    if (save_pipeline_cache(info, "pipeline_cache", info.pipelineCache)) {
+        printf("  cacheData written to %s\n", get_pipeline_cache_path(info, "pipeline_cache").c_str());
     } else {
         // Something bad happened
         printf("  Unable to write cache data to disk!\n");
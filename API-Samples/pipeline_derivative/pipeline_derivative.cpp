@@ -224,8 +224,6 @@ int sample_main(int argc, char *argv[]) {
     pipeline.subpass = 0;
 
     // Create the base pipeline without storing it in the info struct
-    // NOTE:  If desired, we can add timing info around pipeline creation to
-    //        demonstrate any perf benefits to derivation.
     VkPipeline basePipeline;
     res = vkCreateGraphicsPipelines(info.device, info.pipelineCache, 1, &pipeline, NULL, &basePipeline);
     assert(res == VK_SUCCESS);
@@ -261,6 +259,24 @@ int sample_main(int argc, char *argv[]) {
 
     /* VULKAN_KEY_END */
 
+    // Compare creating the second pipeline as a derivative and on its own.
+    // No pipeline cache is used, so neither finds the pipeline created above,
+    // but drivers may still keep caches of their own.
+    VkPipeline benchPipeline = VK_NULL_HANDLE;
+    auto createPipeline = [&]() {
+        VkResult U_ASSERT_ONLY res = vkCreateGraphicsPipelines(info.device, VK_NULL_HANDLE, 1, &pipeline, NULL, &benchPipeline);
+        assert(res == VK_SUCCESS);
+    };
+    auto destroyPipeline = [&]() { vkDestroyPipeline(info.device, benchPipeline, NULL); };
+
+    const uint32_t trials = get_bench_trials(info, 20);
+    std::vector<bench_result> results;
+    results.push_back(run_bench_trials("vkCreateGraphicsPipelines, derivative", trials, nullptr, createPipeline, destroyPipeline));
+    pipeline.flags = 0;
+    pipeline.basePipelineHandle = VK_NULL_HANDLE;
+    results.push_back(run_bench_trials("vkCreateGraphicsPipelines, not derived", trials, nullptr, createPipeline, destroyPipeline));
+    report_bench_results(info, "pipeline_derivative", results);
+
     init_presentable_image(info);
 
     VkClearValue clear_values[2];
@@ -0,0 +1,193 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+VULKAN_SAMPLE_SHORT_DESCRIPTION
+Time loading a large PPM file into mapped staging memory
+*/
+
+#include <util_init.hpp>
+#include <util_image.hpp>
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <cstdlib>
+
+#define IMAGE_WIDTH 4096
+#define IMAGE_HEIGHT 4096
+#define ITERATIONS 5
+
+/* The original read_ppm: scanf the header and fread every pixel */
+static bool read_ppm_per_pixel(const char *filename, int width, int height, uint64_t rowPitch, unsigned char *dataPtr) {
+    char magicStr[3] = {}, heightStr[6] = {}, widthStr[6] = {}, formatStr[6] = {};
+
+    FILE *fPtr = fopen(filename, "rb");
+    if (!fPtr) return false;
+
+    if (fscanf(fPtr, "%2s %5s %5s %5s ", magicStr, widthStr, heightStr, formatStr) != 4 || atoi(widthStr) != width ||
+        atoi(heightStr) != height) {
+        fclose(fPtr);
+        return false;
+    }
+
+    for (int y = 0; y < height; y++) {
+        unsigned char *rowPtr = dataPtr;
+        for (int x = 0; x < width; x++) {
+            if (fread(rowPtr, 3, 1, fPtr) != 1) {
+                fclose(fPtr);
+                return false;
+            }
+            rowPtr[3] = 255;
+            rowPtr += 4;
+        }
+        dataPtr += rowPitch;
+    }
+    fclose(fPtr);
+
+    return true;
+}
+
+static bool read_ppm_mapped(const char *filename, uint64_t rowPitch, unsigned char *dataPtr) {
+    pnm_image image;
+    if (!open_pnm(filename, image)) return false;
+
+    pnm_to_rgba8(image, dataPtr, rowPitch);
+    close_pnm(image);
+
+    return true;
+}
+
+int sample_main(int argc, char *argv[]) {
+    VkResult U_ASSERT_ONLY res;
+    bool U_ASSERT_ONLY pass;
+    struct sample_info info = {};
+    char sample_title[] = "PPM Loading Sample";
+    const char *filename = "ppm_loading.ppm";
+
+    process_command_line_args(info, argc, argv);
+    init_global_layer_properties(info);
+    init_instance(info, sample_title);
+    init_enumerate_device(info);
+    init_queue_family_index(info);
+    init_device(info);
+
+    /* Write a noisy image, so the file cannot be compressed or cached cleverly */
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) {
+        std::cout << "Could not create " << filename << "\n";
+        exit(-1);
+    }
+    /* No comment in the header: the per-pixel reader, like the original
+     * read_ppm, cannot skip one */
+    fprintf(fp, "P6\n%d %d\n255\n", IMAGE_WIDTH, IMAGE_HEIGHT);
+    std::vector<unsigned char> row(IMAGE_WIDTH * 3);
+    uint32_t seed = 1;
+    for (int y = 0; y < IMAGE_HEIGHT; y++) {
+        for (size_t i = 0; i < row.size(); i++) {
+            seed = seed * 1664525 + 1013904223;
+            row[i] = (unsigned char)(seed >> 24);
+        }
+        fwrite(row.data(), 1, row.size(), fp);
+    }
+    fclose(fp);
+
+    /* VULKAN_KEY_START */
+
+    /* A staging buffer as init_image would use, with rows padded like a linear image's */
+    const uint64_t rowPitch = ((uint64_t)IMAGE_WIDTH * 4 + 255) & ~(uint64_t)255;
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.pNext = NULL;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buf_info.size = rowPitch * IMAGE_HEIGHT;
+    buf_info.queueFamilyIndexCount = 0;
+    buf_info.pQueueFamilyIndices = NULL;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buf_info.flags = 0;
+    VkBuffer stagingBuf;
+    res = vkCreateBuffer(info.device, &buf_info, NULL, &stagingBuf);
+    assert(res == VK_SUCCESS);
+
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(info.device, stagingBuf, &mem_reqs);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.pNext = NULL;
+    alloc_info.allocationSize = mem_reqs.size;
+    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                       &alloc_info.memoryTypeIndex);
+    assert(pass && "No mappable, coherent memory");
+
+    VkDeviceMemory stagingMem;
+    res = vkAllocateMemory(info.device, &alloc_info, NULL, &stagingMem);
+    assert(res == VK_SUCCESS);
+    res = vkBindBufferMemory(info.device, stagingBuf, stagingMem, 0);
+    assert(res == VK_SUCCESS);
+
+    unsigned char *pData;
+    res = vkMapMemory(info.device, stagingMem, 0, buf_info.size, 0, (void **)&pData);
+    assert(res == VK_SUCCESS);
+
+    /* Mapped memory is often write-combined and slow to read, so check a copy */
+    std::vector<unsigned char> expected(buf_info.size);
+    if (!read_ppm_per_pixel(filename, IMAGE_WIDTH, IMAGE_HEIGHT, rowPitch, expected.data())) {
+        std::cout << "Could not read " << filename << "\n";
+        exit(-1);
+    }
+
+    double perPixelMs = 0.0, mappedMs = 0.0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        pass = read_ppm_per_pixel(filename, IMAGE_WIDTH, IMAGE_HEIGHT, rowPitch, pData);
+        assert(pass);
+        std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+        pass = read_ppm_mapped(filename, rowPitch, pData);
+        assert(pass);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        perPixelMs += std::chrono::duration<double, std::milli>(middle - start).count();
+        mappedMs += std::chrono::duration<double, std::milli>(end - middle).count();
+    }
+
+    bool match = true;
+    for (int y = 0; y < IMAGE_HEIGHT && match; y++)
+        match = !memcmp(pData + y * rowPitch, expected.data() + y * rowPitch, IMAGE_WIDTH * 4);
+
+    vkUnmapMemory(info.device, stagingMem);
+
+    /* VULKAN_KEY_END */
+
+    const double megapixels = (double)IMAGE_WIDTH * IMAGE_HEIGHT / 1e6;
+    printf("%dx%d image, average of %d loads:\n", IMAGE_WIDTH, IMAGE_HEIGHT, ITERATIONS);
+    printf("  per-pixel fread: %8.2f ms (%.1f MP/s)\n", perPixelMs / ITERATIONS, megapixels * 1000.0 * ITERATIONS / perPixelMs);
+    printf("  mapped, vector:  %8.2f ms (%.1f MP/s)\n", mappedMs / ITERATIONS, megapixels * 1000.0 * ITERATIONS / mappedMs);
+    printf("  results %s\n", match ? "match" : "DIFFER");
+
+    vkDestroyBuffer(info.device, stagingBuf, NULL);
+    vkFreeMemory(info.device, stagingMem, NULL);
+    destroy_device(info);
+    destroy_instance(info);
+
+    remove(filename);
+
+    return match ? 0 : 1;
+}
@@ -78,13 +78,18 @@ int sample_main(int argc, char *argv[]) {
     // we have to set up a couple of things by hand, but this
     // isn't any different to other examples
 
-    // get two different textures
-    init_texture(info, "green.ppm");
+    // get two different textures, sharing one staging buffer and one submit
+    upload_batch uploads;
+    init_upload_batch(info, uploads);
+
+    init_texture(info, "green.ppm", 0, 0, &uploads);
     VkDescriptorImageInfo greenTex = info.texture_data.image_info;
 
-    init_texture(info, "lunarg.ppm");
+    init_texture(info, "lunarg.ppm", 0, 0, &uploads);
     VkDescriptorImageInfo lunargTex = info.texture_data.image_info;
 
+    execute_submit_upload_batch(uploads);
+
     // create two identical descriptor sets, each with a different texture but
     // identical UBOa
     VkDescriptorPoolSize pool_size[2];
@@ -339,6 +344,7 @@ int sample_main(int argc, char *argv[]) {
     vkDestroySemaphore(info.device, imageAcquiredSemaphore, NULL);
     destroy_pipeline(info);
     destroy_pipeline_cache(info);
+    destroy_upload_batch(uploads);
     destroy_textures(info);
     destroy_descriptor_pool(info);
     destroy_vertex_buffer(info);
@@ -28,6 +28,9 @@ a black cube.  If both boolean and color values are specified,
 it will render the specified color (blue).
 
 The SPIR-V path is included as an alternative to using a front end.
+The constants can also be baked into the module before it is created,
+which is how a variant cache would make its variants; run with
+--bake-specialization to do that.
 */
 
 #include <util_init.hpp>
@@ -278,6 +281,50 @@ int sample_main(int argc, char *argv[]) {
         moduleCreateInfo.pCode = spirv_specialization_frag;
     }
 
+    // Reflect both stages to check the map against the spec IDs the module
+    // declares, and to show the set layout the shaders imply
+    spirv_module vertModule, fragModule;
+    bool U_ASSERT_ONLY parsed = parse_spirv_module(vert_info.pCode, vert_info.codeSize, vertModule);
+    assert(parsed);
+    parsed = parse_spirv_module(moduleCreateInfo.pCode, moduleCreateInfo.codeSize, fragModule);
+    assert(parsed);
+
+    std::vector<spirv_reflection> stages(2);
+    reflect_spirv(vertModule, stages[0]);
+    reflect_spirv(fragModule, stages[1]);
+
+    for (uint32_t i = 0; i < specInfo.mapEntryCount; i++) {
+        bool found = false;
+        for (size_t j = 0; j < stages[1].spec_constants.size(); j++) {
+            const spirv_spec_constant &constant = stages[1].spec_constants[j];
+            if (constant.spec_id != entries[i].constantID) continue;
+            found = true;
+            if (constant.size != entries[i].size)
+                std::cout << "spec ID " << constant.spec_id << " is " << constant.size << " bytes, not " << entries[i].size
+                          << "\n";
+        }
+        if (!found) std::cout << "spec ID " << entries[i].constantID << " is not in the fragment shader\n";
+    }
+
+    std::vector<VkDescriptorSetLayoutBinding> layoutBindings;
+    get_spirv_set_layout_bindings(stages, 0, layoutBindings);
+    for (size_t i = 0; i < layoutBindings.size(); i++) {
+        std::cout << "set 0 binding " << layoutBindings[i].binding << ": descriptor type " << layoutBindings[i].descriptorType
+                  << ", stages 0x" << std::hex << layoutBindings[i].stageFlags << std::dec << "\n";
+    }
+
+    // With --bake-specialization, bake the constants into the fragment module
+    // instead of handing them to pipeline creation.  spirv_specialization_check
+    // checks that both give the same constants.
+    std::vector<uint32_t> baked;
+    if (info.bake_specialization) {
+        bool U_ASSERT_ONLY bakedOk = bake_spirv_specialization(moduleCreateInfo.pCode, moduleCreateInfo.codeSize, &specInfo, baked);
+        assert(bakedOk);
+        moduleCreateInfo.codeSize = baked.size() * sizeof(uint32_t);
+        moduleCreateInfo.pCode = baked.data();
+        info.shaderStages[1].pSpecializationInfo = NULL;
+    }
+
     res = vkCreateShaderModule(info.device, &moduleCreateInfo, NULL, &info.shaderStages[1].module);
     assert(res == VK_SUCCESS);
 
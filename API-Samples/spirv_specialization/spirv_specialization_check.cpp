@@ -0,0 +1,142 @@
+/*
+ * Vulkan Samples Kit
+ *
+ * Copyright (C) 2016-2020 Valve Corporation
+ * Copyright (C) 2016-2020 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+Checks the SPIR-V utilities on the fragment shaders of spirv_specialization,
+without a device: reflecting them, baking their specialization constants in,
+and patching constants of the baked modules.  A baked module has to hold the
+constants pipeline creation would have given the unbaked one, so
+--bake-specialization renders the same.  Exits with 1 on any mismatch.
+*/
+
+#include <util_init.hpp>
+#include <string.h>
+#include <cstdio>
+#include "spirv_specialization.frag.h"
+#include "specialized.frag.h"
+
+// Opcodes of the constants a baked module holds
+static const uint32_t OP_CONSTANT_TRUE = 41;
+static const uint32_t OP_CONSTANT_FALSE = 42;
+static const uint32_t OP_CONSTANT = 43;
+
+static int failures = 0;
+
+static void check(bool condition, const char *shader, const char *what) {
+    if (condition) return;
+    printf("%s: %s\n", shader, what);
+    failures++;
+}
+
+// The OpConstantTrue, OpConstantFalse or OpConstant result_id
+static bool find_constant(const spirv_module &module, uint32_t result_id, spirv_instruction &inst) {
+    size_t offset = 0;
+    while (next_spirv_instruction(module, offset, inst)) {
+        if (inst.opcode >= OP_CONSTANT_TRUE && inst.opcode <= OP_CONSTANT && inst.word_count >= 3 &&
+            inst.words[2] == result_id)
+            return true;
+    }
+    return false;
+}
+
+static uint32_t float_bits(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static void check_shader(const char *shader, const uint32_t *code, size_t code_size) {
+    // The map of the sample, with values that differ from the defaults
+    const VkSpecializationMapEntry entries[] = {{5, 0, sizeof(uint32_t)},
+                                                {7, 1 * sizeof(uint32_t), sizeof(uint32_t)},
+                                                {8, 2 * sizeof(uint32_t), sizeof(uint32_t)},
+                                                {9, 3 * sizeof(uint32_t), sizeof(uint32_t)}};
+    const uint32_t data[4] = {VK_TRUE, float_bits(0.25f), float_bits(0.5f), float_bits(1.0f)};
+    const VkSpecializationInfo specInfo = {4, entries, sizeof(data), data};
+
+    spirv_module module;
+    spirv_reflection reflection;
+    if (!parse_spirv_module(code, code_size, module) || !reflect_spirv(module, reflection)) {
+        check(false, shader, "cannot be reflected");
+        return;
+    }
+    check(reflection.spec_constants.size() >= 4, shader, "lacks spec constants");
+
+    // Baked with and without the map, every spec constant becomes a constant
+    // holding the mapped value or its default
+    for (int mapped = 0; mapped < 2; mapped++) {
+        std::vector<uint32_t> baked;
+        spirv_module bakedModule;
+        spirv_reflection bakedReflection;
+        if (!bake_spirv_specialization(code, code_size, mapped ? &specInfo : NULL, baked) ||
+            !parse_spirv_module(baked.data(), baked.size() * sizeof(uint32_t), bakedModule) ||
+            !reflect_spirv(bakedModule, bakedReflection)) {
+            check(false, shader, "cannot be baked");
+            continue;
+        }
+        check(bakedReflection.spec_constants.empty(), shader, "keeps spec constants after baking");
+        check(bakedReflection.bindings.size() == reflection.bindings.size(), shader, "loses bindings in baking");
+
+        for (size_t i = 0; i < reflection.spec_constants.size(); i++) {
+            const spirv_spec_constant &constant = reflection.spec_constants[i];
+
+            uint64_t expected = constant.default_value;
+            for (uint32_t e = 0; mapped && e < specInfo.mapEntryCount; e++) {
+                if (entries[e].constantID == constant.spec_id) expected = data[entries[e].offset / sizeof(uint32_t)];
+            }
+
+            spirv_instruction inst;
+            if (!find_constant(bakedModule, constant.result_id, inst)) {
+                check(false, shader, "loses a constant in baking");
+            } else if (constant.is_bool) {
+                check(inst.opcode == (expected ? OP_CONSTANT_TRUE : OP_CONSTANT_FALSE), shader, "bakes a bool wrong");
+            } else {
+                check(inst.opcode == OP_CONSTANT && inst.words[3] == (uint32_t)expected, shader, "bakes a value wrong");
+            }
+        }
+
+        // Patching a baked constant changes it in place
+        for (size_t i = 0; mapped && i < reflection.spec_constants.size(); i++) {
+            const spirv_spec_constant &constant = reflection.spec_constants[i];
+            const bool patched = patch_spirv_constant(baked.data(), baked.size() * sizeof(uint32_t), constant.result_id,
+                                                      float_bits(0.75f));
+            check(patched != constant.is_bool, shader, "patches the wrong constants");
+            if (!patched) continue;
+
+            const size_t word = find_spirv_constant_word(bakedModule, constant.result_id);
+            check(word && baked[word] == float_bits(0.75f), shader, "does not hold a patched value");
+        }
+    }
+
+    // An entry that does not fit its constant is refused
+    VkSpecializationMapEntry shortEntries[4];
+    memcpy(shortEntries, entries, sizeof(entries));
+    shortEntries[1].size = 2;
+    const VkSpecializationInfo shortInfo = {4, shortEntries, sizeof(data), data};
+    std::vector<uint32_t> baked;
+    check(!bake_spirv_specialization(code, code_size, &shortInfo, baked), shader, "bakes an entry of the wrong size");
+}
+
+int sample_main(int argc, char *argv[]) {
+    check_shader("spirv_specialization.frag", spirv_specialization_frag, sizeof(spirv_specialization_frag));
+    check_shader("specialized.frag", specialized_frag, sizeof(specialized_frag));
+
+    printf("spirv_specialization_check: %d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
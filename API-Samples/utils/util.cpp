@@ -32,6 +32,7 @@ samples utility functions
 #include <fstream>
 #include <iostream>
 #include "util.hpp"
+#include "util_image.hpp"
 
 #ifdef __ANDROID__
 // Android specific include files.
@@ -47,11 +48,11 @@ static android_app *Android_application = nullptr;
 #include <MoltenVKGLSLToSPIRVConverter/GLSLToSPIRVConverter.h>
 #endif
 
-// For timestamp code (get_milliseconds)
+// For timestamp code (get_nanoseconds)
 #ifdef WIN32
 #include <Windows.h>
 #else
-#include <sys/time.h>
+#include <time.h>
 #endif
 
 using namespace std;
@@ -193,80 +194,36 @@ void set_image_layout(struct sample_info &info, VkImage image, VkImageAspectFlag
 
 bool read_ppm(char const *const filename, int &width, int &height, uint64_t rowPitch, unsigned char *dataPtr) {
     // PPM format expected from http://netpbm.sourceforge.net/doc/ppm.html
-    //  1. magic number
-    //  2. whitespace
-    //  3. width
-    //  4. whitespace
-    //  5. height
-    //  6. whitespace
-    //  7. max color value
-    //  8. whitespace
-    //  7. data
-
-    // Comments are not supported, but are detected and we kick out
-    // Only 8 bits per channel is supported
+    // Binary PPM (P6) and PGM (P5) files are supported, with comments and
+    // 8 or 16 bits per channel.  Channels are rescaled to 8 bits.
     // If dataPtr is nullptr, only width and height are returned
 
-    // Read in values from the PPM file as characters to check for comments
-    char magicStr[3] = {}, heightStr[6] = {}, widthStr[6] = {}, formatStr[6] = {};
-
-#ifndef __ANDROID__
-    FILE *fPtr = fopen(filename, "rb");
-#else
-    FILE *fPtr = AndroidFopen(filename, "rb");
-#endif
-    if (!fPtr) {
-        printf("Bad filename in read_ppm: %s\n", filename);
-        return false;
-    }
-
-    // Read the four values from file, accounting with any and all whitepace
-    int U_ASSERT_ONLY count = fscanf(fPtr, "%s %s %s %s ", magicStr, widthStr, heightStr, formatStr);
-    assert(count == 4);
-
-    // Kick out if comments present
-    if (magicStr[0] == '#' || widthStr[0] == '#' || heightStr[0] == '#' || formatStr[0] == '#') {
-        printf("Unhandled comment in PPM file\n");
+    pnm_image image;
+    if (!open_pnm(filename, image)) {
+        printf("Bad filename or unhandled PPM file in read_ppm: %s\n", filename);
         return false;
     }
 
-    // Only one magic value is valid
-    if (strncmp(magicStr, "P6", sizeof(magicStr))) {
-        printf("Unhandled PPM magic number: %s\n", magicStr);
-        return false;
-    }
-
-    width = atoi(widthStr);
-    height = atoi(heightStr);
+    width = image.width;
+    height = image.height;
 
     // Ensure we got something sane for width/height
     static const int saneDimension = 32768;  //??
     if (width <= 0 || width > saneDimension) {
         printf("Width seems wrong.  Update read_ppm if not: %u\n", width);
+        close_pnm(image);
         return false;
     }
     if (height <= 0 || height > saneDimension) {
         printf("Height seems wrong.  Update read_ppm if not: %u\n", height);
+        close_pnm(image);
         return false;
     }
 
-    if (dataPtr == nullptr) {
-        // If no destination pointer, caller only wanted dimensions
-        return true;
-    }
+    // If no destination pointer, caller only wanted dimensions
+    if (dataPtr != nullptr) pnm_to_rgba8(image, dataPtr, rowPitch);
 
-    // Now read the data
-    for (int y = 0; y < height; y++) {
-        unsigned char *rowPtr = dataPtr;
-        for (int x = 0; x < width; x++) {
-            count = fread(rowPtr, 3, 1, fPtr);
-            assert(count == 1);
-            rowPtr[3] = 255; /* Alpha of 1 */
-            rowPtr += 4;
-        }
-        dataPtr += rowPitch;
-    }
-    fclose(fPtr);
+    close_pnm(image);
 
     return true;
 }
@@ -324,24 +281,27 @@ void wait_seconds(int seconds) {
 #endif
 }
 
-timestamp_t get_milliseconds() {
+timestamp_t get_nanoseconds() {
 #ifdef WIN32
-    LARGE_INTEGER frequency;
-    BOOL useQPC = QueryPerformanceFrequency(&frequency);
-    if (useQPC) {
-        LARGE_INTEGER now;
-        QueryPerformanceCounter(&now);
-        return (1000LL * now.QuadPart) / frequency.QuadPart;
-    } else {
-        return GetTickCount();
-    }
+    // QueryPerformanceCounter always succeeds on XP and later
+    static LARGE_INTEGER frequency;
+    if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    // Split the conversion so the multiplication cannot overflow
+    const timestamp_t seconds = now.QuadPart / frequency.QuadPart;
+    const timestamp_t remainder = now.QuadPart % frequency.QuadPart;
+    return seconds * 1000000000ULL + remainder * 1000000000ULL / frequency.QuadPart;
 #else
-    struct timeval now;
-    gettimeofday(&now, NULL);
-    return (now.tv_usec / 1000) + (timestamp_t)now.tv_sec;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (timestamp_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
 #endif
 }
 
+timestamp_t get_milliseconds() { return get_nanoseconds() / 1000000; }
+
 void print_UUID(uint8_t *pipelineCacheUUID) {
     for (int j = 0; j < VK_UUID_SIZE; ++j) {
         std::cout << std::setw(2) << (uint32_t)pipelineCacheUUID[j];
@@ -363,12 +323,32 @@ void process_command_line_args(struct sample_info &info, int argc, char *argv[])
     for (i = 1, n = 1; i < argc; i++) {
         if (optionMatch("--save-images", argv[i]))
             info.save_images = true;
+        else if (optionMatch("--bench-json=", argv[i]))
+            info.bench_json = argv[i] + strlen("--bench-json=");
+        else if (optionMatch("--bench-trials=", argv[i]))
+            info.bench_trials = atoi(argv[i] + strlen("--bench-trials="));
+        else if (optionMatch("--bench-threads=", argv[i]))
+            info.bench_threads = atoi(argv[i] + strlen("--bench-threads="));
+        else if (optionMatch("--bake-specialization", argv[i]))
+            info.bake_specialization = true;
         else if (optionMatch("--help", argv[i]) || optionMatch("-h", argv[i])) {
             printf("\nOther options:\n");
             printf(
                 "\t--save-images\n"
                 "\t\tSave tests images as ppm files in current working "
                 "directory.\n");
+            printf(
+                "\t--bench-json=<file>\n"
+                "\t\tWrite the timings of samples that benchmark as JSON.\n");
+            printf(
+                "\t--bench-trials=<count>\n"
+                "\t\tRepeat each timing of samples that benchmark count times.\n");
+            printf(
+                "\t--bench-threads=<count>\n"
+                "\t\tUse up to count threads in samples that benchmark with several.\n");
+            printf(
+                "\t--bake-specialization\n"
+                "\t\tBake specialization constants into shader modules in samples that specialize.\n");
             exit(0);
         } else {
             printf("\nUnrecognized option: %s\n", argv[i]);
@@ -386,185 +366,6 @@ void process_command_line_args(struct sample_info &info, int argc, char *argv[])
     }
 }
 
-void write_ppm(struct sample_info &info, const char *basename) {
-    string filename;
-    int x, y;
-    VkResult res;
-
-    VkImageCreateInfo image_create_info = {};
-    image_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-    image_create_info.pNext = NULL;
-    image_create_info.imageType = VK_IMAGE_TYPE_2D;
-    image_create_info.format = info.format;
-    image_create_info.extent.width = info.width;
-    image_create_info.extent.height = info.height;
-    image_create_info.extent.depth = 1;
-    image_create_info.mipLevels = 1;
-    image_create_info.arrayLayers = 1;
-    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
-    image_create_info.tiling = VK_IMAGE_TILING_LINEAR;
-    image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-    image_create_info.queueFamilyIndexCount = 0;
-    image_create_info.pQueueFamilyIndices = NULL;
-    image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    image_create_info.flags = 0;
-
-    VkMemoryAllocateInfo mem_alloc = {};
-    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_alloc.pNext = NULL;
-    mem_alloc.allocationSize = 0;
-    mem_alloc.memoryTypeIndex = 0;
-
-    VkImage mappableImage;
-    VkDeviceMemory mappableMemory;
-
-    /* Create a mappable image */
-    res = vkCreateImage(info.device, &image_create_info, NULL, &mappableImage);
-    assert(res == VK_SUCCESS);
-
-    VkMemoryRequirements mem_reqs;
-    vkGetImageMemoryRequirements(info.device, mappableImage, &mem_reqs);
-
-    mem_alloc.allocationSize = mem_reqs.size;
-
-    /* Find the memory type that is host mappable */
-    bool U_ASSERT_ONLY pass = memory_type_from_properties(
-        info, mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        &mem_alloc.memoryTypeIndex);
-    assert(pass && "No mappable, coherent memory");
-
-    /* allocate memory */
-    res = vkAllocateMemory(info.device, &mem_alloc, NULL, &(mappableMemory));
-    assert(res == VK_SUCCESS);
-
-    /* bind memory */
-    res = vkBindImageMemory(info.device, mappableImage, mappableMemory, 0);
-    assert(res == VK_SUCCESS);
-
-    VkCommandBufferBeginInfo cmd_buf_info = {};
-    cmd_buf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    cmd_buf_info.pNext = NULL;
-    cmd_buf_info.flags = 0;
-    cmd_buf_info.pInheritanceInfo = NULL;
-
-    res = vkBeginCommandBuffer(info.cmd, &cmd_buf_info);
-    set_image_layout(info, mappableImage, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
-                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-    set_image_layout(info, info.buffers[info.current_buffer].image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-                     VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-    VkImageCopy copy_region;
-    copy_region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    copy_region.srcSubresource.mipLevel = 0;
-    copy_region.srcSubresource.baseArrayLayer = 0;
-    copy_region.srcSubresource.layerCount = 1;
-    copy_region.srcOffset.x = 0;
-    copy_region.srcOffset.y = 0;
-    copy_region.srcOffset.z = 0;
-    copy_region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    copy_region.dstSubresource.mipLevel = 0;
-    copy_region.dstSubresource.baseArrayLayer = 0;
-    copy_region.dstSubresource.layerCount = 1;
-    copy_region.dstOffset.x = 0;
-    copy_region.dstOffset.y = 0;
-    copy_region.dstOffset.z = 0;
-    copy_region.extent.width = info.width;
-    copy_region.extent.height = info.height;
-    copy_region.extent.depth = 1;
-
-    /* Put the copy command into the command buffer */
-    vkCmdCopyImage(info.cmd, info.buffers[info.current_buffer].image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, mappableImage,
-                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy_region);
-
-    set_image_layout(info, mappableImage, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
-                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT);
-
-    res = vkEndCommandBuffer(info.cmd);
-    assert(res == VK_SUCCESS);
-    const VkCommandBuffer cmd_bufs[] = {info.cmd};
-    VkFenceCreateInfo fenceInfo;
-    VkFence cmdFence;
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.pNext = NULL;
-    fenceInfo.flags = 0;
-    vkCreateFence(info.device, &fenceInfo, NULL, &cmdFence);
-
-    VkSubmitInfo submit_info[1] = {};
-    submit_info[0].pNext = NULL;
-    submit_info[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info[0].waitSemaphoreCount = 0;
-    submit_info[0].pWaitSemaphores = NULL;
-    submit_info[0].pWaitDstStageMask = NULL;
-    submit_info[0].commandBufferCount = 1;
-    submit_info[0].pCommandBuffers = cmd_bufs;
-    submit_info[0].signalSemaphoreCount = 0;
-    submit_info[0].pSignalSemaphores = NULL;
-
-    /* Queue the command buffer for execution */
-    res = vkQueueSubmit(info.graphics_queue, 1, submit_info, cmdFence);
-    assert(res == VK_SUCCESS);
-
-    /* Make sure command buffer is finished before mapping */
-    do {
-        res = vkWaitForFences(info.device, 1, &cmdFence, VK_TRUE, FENCE_TIMEOUT);
-    } while (res == VK_TIMEOUT);
-    assert(res == VK_SUCCESS);
-
-    vkDestroyFence(info.device, cmdFence, NULL);
-
-    filename.append(basename);
-    filename.append(".ppm");
-
-    VkImageSubresource subres = {};
-    subres.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    subres.mipLevel = 0;
-    subres.arrayLayer = 0;
-    VkSubresourceLayout sr_layout;
-    vkGetImageSubresourceLayout(info.device, mappableImage, &subres, &sr_layout);
-
-    char *ptr;
-    res = vkMapMemory(info.device, mappableMemory, 0, mem_reqs.size, 0, (void **)&ptr);
-    assert(res == VK_SUCCESS);
-
-    ptr += sr_layout.offset;
-    ofstream file(filename.c_str(), ios::binary);
-
-    file << "P6\n";
-    file << info.width << " ";
-    file << info.height << "\n";
-    file << 255 << "\n";
-
-    for (y = 0; y < info.height; y++) {
-        const int *row = (const int *)ptr;
-        int swapped;
-
-        if (info.format == VK_FORMAT_B8G8R8A8_UNORM || info.format == VK_FORMAT_B8G8R8A8_SRGB) {
-            for (x = 0; x < info.width; x++) {
-                swapped = (*row & 0xff00ff00) | (*row & 0x000000ff) << 16 | (*row & 0x00ff0000) >> 16;
-                file.write((char *)&swapped, 3);
-                row++;
-            }
-        } else if (info.format == VK_FORMAT_R8G8B8A8_UNORM) {
-            for (x = 0; x < info.width; x++) {
-                file.write((char *)row, 3);
-                row++;
-            }
-        } else {
-            printf("Unrecognized image format - will not write image files");
-            break;
-        }
-
-        ptr += sr_layout.rowPitch;
-    }
-
-    file.close();
-    vkUnmapMemory(info.device, mappableMemory);
-    vkDestroyImage(info.device, mappableImage, NULL);
-    vkFreeMemory(info.device, mappableMemory, NULL);
-}
-
 std::string get_file_directory() {
 #ifndef __ANDROID__
     return "";
@@ -18,6 +18,7 @@
  */
 
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -70,6 +71,10 @@
 /* Amount of time, in nanoseconds, to wait for a command buffer to complete */
 #define FENCE_TIMEOUT 100000000
 
+/* Amount of time, in milliseconds, a frame loop waits for a minimized window
+ * to get an area again before it gives up */
+#define FRAME_LOOP_TIMEOUT 5000
+
 #define GET_INSTANCE_PROC_ADDR(inst, entrypoint)                               \
     {                                                                          \
         info.fp##entrypoint =                                                  \
@@ -99,6 +104,25 @@
 std::string get_base_data_dir();
 std::string get_data_dir(std::string filename);
 
+/*
+ * A range of a device memory block handed out by the sample allocator, see
+ * util_memory.hpp.  mapped points at offset when the memory is host visible.
+ */
+struct memory_allocation {
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    void *mapped;
+
+    /* where it came from; pool is DEDICATED_POOL for a dedicated allocation */
+    uint32_t pool;
+    uint32_t block;
+    uint32_t order;
+};
+
+struct memory_allocator;
+struct readback;
+
 /*
  * structure to track all objects related to a texture.
  */
@@ -112,12 +136,128 @@ struct texture_object {
     VkBuffer buffer;
     VkDeviceSize buffer_size;
 
+    /* allocated by init_image and init_buffer */
+    memory_allocation image_alloc;
+    memory_allocation buffer_alloc;
+
+    /* for samples that allocate by hand */
     VkDeviceMemory image_memory;
     VkDeviceMemory buffer_memory;
     VkImageView view;
     int32_t tex_width, tex_height;
 };
 
+/*
+ * Collects buffer and image uploads so they share staging memory, one
+ * command buffer and one submit.  Staging space is handed out under the
+ * mutex, so worker threads can reserve and fill uploads while the batch
+ * is open; the copies are only recorded when it is submitted.
+ */
+struct upload_staging_chunk {
+    VkBuffer buffer;
+    memory_allocation alloc;
+    unsigned char *data;
+    VkDeviceSize size;
+    VkDeviceSize used;
+};
+
+struct upload_image_copy {
+    VkImage image;
+    VkBufferImageCopy region;
+    VkBuffer src;
+    VkImageLayout final_layout;
+    VkAccessFlags dst_access;
+};
+
+struct upload_buffer_copy {
+    VkBuffer buffer;
+    VkBufferCopy region;
+    VkBuffer src;
+    VkAccessFlags dst_access;
+};
+
+struct upload_batch {
+    struct sample_info *info;
+    VkCommandPool cmd_pool;
+    VkCommandBuffer cmd;
+    VkFence fence;
+    bool submitted;
+
+    VkDeviceSize chunk_size;
+    /* optimalBufferCopyOffsetAlignment; image copies align further */
+    VkDeviceSize alignment;
+    std::vector<upload_staging_chunk> chunks;
+    std::vector<upload_image_copy> images;
+    std::vector<upload_buffer_copy> buffers;
+    VkPipelineStageFlags dst_stages;
+    std::mutex mutex;
+};
+
+/*
+ * Renders frames continuously with several of them in flight.  Each frame
+ * has its own command pool, reset as a whole once the frame's fence shows
+ * its previous submission has finished, so nothing waits on the GPU unless
+ * all frames are in flight.
+ */
+struct frame_loop_frame {
+    VkCommandPool cmd_pool;
+    VkCommandBuffer cmd;
+    VkFence fence;
+    VkSemaphore image_acquired;
+};
+
+/*
+ * Records one frame into info.cmd for the swap chain image in
+ * info.current_buffer.  The loop points info.cmd at the command buffer of
+ * the frame, which it begins and ends itself; frame is the index of the
+ * frame, for samples that keep per frame resources.
+ */
+typedef void (*frame_loop_record)(struct sample_info &info, uint32_t frame, void *user_data);
+
+struct frame_loop {
+    struct sample_info *info;
+    frame_loop_record record;
+    void *user_data;
+    bool include_depth;
+
+    std::vector<frame_loop_frame> frames;
+    uint32_t frame_index;
+
+    /* per swap chain image: signaled for the present, and the fence of the
+     * frame that last rendered to it */
+    std::vector<VkSemaphore> render_done;
+    std::vector<VkFence> image_fences;
+
+    uint64_t frames_presented;
+    uint32_t swap_chain_recreations;
+
+    /* when capturing, writes every frame to <capture_basename>_<frame>.ppm;
+     * see util_readback.hpp */
+    struct readback *capture;
+    std::string capture_basename;
+};
+
+/*
+ * The state a sample pipeline varies in.  Everything else is as in
+ * init_pipeline, which creates the pipeline of init_pipeline_desc.
+ */
+struct pipeline_desc {
+    VkBool32 include_depth;
+    VkBool32 include_vi;
+    VkPrimitiveTopology topology;
+    VkCullModeFlags cull_mode;
+    VkFrontFace front_face;
+    VkCompareOp depth_compare_op;
+
+    /* two stages, or NULL for info.shaderStages */
+    const VkPipelineShaderStageCreateInfo *stages;
+    /* of the viewport where it is not dynamic, or 0 by 0 for info.width by
+     * info.height */
+    VkExtent2D extent;
+    /* or VK_NULL_HANDLE for info.render_pass */
+    VkRenderPass render_pass;
+};
+
 /*
  * Keep each of our swap chain buffers' image, command buffer and view in one
  * spot
@@ -168,6 +308,10 @@ struct sample_info {
     bool prepared;
     bool use_staging_buffer;
     bool save_images;
+    std::string bench_json; /* --bench-json, empty for none */
+    uint32_t bench_trials;  /* --bench-trials, 0 for the sample's default */
+    uint32_t bench_threads; /* --bench-threads, 0 for one per core */
+    bool bake_specialization; /* --bake-specialization */
 
     std::vector<const char *> instance_layer_names;
     std::vector<const char *> instance_extension_names;
@@ -184,6 +328,9 @@ struct sample_info {
     uint32_t graphics_queue_family_index;
     uint32_t present_queue_family_index;
     VkPhysicalDeviceProperties gpu_props;
+    VkPhysicalDeviceFeatures gpu_features;
+    /* set before init_device to enable features; none are by default */
+    VkPhysicalDeviceFeatures enabled_features;
     std::vector<VkQueueFamilyProperties> queue_props;
     VkPhysicalDeviceMemoryProperties memory_properties;
 
@@ -198,11 +345,14 @@ struct sample_info {
 
     VkCommandPool cmd_pool;
 
+    struct memory_allocator *allocator;
+
     struct {
         VkFormat format;
 
         VkImage image;
-        VkDeviceMemory mem;
+        memory_allocation alloc;
+        VkDeviceMemory mem; /* for samples that allocate by hand */
         VkImageView view;
     } depth;
 
@@ -210,7 +360,8 @@ struct sample_info {
 
     struct {
         VkBuffer buf;
-        VkDeviceMemory mem;
+        memory_allocation alloc;
+        VkDeviceMemory mem; /* for samples that allocate by hand */
         VkDescriptorBufferInfo buffer_info;
     } uniform_data;
 
@@ -220,7 +371,8 @@ struct sample_info {
 
     struct {
         VkBuffer buf;
-        VkDeviceMemory mem;
+        memory_allocation alloc;
+        VkDeviceMemory mem; /* for samples that allocate by hand */
         VkDescriptorBufferInfo buffer_info;
     } vertex_buffer;
     VkVertexInputBindingDescription vi_binding;
@@ -282,6 +434,8 @@ void print_UUID(uint8_t *pipelineCacheUUID);
 std::string get_file_directory();
 
 typedef unsigned long long timestamp_t;
+/* Monotonic, for measuring intervals only */
+timestamp_t get_nanoseconds();
 timestamp_t get_milliseconds();
 
 // Main entry point of samples
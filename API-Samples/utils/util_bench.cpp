@@ -0,0 +1,133 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <thread>
+
+#define NS_PER_MS 1000000.0
+
+bench_result compute_bench_result(const char *name, std::vector<timestamp_t> durations_ns) {
+    bench_result result = {};
+    result.name = name;
+    result.trials = (uint32_t)durations_ns.size();
+    if (durations_ns.empty()) return result;
+
+    std::sort(durations_ns.begin(), durations_ns.end());
+    const size_t count = durations_ns.size();
+
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++) total += durations_ns[i];
+
+    result.min_ms = durations_ns.front() / NS_PER_MS;
+    result.max_ms = durations_ns.back() / NS_PER_MS;
+    result.mean_ms = total / count / NS_PER_MS;
+    if (count % 2)
+        result.median_ms = durations_ns[count / 2] / NS_PER_MS;
+    else
+        result.median_ms = (durations_ns[count / 2 - 1] + durations_ns[count / 2]) / 2.0 / NS_PER_MS;
+
+    /* nearest rank: the smallest duration at least 95% of the trials fit in */
+    const size_t rank = (count * 95 + 99) / 100;
+    result.p95_ms = durations_ns[rank - 1] / NS_PER_MS;
+
+    return result;
+}
+
+bench_result run_bench_trials(const char *name, uint32_t trials, const std::function<void()> &setup,
+                              const std::function<void()> &timed, const std::function<void()> &teardown) {
+    std::vector<timestamp_t> durations_ns(trials);
+
+    for (uint32_t i = 0; i < trials; i++) {
+        if (setup) setup();
+        {
+            scoped_timer timer(durations_ns[i]);
+            timed();
+        }
+        if (teardown) teardown();
+    }
+
+    return compute_bench_result(name, durations_ns);
+}
+
+uint32_t get_bench_trials(struct sample_info &info, uint32_t default_trials) {
+    return info.bench_trials ? info.bench_trials : default_trials;
+}
+
+std::vector<uint32_t> get_bench_thread_counts(struct sample_info &info) {
+    uint32_t max_threads = info.bench_threads ? info.bench_threads : std::thread::hardware_concurrency();
+    if (!max_threads) max_threads = 1;
+
+    std::vector<uint32_t> counts;
+    for (uint32_t count = 1; count < max_threads; count *= 2) counts.push_back(count);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+static void write_json_string(FILE *file, const std::string &str) {
+    fputc('"', file);
+    for (size_t i = 0; i < str.size(); i++) {
+        const unsigned char c = str[i];
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(file, "\\u%04x", c);
+        else
+            fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+static bool write_bench_json(struct sample_info &info, const char *sample_name, const std::vector<bench_result> &results) {
+    FILE *file = fopen(info.bench_json.c_str(), "w");
+    if (!file) return false;
+
+    fprintf(file, "{\n  \"sample\": ");
+    write_json_string(file, sample_name);
+    fprintf(file, ",\n  \"device\": ");
+    write_json_string(file, info.gpu_props.deviceName);
+    fprintf(file, ",\n  \"driverVersion\": %u,\n  \"results\": [", info.gpu_props.driverVersion);
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const bench_result &result = results[i];
+        fprintf(file, "%s\n    {\"name\": ", i ? "," : "");
+        write_json_string(file, result.name);
+        fprintf(file,
+                ", \"trials\": %u, \"min_ms\": %.6f, \"median_ms\": %.6f, \"p95_ms\": %.6f, \"max_ms\": %.6f, \"mean_ms\": %.6f}",
+                result.trials, result.min_ms, result.median_ms, result.p95_ms, result.max_ms, result.mean_ms);
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    const bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+void report_bench_results(struct sample_info &info, const char *sample_name, const std::vector<bench_result> &results) {
+    for (size_t i = 0; i < results.size(); i++) {
+        const bench_result &result = results[i];
+        printf("  %s: median %.3f ms, min %.3f ms, p95 %.3f ms over %u trials\n", result.name.c_str(), result.median_ms,
+               result.min_ms, result.p95_ms, result.trials);
+    }
+
+    if (!info.bench_json.empty() && !write_bench_json(info, sample_name, results)) {
+        printf("  Could not write %s\n", info.bench_json.c_str());
+    }
+}
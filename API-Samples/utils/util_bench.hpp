@@ -0,0 +1,76 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BENCH_HPP
+#define UTIL_BENCH_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+#include <functional>
+
+/*
+ * Benchmarking for the samples that time Vulkan calls.
+ *
+ * A single measurement of a driver call varies a lot from run to run, so
+ * samples repeat it with run_bench_trials and report the spread of the
+ * trials.  report_bench_results prints them, and with --bench-json=<file>
+ * also writes them as JSON for comparing runs.
+ */
+
+/* Adds the time between its construction and destruction to elapsed_ns */
+class scoped_timer {
+   public:
+    explicit scoped_timer(timestamp_t &elapsed_ns) : elapsed_ns(elapsed_ns), start(get_nanoseconds()) {}
+    ~scoped_timer() { elapsed_ns += get_nanoseconds() - start; }
+
+   private:
+    scoped_timer(const scoped_timer &);
+    scoped_timer &operator=(const scoped_timer &);
+
+    timestamp_t &elapsed_ns;
+    const timestamp_t start;
+};
+
+struct bench_result {
+    std::string name;
+    uint32_t trials;
+    double min_ms;
+    double median_ms;
+    double p95_ms;
+    double max_ms;
+    double mean_ms;
+};
+
+/* Summarizes the durations of the trials of one measurement */
+bench_result compute_bench_result(const char *name, std::vector<timestamp_t> durations_ns);
+
+/* Times trials calls of timed.  setup and teardown run before and after
+ * each call, untimed, and may be empty. */
+bench_result run_bench_trials(const char *name, uint32_t trials, const std::function<void()> &setup,
+                              const std::function<void()> &timed, const std::function<void()> &teardown);
+
+/* Trials requested by --bench-trials, or default_trials */
+uint32_t get_bench_trials(struct sample_info &info, uint32_t default_trials);
+
+/* Thread counts to measure scaling with: powers of two up to the count
+ * requested by --bench-threads, or one per core, and that count itself */
+std::vector<uint32_t> get_bench_thread_counts(struct sample_info &info);
+
+void report_bench_results(struct sample_info &info, const char *sample_name, const std::vector<bench_result> &results);
+
+#endif  // UTIL_BENCH_HPP
@@ -0,0 +1,137 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BUDDY_HPP
+#define UTIL_BUDDY_HPP
+
+/*
+ * Buddy suballocation of fixed size blocks, without any Vulkan calls.
+ *
+ * This is the bookkeeping of the device memory allocators of the sample
+ * utilities (util_memory.cpp) and of Hologram (MemoryAllocator.cpp), which
+ * only add the memory behind each block, dedicated allocations, and their
+ * own error handling.  A pool has blocks of 1 << order bytes; ranges are
+ * powers of two of at least 1 << BUDDY_MIN_ORDER bytes, so they are aligned
+ * to their size.
+ *
+ * Not thread safe; the allocators lock around it.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <set>
+#include <vector>
+
+/* Smallest range is 1 << BUDDY_MIN_ORDER bytes */
+#define BUDDY_MIN_ORDER 8
+
+struct buddy_block {
+    /* offsets of the free ranges of each order, BUDDY_MIN_ORDER first; empty
+     * while the block is not in use */
+    std::vector<std::set<uint64_t> > free;
+    uint64_t used;
+};
+
+struct buddy_pool {
+    uint32_t order;
+    std::vector<buddy_block> blocks;
+};
+
+/* The order of the smallest range that holds size bytes */
+inline uint32_t get_buddy_order(uint64_t size) {
+    uint32_t order = BUDDY_MIN_ORDER;
+    while (((uint64_t)1 << order) < size) order++;
+    return order;
+}
+
+/* Blocks of block_size, but no more than an eighth of their heap, so small
+ * heaps are not exhausted by a single mostly empty block */
+inline void init_buddy_pool(buddy_pool &pool, uint64_t block_size, uint64_t heap_size) {
+    pool.order = get_buddy_order(block_size);
+    while (pool.order > BUDDY_MIN_ORDER + 4 && ((uint64_t)1 << pool.order) > heap_size / 8) pool.order--;
+    pool.blocks.clear();
+}
+
+/* Takes a range of the order from a block, first fit.  Returns false when
+ * no block in use has room, and the caller adds one. */
+inline bool execute_buddy_allocate(buddy_pool &pool, uint32_t order, uint32_t &block_index, uint64_t &offset) {
+    for (size_t b = 0; b < pool.blocks.size(); b++) {
+        buddy_block &block = pool.blocks[b];
+        if (block.free.empty()) continue;
+
+        uint32_t o = order;
+        while (o <= pool.order && block.free[o - BUDDY_MIN_ORDER].empty()) o++;
+        if (o > pool.order) continue;
+
+        std::set<uint64_t> &free = block.free[o - BUDDY_MIN_ORDER];
+        offset = *free.begin();
+        free.erase(free.begin());
+
+        /* Put the upper halves back until the range is the requested size */
+        while (o > order) {
+            o--;
+            block.free[o - BUDDY_MIN_ORDER].insert(offset + ((uint64_t)1 << o));
+        }
+
+        block.used += (uint64_t)1 << order;
+        block_index = (uint32_t)b;
+        return true;
+    }
+
+    return false;
+}
+
+/* Puts an empty block in use, reusing the slot of one that was released,
+ * and returns its index */
+inline uint32_t execute_buddy_add_block(buddy_pool &pool) {
+    size_t b = 0;
+    while (b < pool.blocks.size() && !pool.blocks[b].free.empty()) b++;
+    if (b == pool.blocks.size()) pool.blocks.push_back(buddy_block());
+
+    buddy_block &block = pool.blocks[b];
+    block.free.resize(pool.order - BUDDY_MIN_ORDER + 1);
+    block.free[pool.order - BUDDY_MIN_ORDER].insert(0);
+    block.used = 0;
+    return (uint32_t)b;
+}
+
+/* Returns a range, merging it with its buddy for as long as that is free
+ * too.  Returns true when the block is left empty; it is then released and
+ * the caller frees the memory behind it. */
+inline bool execute_buddy_free(buddy_pool &pool, uint32_t block_index, uint32_t order, uint64_t offset) {
+    buddy_block &block = pool.blocks[block_index];
+    block.used -= (uint64_t)1 << order;
+
+    while (order < pool.order) {
+        std::set<uint64_t> &free = block.free[order - BUDDY_MIN_ORDER];
+        std::set<uint64_t>::iterator buddy = free.find(offset ^ ((uint64_t)1 << order));
+        if (buddy == free.end()) break;
+
+        free.erase(buddy);
+        offset &= ~((uint64_t)1 << order);
+        order++;
+    }
+    block.free[order - BUDDY_MIN_ORDER].insert(offset);
+
+    if (block.used) return false;
+
+    block.free.clear();
+    return true;
+}
+
+#endif  // UTIL_BUDDY_HPP
@@ -0,0 +1,470 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+VULKAN_SAMPLE_DESCRIPTION
+samples image loading functions
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "util_image.hpp"
+
+#if defined(__ANDROID__)
+#include "util.hpp"
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define UTIL_IMAGE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define UTIL_IMAGE_TARGET(t)
+#else
+#define UTIL_IMAGE_TARGET(t) __attribute__((target(t)))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define UTIL_IMAGE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+/* Map the file, or read it in one go when mapping is not available */
+bool load_file(const char *filename, pnm_image &image) {
+#if !defined(__ANDROID__) && !defined(_WIN32)
+    int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        void *mapping = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+            mapping = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+            image.mapping = mapping;
+            image.mapping_size = static_cast<size_t>(st.st_size);
+            return true;
+        }
+    }
+#elif defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size;
+        void *mapping = NULL;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE file_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (file_mapping) {
+                mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+                // the view keeps the mapping alive
+                CloseHandle(file_mapping);
+            }
+        }
+        CloseHandle(file);
+
+        if (mapping) {
+            image.mapping = mapping;
+            image.mapping_size = static_cast<size_t>(size.QuadPart);
+            return true;
+        }
+    }
+#endif
+
+#ifndef __ANDROID__
+    FILE *fp = fopen(filename, "rb");
+#else
+    FILE *fp = AndroidFopen(filename, "rb");
+#endif
+    if (!fp) return false;
+
+    bool ok = false;
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        long size = ftell(fp);
+        if (size > 0 && fseek(fp, 0, SEEK_SET) == 0) {
+            image.buffer.resize(static_cast<size_t>(size));
+            ok = (fread(image.buffer.data(), 1, image.buffer.size(), fp) == image.buffer.size());
+        }
+    }
+    fclose(fp);
+
+    return ok;
+}
+
+bool is_space(unsigned char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; }
+
+/* Skip whitespace and comments, which run to the end of the line */
+size_t skip_space(const unsigned char *data, size_t size, size_t pos) {
+    while (pos < size) {
+        if (data[pos] == '#') {
+            while (pos < size && data[pos] != '\n' && data[pos] != '\r') pos++;
+        } else if (is_space(data[pos])) {
+            pos++;
+        } else {
+            break;
+        }
+    }
+
+    return pos;
+}
+
+bool parse_uint(const unsigned char *data, size_t size, size_t &pos, int &value) {
+    const size_t start = skip_space(data, size, pos);
+    if (start == pos) return false;
+
+    long long v = 0;
+    pos = start;
+    while (pos < size && data[pos] >= '0' && data[pos] <= '9') {
+        v = v * 10 + (data[pos++] - '0');
+        if (v > 0x7fffffff) return false;
+    }
+    if (pos == start) return false;
+
+    value = static_cast<int>(v);
+    return true;
+}
+
+bool parse_header(const unsigned char *data, size_t size, pnm_image &image) {
+    if (size < 2 || data[0] != 'P' || (data[1] != '5' && data[1] != '6')) return false;
+    image.channels = (data[1] == '6') ? 3 : 1;
+
+    size_t pos = 2;
+    if (!parse_uint(data, size, pos, image.width) || !parse_uint(data, size, pos, image.height) ||
+        !parse_uint(data, size, pos, image.maxval))
+        return false;
+    if (image.width <= 0 || image.height <= 0 || image.maxval <= 0 || image.maxval > 65535) return false;
+
+    // exactly one whitespace character precedes the raster
+    if (pos >= size || !is_space(data[pos])) return false;
+    pos++;
+
+    const size_t sample_size = (image.maxval > 255) ? 2 : 1;
+    const size_t raster_size = static_cast<size_t>(image.width) * image.height * image.channels * sample_size;
+    if (size - pos < raster_size) return false;
+
+    image.pixels = data + pos;
+    return true;
+}
+
+void rgb8_to_rgba8_scalar(const unsigned char *src, unsigned char *dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = 255;
+        src += 3;
+        dst += 4;
+    }
+}
+
+void rgba8_to_rgb8_scalar(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue) {
+    const int red = swap_red_and_blue ? 2 : 0;
+    for (size_t i = 0; i < count; i++) {
+        dst[0] = src[red];
+        dst[1] = src[1];
+        dst[2] = src[2 - red];
+        src += 4;
+        dst += 3;
+    }
+}
+
+#ifdef UTIL_IMAGE_X86
+
+/*
+ * Expand 16 RGB pixels, loaded as three 16-byte vectors, to four vectors of
+ * four pixels each.  The byte shifts keep every load inside the 48 bytes.
+ */
+#define UTIL_IMAGE_SPLIT_RGB16(src, p0, p1, p2, p3)                              \
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));      \
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src) + 1);  \
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src) + 2);  \
+    const __m128i p0 = a;                                                           \
+    const __m128i p1 = _mm_alignr_epi8(b, a, 12);                                   \
+    const __m128i p2 = _mm_alignr_epi8(c, b, 8);                                    \
+    const __m128i p3 = _mm_srli_si128(c, 4)
+
+UTIL_IMAGE_TARGET("ssse3")
+void rgb8_to_rgba8_ssse3(const unsigned char *src, unsigned char *dst, size_t count) {
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000u));
+
+    for (; count >= 16; count -= 16) {
+        UTIL_IMAGE_SPLIT_RGB16(src, p0, p1, p2, p3);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dst);
+        _mm_storeu_si128(out + 0, _mm_or_si128(_mm_shuffle_epi8(p0, shuffle), alpha));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_shuffle_epi8(p1, shuffle), alpha));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_shuffle_epi8(p2, shuffle), alpha));
+        _mm_storeu_si128(out + 3, _mm_or_si128(_mm_shuffle_epi8(p3, shuffle), alpha));
+
+        src += 48;
+        dst += 64;
+    }
+
+    rgb8_to_rgba8_scalar(src, dst, count);
+}
+
+UTIL_IMAGE_TARGET("avx2")
+void rgb8_to_rgba8_avx2(const unsigned char *src, unsigned char *dst, size_t count) {
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6,
+                                             7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xff000000u));
+
+    for (; count >= 16; count -= 16) {
+        UTIL_IMAGE_SPLIT_RGB16(src, p0, p1, p2, p3);
+
+        // vpshufb shuffles within 128-bit lanes, which is all we need
+        const __m256i p01 = _mm256_inserti128_si256(_mm256_castsi128_si256(p0), p1, 1);
+        const __m256i p23 = _mm256_inserti128_si256(_mm256_castsi128_si256(p2), p3, 1);
+
+        __m256i *out = reinterpret_cast<__m256i *>(dst);
+        _mm256_storeu_si256(out + 0, _mm256_or_si256(_mm256_shuffle_epi8(p01, shuffle), alpha));
+        _mm256_storeu_si256(out + 1, _mm256_or_si256(_mm256_shuffle_epi8(p23, shuffle), alpha));
+
+        src += 48;
+        dst += 64;
+    }
+
+    rgb8_to_rgba8_scalar(src, dst, count);
+}
+
+#undef UTIL_IMAGE_SPLIT_RGB16
+
+UTIL_IMAGE_TARGET("ssse3")
+void rgba8_to_rgb8_ssse3(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue) {
+    // pack the RGB triplets of four pixels into the low 12 bytes
+    const __m128i shuffle = swap_red_and_blue ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+                                              : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    for (; count >= 16; count -= 16) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(src);
+        const __m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128(in + 0), shuffle);
+        const __m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), shuffle);
+        const __m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), shuffle);
+        const __m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), shuffle);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dst);
+        _mm_storeu_si128(out + 0, _mm_or_si128(p0, _mm_slli_si128(p1, 12)));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(p1, 4), _mm_slli_si128(p2, 8)));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(p2, 8), _mm_slli_si128(p3, 4)));
+
+        src += 64;
+        dst += 48;
+    }
+
+    rgba8_to_rgb8_scalar(src, dst, count, swap_red_and_blue);
+}
+
+bool cpu_has_ssse3() {
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 1);
+    return (regs[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+bool cpu_has_avx2() {
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 1);
+    // the OS must save the YMM registers too
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // UTIL_IMAGE_X86
+
+#ifdef UTIL_IMAGE_NEON
+
+void rgb8_to_rgba8_neon(const unsigned char *src, unsigned char *dst, size_t count) {
+    uint8x16x4_t rgba;
+    rgba.val[3] = vdupq_n_u8(255);
+
+    for (; count >= 16; count -= 16) {
+        const uint8x16x3_t rgb = vld3q_u8(src);
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        vst4q_u8(dst, rgba);
+
+        src += 48;
+        dst += 64;
+    }
+
+    rgb8_to_rgba8_scalar(src, dst, count);
+}
+
+void rgba8_to_rgb8_neon(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue) {
+    const int red = swap_red_and_blue ? 2 : 0;
+    uint8x16x3_t rgb;
+
+    for (; count >= 16; count -= 16) {
+        const uint8x16x4_t rgba = vld4q_u8(src);
+        rgb.val[0] = rgba.val[red];
+        rgb.val[1] = rgba.val[1];
+        rgb.val[2] = rgba.val[2 - red];
+        vst3q_u8(dst, rgb);
+
+        src += 64;
+        dst += 48;
+    }
+
+    rgba8_to_rgb8_scalar(src, dst, count, swap_red_and_blue);
+}
+
+#endif  // UTIL_IMAGE_NEON
+
+typedef void (*rgb8_to_rgba8_func)(const unsigned char *src, unsigned char *dst, size_t count);
+typedef void (*rgba8_to_rgb8_func)(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue);
+
+rgb8_to_rgba8_func select_rgb8_to_rgba8() {
+#if defined(UTIL_IMAGE_X86)
+    if (cpu_has_avx2()) return rgb8_to_rgba8_avx2;
+    if (cpu_has_ssse3()) return rgb8_to_rgba8_ssse3;
+#elif defined(UTIL_IMAGE_NEON)
+    return rgb8_to_rgba8_neon;
+#endif
+    return rgb8_to_rgba8_scalar;
+}
+
+rgba8_to_rgb8_func select_rgba8_to_rgb8() {
+#if defined(UTIL_IMAGE_X86)
+    if (cpu_has_ssse3()) return rgba8_to_rgb8_ssse3;
+#elif defined(UTIL_IMAGE_NEON)
+    return rgba8_to_rgb8_neon;
+#endif
+    return rgba8_to_rgb8_scalar;
+}
+
+/* Any other sample format, rescaled to 8 bits */
+void pnm_to_rgba8_generic(const pnm_image &image, unsigned char *dst, uint64_t rowPitch) {
+    const bool wide = (image.maxval > 255);
+    const unsigned int maxval = static_cast<unsigned int>(image.maxval);
+
+    const unsigned char *src = image.pixels;
+    for (int y = 0; y < image.height; y++) {
+        unsigned char *row = dst;
+        for (int x = 0; x < image.width; x++) {
+            unsigned char rgb[3] = {};
+            for (int c = 0; c < image.channels; c++) {
+                unsigned int v = wide ? ((src[0] << 8) | src[1]) : src[0];
+                src += wide ? 2 : 1;
+
+                if (v > maxval) v = maxval;
+                rgb[c] = static_cast<unsigned char>((v * 255 + maxval / 2) / maxval);
+            }
+            if (image.channels == 1) rgb[1] = rgb[2] = rgb[0];
+
+            row[0] = rgb[0];
+            row[1] = rgb[1];
+            row[2] = rgb[2];
+            row[3] = 255;
+            row += 4;
+        }
+        dst += rowPitch;
+    }
+}
+
+}  // namespace
+
+bool open_pnm(const char *filename, pnm_image &image) {
+    image.width = 0;
+    image.height = 0;
+    image.channels = 0;
+    image.maxval = 0;
+    image.pixels = NULL;
+    image.mapping = NULL;
+    image.mapping_size = 0;
+    image.buffer.clear();
+
+    if (!load_file(filename, image)) return false;
+
+    const unsigned char *data = image.mapping ? static_cast<const unsigned char *>(image.mapping) : image.buffer.data();
+    const size_t size = image.mapping ? image.mapping_size : image.buffer.size();
+    if (!parse_header(data, size, image)) {
+        close_pnm(image);
+        return false;
+    }
+
+    return true;
+}
+
+void close_pnm(pnm_image &image) {
+    if (image.mapping) {
+#if defined(_WIN32)
+        UnmapViewOfFile(image.mapping);
+#elif !defined(__ANDROID__)
+        munmap(image.mapping, image.mapping_size);
+#endif
+        image.mapping = NULL;
+        image.mapping_size = 0;
+    }
+
+    std::vector<unsigned char>().swap(image.buffer);
+    image.pixels = NULL;
+}
+
+void rgb8_to_rgba8(const unsigned char *src, unsigned char *dst, size_t count) {
+    static const rgb8_to_rgba8_func func = select_rgb8_to_rgba8();
+    func(src, dst, count);
+}
+
+void rgba8_to_rgb8(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue) {
+    static const rgba8_to_rgb8_func func = select_rgba8_to_rgb8();
+    func(src, dst, count, swap_red_and_blue);
+}
+
+void pnm_to_rgba8(const pnm_image &image, unsigned char *dst, uint64_t rowPitch) {
+    if (image.channels != 3 || image.maxval != 255) {
+        pnm_to_rgba8_generic(image, dst, rowPitch);
+        return;
+    }
+
+    const size_t src_pitch = static_cast<size_t>(image.width) * 3;
+
+    // one call for the whole image when the rows are tightly packed
+    if (rowPitch == static_cast<uint64_t>(image.width) * 4) {
+        rgb8_to_rgba8(image.pixels, dst, static_cast<size_t>(image.width) * image.height);
+        return;
+    }
+
+    const unsigned char *src = image.pixels;
+    for (int y = 0; y < image.height; y++) {
+        rgb8_to_rgba8(src, dst, image.width);
+        src += src_pitch;
+        dst += rowPitch;
+    }
+}
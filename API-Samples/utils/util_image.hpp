@@ -0,0 +1,64 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_IMAGE_HPP
+#define UTIL_IMAGE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ * A binary PPM (P6) or PGM (P5) image, see
+ * http://netpbm.sourceforge.net/doc/ppm.html.  open_pnm memory-maps the file
+ * where possible, or reads it with a single large read otherwise, and parses
+ * the header, comments included, in one pass.  pixels points into the file
+ * until close_pnm.
+ */
+struct pnm_image {
+    int width;
+    int height;
+    /* 3 for PPM, 1 for PGM */
+    int channels;
+    /* samples are 16-bit big-endian when greater than 255 */
+    int maxval;
+    const unsigned char *pixels;
+
+    /* the file contents, either mapped or in buffer */
+    void *mapping;
+    size_t mapping_size;
+    std::vector<unsigned char> buffer;
+};
+
+bool open_pnm(const char *filename, pnm_image &image);
+void close_pnm(pnm_image &image);
+
+/*
+ * Write the image as RGBA8 rows of rowPitch bytes, with an alpha of 255.
+ * Samples are rescaled to 8 bits.  dst may be mapped, write-combined memory;
+ * every byte of it is written once, in order.
+ */
+void pnm_to_rgba8(const pnm_image &image, unsigned char *dst, uint64_t rowPitch);
+
+/* The RGB8 to RGBA8 kernel of pnm_to_rgba8, using AVX2, SSSE3 or NEON when available */
+void rgb8_to_rgba8(const unsigned char *src, unsigned char *dst, size_t count);
+
+/* The reverse, dropping alpha and optionally swapping red and blue, using SSSE3 or NEON when available */
+void rgba8_to_rgb8(const unsigned char *src, unsigned char *dst, size_t count, bool swap_red_and_blue);
+
+#endif  // UTIL_IMAGE_HPP
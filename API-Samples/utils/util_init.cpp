@@ -23,10 +23,13 @@ VULKAN_SAMPLE_DESCRIPTION
 samples "init" utility functions
 */
 
+#include <chrono>
 #include <cstdlib>
+#include <thread>
 #include <assert.h>
 #include <string.h>
 #include "util_init.hpp"
+#include "util_image.hpp"
 #include "cube_data.h"
 
 #if defined(VK_USE_PLATFORM_WAYLAND_KHR)
@@ -229,11 +232,13 @@ VkResult init_device(struct sample_info &info) {
     device_info.pQueueCreateInfos = &queue_info;
     device_info.enabledExtensionCount = info.device_extension_names.size();
     device_info.ppEnabledExtensionNames = device_info.enabledExtensionCount ? info.device_extension_names.data() : NULL;
-    device_info.pEnabledFeatures = NULL;
+    device_info.pEnabledFeatures = &info.enabled_features;
 
     res = vkCreateDevice(info.gpus[0], &device_info, NULL, &info.device);
     assert(res == VK_SUCCESS);
 
+    init_memory_allocator(info);
+
     return res;
 }
 
@@ -256,6 +261,7 @@ VkResult init_enumerate_device(struct sample_info &info, uint32_t gpu_count) {
     /* This is as good a place as any to do this */
     vkGetPhysicalDeviceMemoryProperties(info.gpus[0], &info.memory_properties);
     vkGetPhysicalDeviceProperties(info.gpus[0], &info.gpu_props);
+    vkGetPhysicalDeviceFeatures(info.gpus[0], &info.gpu_features);
     /* query device extensions for enabled layers */
     for (auto &layer_props : info.instance_layer_properties) {
         init_device_extension_properties(info, layer_props);
@@ -640,12 +646,6 @@ void init_depth_buffer(struct sample_info &info) {
     image_info.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
     image_info.flags = 0;
 
-    VkMemoryAllocateInfo mem_alloc = {};
-    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_alloc.pNext = NULL;
-    mem_alloc.allocationSize = 0;
-    mem_alloc.memoryTypeIndex = 0;
-
     VkImageViewCreateInfo view_info = {};
     view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
     view_info.pNext = NULL;
@@ -668,28 +668,14 @@ void init_depth_buffer(struct sample_info &info) {
         view_info.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
     }
 
-    VkMemoryRequirements mem_reqs;
-
     /* Create image */
     res = vkCreateImage(info.device, &image_info, NULL, &info.depth.image);
     assert(res == VK_SUCCESS);
 
-    vkGetImageMemoryRequirements(info.device, info.depth.image, &mem_reqs);
-
-    mem_alloc.allocationSize = mem_reqs.size;
-    /* Use the memory properties to determine the type of memory required */
-    pass =
-        memory_type_from_properties(info, mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &mem_alloc.memoryTypeIndex);
+    /* Allocate and bind memory */
+    pass = allocate_image_memory(info, info.depth.image, image_info.tiling, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, info.depth.alloc);
     assert(pass);
 
-    /* Allocate memory */
-    res = vkAllocateMemory(info.device, &mem_alloc, NULL, &info.depth.mem);
-    assert(res == VK_SUCCESS);
-
-    /* Bind memory */
-    res = vkBindImageMemory(info.device, info.depth.image, info.depth.mem, 0);
-    assert(res == VK_SUCCESS);
-
     /* Create image view */
     view_info.image = info.depth.image;
     res = vkCreateImageView(info.device, &view_info, NULL, &info.depth.view);
@@ -1077,33 +1063,13 @@ void init_uniform_buffer(struct sample_info &info) {
     res = vkCreateBuffer(info.device, &buf_info, NULL, &info.uniform_data.buf);
     assert(res == VK_SUCCESS);
 
-    VkMemoryRequirements mem_reqs;
-    vkGetBufferMemoryRequirements(info.device, info.uniform_data.buf, &mem_reqs);
-
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.pNext = NULL;
-    alloc_info.memoryTypeIndex = 0;
-
-    alloc_info.allocationSize = mem_reqs.size;
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits,
-                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                       &alloc_info.memoryTypeIndex);
+    pass = allocate_buffer_memory(info, info.uniform_data.buf,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  info.uniform_data.alloc);
     assert(pass && "No mappable, coherent memory");
 
-    res = vkAllocateMemory(info.device, &alloc_info, NULL, &(info.uniform_data.mem));
-    assert(res == VK_SUCCESS);
-
-    uint8_t *pData;
-    res = vkMapMemory(info.device, info.uniform_data.mem, 0, mem_reqs.size, 0, (void **)&pData);
-    assert(res == VK_SUCCESS);
-
-    memcpy(pData, &info.MVP, sizeof(info.MVP));
-
-    vkUnmapMemory(info.device, info.uniform_data.mem);
-
-    res = vkBindBufferMemory(info.device, info.uniform_data.buf, info.uniform_data.mem, 0);
-    assert(res == VK_SUCCESS);
+    /* The allocator keeps host visible memory mapped */
+    memcpy(info.uniform_data.alloc.mapped, &info.MVP, sizeof(info.MVP));
 
     info.uniform_data.buffer_info.buffer = info.uniform_data.buf;
     info.uniform_data.buffer_info.offset = 0;
@@ -1370,35 +1336,15 @@ void init_vertex_buffer(struct sample_info &info, const void *vertexData, uint32
     res = vkCreateBuffer(info.device, &buf_info, NULL, &info.vertex_buffer.buf);
     assert(res == VK_SUCCESS);
 
-    VkMemoryRequirements mem_reqs;
-    vkGetBufferMemoryRequirements(info.device, info.vertex_buffer.buf, &mem_reqs);
-
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.pNext = NULL;
-    alloc_info.memoryTypeIndex = 0;
-
-    alloc_info.allocationSize = mem_reqs.size;
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits,
-                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                       &alloc_info.memoryTypeIndex);
+    pass = allocate_buffer_memory(info, info.vertex_buffer.buf,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  info.vertex_buffer.alloc);
     assert(pass && "No mappable, coherent memory");
-
-    res = vkAllocateMemory(info.device, &alloc_info, NULL, &(info.vertex_buffer.mem));
-    assert(res == VK_SUCCESS);
-    info.vertex_buffer.buffer_info.range = mem_reqs.size;
+    info.vertex_buffer.buffer_info.range = info.vertex_buffer.alloc.size;
     info.vertex_buffer.buffer_info.offset = 0;
 
-    uint8_t *pData;
-    res = vkMapMemory(info.device, info.vertex_buffer.mem, 0, mem_reqs.size, 0, (void **)&pData);
-    assert(res == VK_SUCCESS);
-
-    memcpy(pData, vertexData, dataSize);
-
-    vkUnmapMemory(info.device, info.vertex_buffer.mem);
-
-    res = vkBindBufferMemory(info.device, info.vertex_buffer.buf, info.vertex_buffer.mem, 0);
-    assert(res == VK_SUCCESS);
+    /* The allocator keeps host visible memory mapped */
+    memcpy(info.vertex_buffer.alloc.mapped, vertexData, dataSize);
 
     info.vi_binding.binding = 0;
     info.vi_binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
@@ -1521,9 +1467,29 @@ void init_pipeline_cache(struct sample_info &info) {
     assert(res == VK_SUCCESS);
 }
 
+void init_pipeline_desc(pipeline_desc &desc, VkBool32 include_depth, VkBool32 include_vi) {
+    desc.include_depth = include_depth;
+    desc.include_vi = include_vi;
+    desc.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    desc.cull_mode = VK_CULL_MODE_BACK_BIT;
+    desc.front_face = VK_FRONT_FACE_CLOCKWISE;
+    desc.depth_compare_op = VK_COMPARE_OP_LESS_OR_EQUAL;
+    desc.stages = NULL;
+    desc.extent.width = 0;
+    desc.extent.height = 0;
+    desc.render_pass = VK_NULL_HANDLE;
+}
+
 void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 include_vi) {
     VkResult U_ASSERT_ONLY res;
 
+    pipeline_desc desc;
+    init_pipeline_desc(desc, include_depth, include_vi);
+    res = init_pipeline(info, info.pipelineCache, desc, info.pipeline);
+    assert(res == VK_SUCCESS);
+}
+
+VkResult init_pipeline(struct sample_info &info, VkPipelineCache cache, const pipeline_desc &desc, VkPipeline &pipeline_out) {
     VkDynamicState dynamicStateEnables[2];  // Viewport + Scissor
     VkPipelineDynamicStateCreateInfo dynamicState = {};
     memset(dynamicStateEnables, 0, sizeof dynamicStateEnables);
@@ -1535,7 +1501,7 @@ void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 in
     VkPipelineVertexInputStateCreateInfo vi;
     memset(&vi, 0, sizeof(vi));
     vi.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    if (include_vi) {
+    if (desc.include_vi) {
         vi.pNext = NULL;
         vi.flags = 0;
         vi.vertexBindingDescriptionCount = 1;
@@ -1548,15 +1514,15 @@ void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 in
     ia.pNext = NULL;
     ia.flags = 0;
     ia.primitiveRestartEnable = VK_FALSE;
-    ia.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    ia.topology = desc.topology;
 
     VkPipelineRasterizationStateCreateInfo rs;
     rs.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
     rs.pNext = NULL;
     rs.flags = 0;
     rs.polygonMode = VK_POLYGON_MODE_FILL;
-    rs.cullMode = VK_CULL_MODE_BACK_BIT;
-    rs.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rs.cullMode = desc.cull_mode;
+    rs.frontFace = desc.front_face;
     rs.depthClampEnable = VK_FALSE;
     rs.rasterizerDiscardEnable = VK_FALSE;
     rs.depthBiasEnable = VK_FALSE;
@@ -1601,16 +1567,19 @@ void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 in
 #else
     // Temporary disabling dynamic viewport on Android because some of drivers doesn't
     // support the feature.
+    const bool use_info_extent = (desc.extent.width == 0 && desc.extent.height == 0);
+    const uint32_t width = use_info_extent ? info.width : desc.extent.width;
+    const uint32_t height = use_info_extent ? info.height : desc.extent.height;
     VkViewport viewports;
     viewports.minDepth = 0.0f;
     viewports.maxDepth = 1.0f;
     viewports.x = 0;
     viewports.y = 0;
-    viewports.width = info.width;
-    viewports.height = info.height;
+    viewports.width = width;
+    viewports.height = height;
     VkRect2D scissor;
-    scissor.extent.width = info.width;
-    scissor.extent.height = info.height;
+    scissor.extent.width = width;
+    scissor.extent.height = height;
     scissor.offset.x = 0;
     scissor.offset.y = 0;
     vp.viewportCount = NUM_VIEWPORTS;
@@ -1622,9 +1591,9 @@ void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 in
     ds.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
     ds.pNext = NULL;
     ds.flags = 0;
-    ds.depthTestEnable = include_depth;
-    ds.depthWriteEnable = include_depth;
-    ds.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+    ds.depthTestEnable = desc.include_depth;
+    ds.depthWriteEnable = desc.include_depth;
+    ds.depthCompareOp = desc.depth_compare_op;
     ds.depthBoundsTestEnable = VK_FALSE;
     ds.stencilTestEnable = VK_FALSE;
     ds.back.failOp = VK_STENCIL_OP_KEEP;
@@ -1666,13 +1635,12 @@ void init_pipeline(struct sample_info &info, VkBool32 include_depth, VkBool32 in
     pipeline.pDynamicState = &dynamicState;
     pipeline.pViewportState = &vp;
     pipeline.pDepthStencilState = &ds;
-    pipeline.pStages = info.shaderStages;
+    pipeline.pStages = desc.stages ? desc.stages : info.shaderStages;
     pipeline.stageCount = 2;
-    pipeline.renderPass = info.render_pass;
+    pipeline.renderPass = desc.render_pass ? desc.render_pass : info.render_pass;
     pipeline.subpass = 0;
 
-    res = vkCreateGraphicsPipelines(info.device, info.pipelineCache, 1, &pipeline, NULL, &info.pipeline);
-    assert(res == VK_SUCCESS);
+    return vkCreateGraphicsPipelines(info.device, cache, 1, &pipeline, NULL, &pipeline_out);
 }
 
 void init_sampler(struct sample_info &info, VkSampler &sampler) {
@@ -1715,32 +1683,16 @@ void init_buffer(struct sample_info &info, texture_object &texObj) {
     res = vkCreateBuffer(info.device, &buffer_create_info, NULL, &texObj.buffer);
     assert(res == VK_SUCCESS);
 
-    VkMemoryAllocateInfo mem_alloc = {};
-    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_alloc.pNext = NULL;
-    mem_alloc.allocationSize = 0;
-    mem_alloc.memoryTypeIndex = 0;
-
-    VkMemoryRequirements mem_reqs;
-    vkGetBufferMemoryRequirements(info.device, texObj.buffer, &mem_reqs);
-    mem_alloc.allocationSize = mem_reqs.size;
-    texObj.buffer_size = mem_reqs.size;
-
+    /* allocate and bind memory */
     VkFlags requirements = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits, requirements, &mem_alloc.memoryTypeIndex);
+    pass = allocate_buffer_memory(info, texObj.buffer, requirements, texObj.buffer_alloc);
     assert(pass && "No mappable, coherent memory");
-
-    /* allocate memory */
-    res = vkAllocateMemory(info.device, &mem_alloc, NULL, &(texObj.buffer_memory));
-    assert(res == VK_SUCCESS);
-
-    /* bind memory */
-    res = vkBindBufferMemory(info.device, texObj.buffer, texObj.buffer_memory, 0);
-    assert(res == VK_SUCCESS);
+    texObj.buffer_size = texObj.buffer_alloc.size;
+    texObj.buffer_memory = VK_NULL_HANDLE;
 }
 
 void init_image(struct sample_info &info, texture_object &texObj, const char *textureName, VkImageUsageFlags extraUsages,
-                VkFormatFeatureFlags extraFeatures) {
+                VkFormatFeatureFlags extraFeatures, upload_batch *uploads) {
     VkResult U_ASSERT_ONLY res;
     bool U_ASSERT_ONLY pass;
     std::string filename = get_base_data_dir();
@@ -1750,18 +1702,22 @@ void init_image(struct sample_info &info, texture_object &texObj, const char *te
     else
         filename.append(textureName);
 
-    if (!read_ppm(filename.c_str(), texObj.tex_width, texObj.tex_height, 0, NULL)) {
+    /* Parse the file once; it stays mapped until the texels are copied */
+    pnm_image image;
+    if (!open_pnm(filename.c_str(), image)) {
         std::cout << "Try relative path\n";
         filename = "../../API-Samples/data/";
         if (textureName == nullptr)
             filename.append("lunarg.ppm");
         else
             filename.append(textureName);
-        if (!read_ppm(filename.c_str(), texObj.tex_width, texObj.tex_height, 0, NULL)) {
+        if (!open_pnm(filename.c_str(), image)) {
             std::cout << "Could not read texture file " << filename;
             exit(-1);
         }
     }
+    texObj.tex_width = image.width;
+    texObj.tex_height = image.height;
 
     VkFormatProperties formatProps;
     vkGetPhysicalDeviceFormatProperties(info.gpus[0], VK_FORMAT_R8G8B8A8_UNORM, &formatProps);
@@ -1773,10 +1729,17 @@ void init_image(struct sample_info &info, texture_object &texObj, const char *te
 
     if (texObj.needs_staging) {
         assert((formatProps.optimalTilingFeatures & allFeatures) == allFeatures);
-        init_buffer(info, texObj);
+        if (uploads) {
+            texObj.buffer = VK_NULL_HANDLE;
+            texObj.buffer_alloc = memory_allocation();
+            texObj.buffer_memory = VK_NULL_HANDLE;
+        } else {
+            init_buffer(info, texObj);
+        }
         extraUsages |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
     } else {
         texObj.buffer = VK_NULL_HANDLE;
+        texObj.buffer_alloc = memory_allocation();
         texObj.buffer_memory = VK_NULL_HANDLE;
     }
 
@@ -1799,110 +1762,52 @@ void init_image(struct sample_info &info, texture_object &texObj, const char *te
     image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     image_create_info.flags = 0;
 
-    VkMemoryAllocateInfo mem_alloc = {};
-    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_alloc.pNext = NULL;
-    mem_alloc.allocationSize = 0;
-    mem_alloc.memoryTypeIndex = 0;
-
-    VkMemoryRequirements mem_reqs;
-
     res = vkCreateImage(info.device, &image_create_info, NULL, &texObj.image);
     assert(res == VK_SUCCESS);
 
-    vkGetImageMemoryRequirements(info.device, texObj.image, &mem_reqs);
-
-    mem_alloc.allocationSize = mem_reqs.size;
-
+    /* allocate and bind memory */
     VkFlags requirements = texObj.needs_staging ? 0 : (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    pass = memory_type_from_properties(info, mem_reqs.memoryTypeBits, requirements, &mem_alloc.memoryTypeIndex);
+    pass = allocate_image_memory(info, texObj.image, image_create_info.tiling, requirements, texObj.image_alloc);
     assert(pass);
+    texObj.image_memory = VK_NULL_HANDLE;
 
-    /* allocate memory */
-    res = vkAllocateMemory(info.device, &mem_alloc, NULL, &(texObj.image_memory));
-    assert(res == VK_SUCCESS);
-
-    /* bind memory */
-    res = vkBindImageMemory(info.device, texObj.image, texObj.image_memory, 0);
-    assert(res == VK_SUCCESS);
-
-    res = vkEndCommandBuffer(info.cmd);
-    assert(res == VK_SUCCESS);
-    const VkCommandBuffer cmd_bufs[] = {info.cmd};
-    VkFenceCreateInfo fenceInfo;
-    VkFence cmdFence;
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.pNext = NULL;
-    fenceInfo.flags = 0;
-    vkCreateFence(info.device, &fenceInfo, NULL, &cmdFence);
-
-    VkSubmitInfo submit_info[1] = {};
-    submit_info[0].pNext = NULL;
-    submit_info[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info[0].waitSemaphoreCount = 0;
-    submit_info[0].pWaitSemaphores = NULL;
-    submit_info[0].pWaitDstStageMask = NULL;
-    submit_info[0].commandBufferCount = 1;
-    submit_info[0].pCommandBuffers = cmd_bufs;
-    submit_info[0].signalSemaphoreCount = 0;
-    submit_info[0].pSignalSemaphores = NULL;
-
-    /* Queue the command buffer for execution */
-    res = vkQueueSubmit(info.graphics_queue, 1, submit_info, cmdFence);
-    assert(res == VK_SUCCESS);
-
-    VkImageSubresource subres = {};
-    subres.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    subres.mipLevel = 0;
-    subres.arrayLayer = 0;
-
-    VkSubresourceLayout layout = {};
-    void *data;
-    if (!texObj.needs_staging) {
-        /* Get the subresource layout so we know what the row pitch is */
-        vkGetImageSubresourceLayout(info.device, texObj.image, &subres, &layout);
-    }
-
-    /* Make sure command buffer is finished before mapping */
-    do {
-        res = vkWaitForFences(info.device, 1, &cmdFence, VK_TRUE, FENCE_TIMEOUT);
-    } while (res == VK_TIMEOUT);
-    assert(res == VK_SUCCESS);
-
-    vkDestroyFence(info.device, cmdFence, NULL);
-
-    if (texObj.needs_staging) {
-        res = vkMapMemory(info.device, texObj.buffer_memory, 0, texObj.buffer_size, 0, &data);
+    if (texObj.needs_staging && uploads) {
+        /* Convert the ppm file into the batch's staging memory; the copy and
+         * both layout transitions are recorded when the batch is submitted */
+        texObj.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        unsigned char *data = execute_upload_image(*uploads, texObj.image, texObj.tex_width, texObj.tex_height, 4,
+                                                   texObj.imageLayout, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                                   VK_ACCESS_SHADER_READ_BIT);
+        pnm_to_rgba8(image, data, texObj.tex_width * 4);
+        close_pnm(image);
     } else {
-        res = vkMapMemory(info.device, texObj.image_memory, 0, mem_reqs.size, 0, &data);
-    }
-    assert(res == VK_SUCCESS);
-
-    /* Read the ppm file into the mappable image's memory */
-    if (!read_ppm(filename.c_str(), texObj.tex_width, texObj.tex_height,
-                  texObj.needs_staging ? (texObj.tex_width * 4) : layout.rowPitch, (unsigned char *)data)) {
-        std::cout << "Could not load texture file lunarg.ppm\n";
-        exit(-1);
-    }
-
-    vkUnmapMemory(info.device, texObj.needs_staging ? texObj.buffer_memory : texObj.image_memory);
+        VkImageSubresource subres = {};
+        subres.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        subres.mipLevel = 0;
+        subres.arrayLayer = 0;
+
+        VkSubresourceLayout layout = {};
+        if (!texObj.needs_staging) {
+            /* Get the subresource layout so we know what the row pitch is */
+            vkGetImageSubresourceLayout(info.device, texObj.image, &subres, &layout);
+        }
 
-    VkCommandBufferBeginInfo cmd_buf_info = {};
-    cmd_buf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    cmd_buf_info.pNext = NULL;
-    cmd_buf_info.flags = 0;
-    cmd_buf_info.pInheritanceInfo = NULL;
+        /* Both allocations are new, so nothing on the device can be using
+         * them, and the allocator keeps them mapped */
+        void *data = texObj.needs_staging ? texObj.buffer_alloc.mapped : texObj.image_alloc.mapped;
+        assert(data);
 
-    res = vkResetCommandBuffer(info.cmd, 0);
-    res = vkBeginCommandBuffer(info.cmd, &cmd_buf_info);
-    assert(res == VK_SUCCESS);
+        /* Convert the ppm file straight into the mappable image's memory */
+        pnm_to_rgba8(image, (unsigned char *)data, texObj.needs_staging ? (texObj.tex_width * 4) : layout.rowPitch);
+        close_pnm(image);
+    }
 
     if (!texObj.needs_staging) {
         /* If we can use the linear tiled image as a texture, just do it */
         texObj.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         set_image_layout(info, texObj.image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_PREINITIALIZED, texObj.imageLayout,
                          VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-    } else {
+    } else if (!uploads) {
         /* Since we're going to blit to the texture image, set its layout to
          * DESTINATION_OPTIMAL */
         set_image_layout(info, texObj.image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
@@ -1956,11 +1861,11 @@ void init_image(struct sample_info &info, texture_object &texObj, const char *te
 }
 
 void init_texture(struct sample_info &info, const char *textureName, VkImageUsageFlags extraUsages,
-                  VkFormatFeatureFlags extraFeatures) {
+                  VkFormatFeatureFlags extraFeatures, upload_batch *uploads) {
     struct texture_object texObj;
 
     /* create image */
-    init_image(info, texObj, textureName, extraUsages, extraFeatures);
+    init_image(info, texObj, textureName, extraUsages, extraFeatures, uploads);
 
     /* create sampler */
     init_sampler(info, texObj.sampler);
@@ -1973,6 +1878,559 @@ void init_texture(struct sample_info &info, const char *textureName, VkImageUsag
     info.texture_data.image_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 }
 
+void init_upload_batch(struct sample_info &info, upload_batch &batch, VkDeviceSize chunk_size) {
+    VkResult U_ASSERT_ONLY res;
+
+    batch.info = &info;
+    batch.submitted = false;
+    batch.chunk_size = chunk_size;
+    batch.dst_stages = 0;
+
+    /* Images further align their offsets to their texel size */
+    batch.alignment = info.gpu_props.limits.optimalBufferCopyOffsetAlignment;
+    if (batch.alignment < 1) batch.alignment = 1;
+
+    VkCommandPoolCreateInfo cmd_pool_info = {};
+    cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    cmd_pool_info.pNext = NULL;
+    cmd_pool_info.queueFamilyIndex = info.graphics_queue_family_index;
+    cmd_pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    res = vkCreateCommandPool(info.device, &cmd_pool_info, NULL, &batch.cmd_pool);
+    assert(res == VK_SUCCESS);
+
+    VkCommandBufferAllocateInfo cmd = {};
+    cmd.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmd.pNext = NULL;
+    cmd.commandPool = batch.cmd_pool;
+    cmd.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmd.commandBufferCount = 1;
+    res = vkAllocateCommandBuffers(info.device, &cmd, &batch.cmd);
+    assert(res == VK_SUCCESS);
+
+    init_fence(info, batch.fence);
+}
+
+static upload_staging_chunk init_upload_staging_chunk(struct sample_info &info, VkDeviceSize size) {
+    VkResult U_ASSERT_ONLY res;
+    bool U_ASSERT_ONLY pass;
+    upload_staging_chunk chunk = {};
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.pNext = NULL;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buf_info.size = size;
+    buf_info.queueFamilyIndexCount = 0;
+    buf_info.pQueueFamilyIndices = NULL;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buf_info.flags = 0;
+    res = vkCreateBuffer(info.device, &buf_info, NULL, &chunk.buffer);
+    assert(res == VK_SUCCESS);
+
+    pass = allocate_buffer_memory(info, chunk.buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  chunk.alloc);
+    assert(pass && "No mappable, coherent memory");
+
+    /* The allocator keeps host visible memory mapped */
+    chunk.data = (unsigned char *)chunk.alloc.mapped;
+
+    chunk.size = size;
+    chunk.used = 0;
+    return chunk;
+}
+
+static void destroy_upload_staging_chunks(upload_batch &batch) {
+    for (size_t i = 0; i < batch.chunks.size(); i++) {
+        vkDestroyBuffer(batch.info->device, batch.chunks[i].buffer, NULL);
+        free_memory(*batch.info, batch.chunks[i].alloc);
+    }
+    batch.chunks.clear();
+}
+
+static VkDeviceSize get_lcm(VkDeviceSize a, VkDeviceSize b) {
+    VkDeviceSize x = a, y = b;
+    while (y) {
+        const VkDeviceSize r = x % y;
+        x = y;
+        y = r;
+    }
+    return a / x * b;
+}
+
+/* Returns size bytes of mapped staging memory, and the buffer and offset
+ * the device reads them from, a multiple of alignment.  Called with the
+ * batch's mutex held. */
+static unsigned char *execute_reserve_staging(upload_batch &batch, VkDeviceSize size, VkDeviceSize alignment, VkBuffer &buffer,
+                                              VkDeviceSize &offset) {
+    assert(!batch.submitted && "Upload batch was already submitted");
+
+    upload_staging_chunk *chunk = batch.chunks.empty() ? NULL : &batch.chunks.back();
+    VkDeviceSize start = chunk ? (chunk->used + alignment - 1) / alignment * alignment : 0;
+
+    if (!chunk || start + size > chunk->size) {
+        /* Earlier chunks keep their mappings, so pointers already handed out
+         * stay valid */
+        VkDeviceSize chunk_size = size > batch.chunk_size ? size : batch.chunk_size;
+        batch.chunks.push_back(init_upload_staging_chunk(*batch.info, chunk_size));
+        chunk = &batch.chunks.back();
+        start = 0;
+    }
+
+    chunk->used = start + size;
+    buffer = chunk->buffer;
+    offset = start;
+    return chunk->data + start;
+}
+
+unsigned char *execute_upload_image(upload_batch &batch, VkImage image, uint32_t width, uint32_t height, uint32_t texel_size,
+                                    VkImageLayout final_layout, VkPipelineStageFlags dst_stage, VkAccessFlags dst_access) {
+    std::lock_guard<std::mutex> lock(batch.mutex);
+
+    upload_image_copy copy = {};
+    copy.image = image;
+    copy.final_layout = final_layout;
+    copy.dst_access = dst_access;
+
+    /* The offset of an image copy must be a multiple of the texel size and
+     * of 4, and 3-, 6- and 12-byte texels are not powers of two.  Rows are
+     * tightly packed. */
+    const VkDeviceSize alignment = get_lcm(get_lcm(texel_size, 4), batch.alignment);
+    unsigned char *data = execute_reserve_staging(batch, (VkDeviceSize)width * height * texel_size, alignment, copy.src,
+                                                  copy.region.bufferOffset);
+    copy.region.bufferRowLength = width;
+    copy.region.bufferImageHeight = height;
+    copy.region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy.region.imageSubresource.mipLevel = 0;
+    copy.region.imageSubresource.baseArrayLayer = 0;
+    copy.region.imageSubresource.layerCount = 1;
+    copy.region.imageExtent.width = width;
+    copy.region.imageExtent.height = height;
+    copy.region.imageExtent.depth = 1;
+
+    batch.images.push_back(copy);
+    batch.dst_stages |= dst_stage;
+    return data;
+}
+
+unsigned char *execute_upload_buffer(upload_batch &batch, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size,
+                                     VkPipelineStageFlags dst_stage, VkAccessFlags dst_access) {
+    std::lock_guard<std::mutex> lock(batch.mutex);
+
+    upload_buffer_copy copy = {};
+    copy.buffer = buffer;
+    copy.dst_access = dst_access;
+
+    unsigned char *data = execute_reserve_staging(batch, size, batch.alignment, copy.src, copy.region.srcOffset);
+    copy.region.dstOffset = offset;
+    copy.region.size = size;
+
+    batch.buffers.push_back(copy);
+    batch.dst_stages |= dst_stage;
+    return data;
+}
+
+void execute_submit_upload_batch(upload_batch &batch) {
+    VkResult U_ASSERT_ONLY res;
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    assert(!batch.submitted);
+
+    VkCommandBufferBeginInfo cmd_buf_info = {};
+    cmd_buf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmd_buf_info.pNext = NULL;
+    cmd_buf_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    cmd_buf_info.pInheritanceInfo = NULL;
+    res = vkBeginCommandBuffer(batch.cmd, &cmd_buf_info);
+    assert(res == VK_SUCCESS);
+
+    /* One barrier moves every image to TRANSFER_DST, and one after the
+     * copies moves them all to their final layouts */
+    std::vector<VkImageMemoryBarrier> barriers(batch.images.size());
+    for (size_t i = 0; i < batch.images.size(); i++) {
+        VkImageMemoryBarrier &barrier = barriers[i];
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext = NULL;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = batch.images[i].image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+    }
+    if (!barriers.empty()) {
+        vkCmdPipelineBarrier(batch.cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL,
+                             (uint32_t)barriers.size(), barriers.data());
+    }
+
+    for (size_t i = 0; i < batch.images.size(); i++) {
+        const upload_image_copy &copy = batch.images[i];
+        vkCmdCopyBufferToImage(batch.cmd, copy.src, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy.region);
+
+        barriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[i].dstAccessMask = copy.dst_access;
+        barriers[i].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[i].newLayout = copy.final_layout;
+    }
+
+    std::vector<VkBufferMemoryBarrier> buffer_barriers(batch.buffers.size());
+    for (size_t i = 0; i < batch.buffers.size(); i++) {
+        const upload_buffer_copy &copy = batch.buffers[i];
+        vkCmdCopyBuffer(batch.cmd, copy.src, copy.buffer, 1, &copy.region);
+
+        VkBufferMemoryBarrier &barrier = buffer_barriers[i];
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext = NULL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = copy.dst_access;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = copy.buffer;
+        barrier.offset = copy.region.dstOffset;
+        barrier.size = copy.region.size;
+    }
+
+    if (!barriers.empty() || !buffer_barriers.empty()) {
+        vkCmdPipelineBarrier(batch.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             batch.dst_stages ? batch.dst_stages : (VkPipelineStageFlags)VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, NULL,
+                             (uint32_t)buffer_barriers.size(), buffer_barriers.data(), (uint32_t)barriers.size(),
+                             barriers.data());
+    }
+
+    res = vkEndCommandBuffer(batch.cmd);
+    assert(res == VK_SUCCESS);
+
+    /* Submission makes the host writes to the staging memory visible */
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.pNext = NULL;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &batch.cmd;
+    res = vkQueueSubmit(batch.info->graphics_queue, 1, &submit_info, batch.fence);
+    assert(res == VK_SUCCESS);
+
+    batch.submitted = true;
+}
+
+/* Returns true once the batch's copies have completed */
+bool execute_poll_upload_batch(upload_batch &batch) {
+    return batch.submitted && vkGetFenceStatus(batch.info->device, batch.fence) == VK_SUCCESS;
+}
+
+/* Waits for the batch and reopens it for more uploads.  The staging memory
+ * is kept, merged into a single chunk if the batch outgrew the first one. */
+void execute_wait_upload_batch(upload_batch &batch) {
+    VkResult U_ASSERT_ONLY res;
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    if (!batch.submitted) return;
+
+    do {
+        res = vkWaitForFences(batch.info->device, 1, &batch.fence, VK_TRUE, FENCE_TIMEOUT);
+    } while (res == VK_TIMEOUT);
+    assert(res == VK_SUCCESS);
+
+    res = vkResetFences(batch.info->device, 1, &batch.fence);
+    assert(res == VK_SUCCESS);
+    res = vkResetCommandPool(batch.info->device, batch.cmd_pool, 0);
+    assert(res == VK_SUCCESS);
+
+    if (batch.chunks.size() > 1) {
+        VkDeviceSize total = 0;
+        for (size_t i = 0; i < batch.chunks.size(); i++) total += batch.chunks[i].size;
+        destroy_upload_staging_chunks(batch);
+        batch.chunk_size = total;
+    } else if (!batch.chunks.empty()) {
+        batch.chunks[0].used = 0;
+    }
+
+    batch.images.clear();
+    batch.buffers.clear();
+    batch.dst_stages = 0;
+    batch.submitted = false;
+}
+
+void destroy_upload_batch(upload_batch &batch) {
+    execute_wait_upload_batch(batch);
+
+    destroy_upload_staging_chunks(batch);
+    vkDestroyFence(batch.info->device, batch.fence, NULL);
+    vkDestroyCommandPool(batch.info->device, batch.cmd_pool, NULL);
+}
+
+static void init_frame_loop_image_sync(frame_loop &loop) {
+    struct sample_info &info = *loop.info;
+    VkResult U_ASSERT_ONLY res;
+
+    VkSemaphoreCreateInfo sem_info = {};
+    sem_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    sem_info.pNext = NULL;
+    sem_info.flags = 0;
+
+    loop.render_done.resize(info.swapchainImageCount);
+    for (uint32_t i = 0; i < info.swapchainImageCount; i++) {
+        res = vkCreateSemaphore(info.device, &sem_info, NULL, &loop.render_done[i]);
+        assert(res == VK_SUCCESS);
+    }
+    loop.image_fences.assign(info.swapchainImageCount, VK_NULL_HANDLE);
+}
+
+static void destroy_frame_loop_image_sync(frame_loop &loop) {
+    for (size_t i = 0; i < loop.render_done.size(); i++) {
+        vkDestroySemaphore(loop.info->device, loop.render_done[i], NULL);
+    }
+    loop.render_done.clear();
+    loop.image_fences.clear();
+}
+
+/* Returns false if the window has no area to render to */
+static bool execute_recreate_swap_chain(frame_loop &loop) {
+    struct sample_info &info = *loop.info;
+    VkResult U_ASSERT_ONLY res;
+
+    /* Resizing is rare, so simply let everything in flight finish */
+    vkDeviceWaitIdle(info.device);
+
+    VkSurfaceCapabilitiesKHR surfCapabilities;
+    res = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(info.gpus[0], info.surface, &surfCapabilities);
+    assert(res == VK_SUCCESS);
+    if (surfCapabilities.currentExtent.width == 0 || surfCapabilities.currentExtent.height == 0) return false;
+    if (surfCapabilities.currentExtent.width != 0xFFFFFFFF) {
+        info.width = surfCapabilities.currentExtent.width;
+        info.height = surfCapabilities.currentExtent.height;
+    }
+
+    destroy_frame_loop_image_sync(loop);
+    destroy_framebuffers(info);
+    destroy_swap_chain(info);
+    info.buffers.clear();
+
+    init_swap_chain(info);
+    if (loop.include_depth) {
+        destroy_depth_buffer(info);
+        init_depth_buffer(info);
+    }
+    init_framebuffers(info, loop.include_depth);
+    init_frame_loop_image_sync(loop);
+
+    loop.swap_chain_recreations++;
+    return true;
+}
+
+void init_frame_loop(struct sample_info &info, frame_loop &loop, frame_loop_record record, void *user_data, bool include_depth,
+                     uint32_t frames_in_flight) {
+    /* DEPENDS on init_swap_chain(), init_renderpass() and init_framebuffers() */
+    VkResult U_ASSERT_ONLY res;
+
+    loop.info = &info;
+    loop.record = record;
+    loop.user_data = user_data;
+    loop.include_depth = include_depth;
+    loop.frame_index = 0;
+    loop.frames_presented = 0;
+    loop.swap_chain_recreations = 0;
+    loop.capture = NULL;
+
+    VkCommandPoolCreateInfo cmd_pool_info = {};
+    cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    cmd_pool_info.pNext = NULL;
+    cmd_pool_info.queueFamilyIndex = info.graphics_queue_family_index;
+    cmd_pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+    /* Signaled, so the first wait on each frame returns at once */
+    VkFenceCreateInfo fence_info = {};
+    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fence_info.pNext = NULL;
+    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+    VkSemaphoreCreateInfo sem_info = {};
+    sem_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    sem_info.pNext = NULL;
+    sem_info.flags = 0;
+
+    loop.frames.resize(frames_in_flight ? frames_in_flight : 1);
+    for (size_t i = 0; i < loop.frames.size(); i++) {
+        frame_loop_frame &frame = loop.frames[i];
+
+        res = vkCreateCommandPool(info.device, &cmd_pool_info, NULL, &frame.cmd_pool);
+        assert(res == VK_SUCCESS);
+
+        VkCommandBufferAllocateInfo cmd = {};
+        cmd.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmd.pNext = NULL;
+        cmd.commandPool = frame.cmd_pool;
+        cmd.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmd.commandBufferCount = 1;
+        res = vkAllocateCommandBuffers(info.device, &cmd, &frame.cmd);
+        assert(res == VK_SUCCESS);
+
+        res = vkCreateFence(info.device, &fence_info, NULL, &frame.fence);
+        assert(res == VK_SUCCESS);
+        res = vkCreateSemaphore(info.device, &sem_info, NULL, &frame.image_acquired);
+        assert(res == VK_SUCCESS);
+    }
+
+    init_frame_loop_image_sync(loop);
+}
+
+void init_frame_loop_capture(frame_loop &loop, const char *basename) {
+    /* A slot per frame, collected when the frame comes around again */
+    loop.capture = new readback;
+    init_readback(*loop.info, *loop.capture, (uint32_t)loop.frames.size());
+    loop.capture_basename = basename;
+}
+
+static void execute_wait_fence(struct sample_info &info, VkFence fence) {
+    VkResult U_ASSERT_ONLY res;
+    do {
+        res = vkWaitForFences(info.device, 1, &fence, VK_TRUE, FENCE_TIMEOUT);
+    } while (res == VK_TIMEOUT);
+    assert(res == VK_SUCCESS);
+}
+
+/* Returns false when the window stayed without an area for FRAME_LOOP_TIMEOUT,
+ * and the loop cannot go on */
+bool execute_frame_loop_frame(frame_loop &loop) {
+    struct sample_info &info = *loop.info;
+    frame_loop_frame &frame = loop.frames[loop.frame_index];
+    VkResult U_ASSERT_ONLY res;
+
+    /* Only waits when every frame is in flight */
+    execute_wait_fence(info, frame.fence);
+    if (loop.capture) execute_readback_collect(*loop.capture, loop.frame_index);
+
+    /* Nothing is signaled when the swap chain is out of date, so acquire
+     * again from the new one.  A minimized window has no area to render to,
+     * so poll until it is restored, for a while. */
+    uint32_t image_index;
+    uint32_t waited_ms = 0;
+    while ((res = vkAcquireNextImageKHR(info.device, info.swap_chain, UINT64_MAX, frame.image_acquired, VK_NULL_HANDLE,
+                                        &image_index)) == VK_ERROR_OUT_OF_DATE_KHR) {
+        while (!execute_recreate_swap_chain(loop)) {
+            if (waited_ms >= FRAME_LOOP_TIMEOUT) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            waited_ms += 10;
+        }
+    }
+    /* A suboptimal image can still be presented, the swap chain is
+     * recreated after that */
+    const bool suboptimal = (res == VK_SUBOPTIMAL_KHR);
+    assert(res == VK_SUCCESS || suboptimal);
+
+    /* With more images than frames, the image may still be in use by another
+     * frame */
+    if (loop.image_fences[image_index] != VK_NULL_HANDLE && loop.image_fences[image_index] != frame.fence) {
+        execute_wait_fence(info, loop.image_fences[image_index]);
+    }
+    loop.image_fences[image_index] = frame.fence;
+
+    res = vkResetFences(info.device, 1, &frame.fence);
+    assert(res == VK_SUCCESS);
+    res = vkResetCommandPool(info.device, frame.cmd_pool, 0);
+    assert(res == VK_SUCCESS);
+
+    VkCommandBufferBeginInfo cmd_buf_info = {};
+    cmd_buf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmd_buf_info.pNext = NULL;
+    cmd_buf_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    cmd_buf_info.pInheritanceInfo = NULL;
+    res = vkBeginCommandBuffer(frame.cmd, &cmd_buf_info);
+    assert(res == VK_SUCCESS);
+
+    /* Let the record function use the helpers that record into info.cmd */
+    VkCommandBuffer cmd = info.cmd;
+    info.cmd = frame.cmd;
+    info.current_buffer = image_index;
+    loop.record(info, loop.frame_index, loop.user_data);
+    info.cmd = cmd;
+
+    if (loop.capture) {
+        char suffix[32];
+        snprintf(suffix, sizeof(suffix), "_%05llu.ppm", (unsigned long long)loop.frames_presented);
+        execute_readback_copy(*loop.capture, loop.frame_index, frame.cmd, info.buffers[image_index].image,
+                              (loop.capture_basename + suffix).c_str());
+    }
+
+    res = vkEndCommandBuffer(frame.cmd);
+    assert(res == VK_SUCCESS);
+
+    VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.pNext = NULL;
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &frame.image_acquired;
+    submit_info.pWaitDstStageMask = &pipe_stage_flags;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &frame.cmd;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &loop.render_done[image_index];
+    res = vkQueueSubmit(info.graphics_queue, 1, &submit_info, frame.fence);
+    assert(res == VK_SUCCESS);
+
+    VkPresentInfoKHR present;
+    init_present_info(info, present);
+    present.pImageIndices = &image_index;
+    present.waitSemaphoreCount = 1;
+    present.pWaitSemaphores = &loop.render_done[image_index];
+    res = vkQueuePresentKHR(info.present_queue, &present);
+
+    loop.frame_index = (loop.frame_index + 1) % loop.frames.size();
+    loop.frames_presented++;
+
+    if (res == VK_ERROR_OUT_OF_DATE_KHR || res == VK_SUBOPTIMAL_KHR || suboptimal) {
+        execute_recreate_swap_chain(loop);
+    } else {
+        assert(res == VK_SUCCESS);
+    }
+
+    return true;
+}
+
+/* Returns the frames per second; stops early if a frame cannot be presented */
+double execute_frame_loop(frame_loop &loop, uint32_t frame_count) {
+    const uint64_t begin = loop.frames_presented;
+    const uint64_t end = begin + frame_count;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    while (loop.frames_presented < end) {
+        if (!execute_frame_loop_frame(loop)) break;
+    }
+
+    /* Count the time the last frames take to finish, too */
+    vkDeviceWaitIdle(loop.info->device);
+
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    return seconds.count() > 0.0 ? (loop.frames_presented - begin) / seconds.count() : 0.0;
+}
+
+void destroy_frame_loop(frame_loop &loop) {
+    struct sample_info &info = *loop.info;
+
+    /* Presents are not covered by the fences */
+    vkDeviceWaitIdle(info.device);
+
+    if (loop.capture) {
+        for (uint32_t i = 0; i < loop.capture->slots.size(); i++) execute_readback_collect(*loop.capture, i);
+        destroy_readback(*loop.capture);
+        delete loop.capture;
+        loop.capture = NULL;
+    }
+
+    for (size_t i = 0; i < loop.frames.size(); i++) {
+        frame_loop_frame &frame = loop.frames[i];
+        vkDestroySemaphore(info.device, frame.image_acquired, NULL);
+        vkDestroyFence(info.device, frame.fence, NULL);
+        vkDestroyCommandPool(info.device, frame.cmd_pool, NULL);
+    }
+    loop.frames.clear();
+
+    destroy_frame_loop_image_sync(loop);
+}
+
 void init_viewports(struct sample_info &info) {
 #ifdef __ANDROID__
 // Disable dynamic viewport on Android. Some drive has an issue with the dynamic viewport
@@ -2060,7 +2518,7 @@ void destroy_pipeline_cache(struct sample_info &info) { vkDestroyPipelineCache(i
 
 void destroy_uniform_buffer(struct sample_info &info) {
     vkDestroyBuffer(info.device, info.uniform_data.buf, NULL);
-    vkFreeMemory(info.device, info.uniform_data.mem, NULL);
+    free_memory(info, info.uniform_data.alloc);
 }
 
 void destroy_descriptor_and_pipeline_layouts(struct sample_info &info) {
@@ -2085,12 +2543,12 @@ void destroy_command_pool(struct sample_info &info) { vkDestroyCommandPool(info.
 void destroy_depth_buffer(struct sample_info &info) {
     vkDestroyImageView(info.device, info.depth.view, NULL);
     vkDestroyImage(info.device, info.depth.image, NULL);
-    vkFreeMemory(info.device, info.depth.mem, NULL);
+    free_memory(info, info.depth.alloc);
 }
 
 void destroy_vertex_buffer(struct sample_info &info) {
     vkDestroyBuffer(info.device, info.vertex_buffer.buf, NULL);
-    vkFreeMemory(info.device, info.vertex_buffer.mem, NULL);
+    free_memory(info, info.vertex_buffer.alloc);
 }
 
 void destroy_swap_chain(struct sample_info &info) {
@@ -2111,6 +2569,7 @@ void destroy_renderpass(struct sample_info &info) { vkDestroyRenderPass(info.dev
 
 void destroy_device(struct sample_info &info) {
     vkDeviceWaitIdle(info.device);
+    destroy_memory_allocator(info);
     vkDestroyDevice(info.device, NULL);
 }
 
@@ -2121,8 +2580,8 @@ void destroy_textures(struct sample_info &info) {
         vkDestroySampler(info.device, info.textures[i].sampler, NULL);
         vkDestroyImageView(info.device, info.textures[i].view, NULL);
         vkDestroyImage(info.device, info.textures[i].image, NULL);
-        vkFreeMemory(info.device, info.textures[i].image_memory, NULL);
+        free_memory(info, info.textures[i].image_alloc);
         vkDestroyBuffer(info.device, info.textures[i].buffer, NULL);
-        vkFreeMemory(info.device, info.textures[i].buffer_memory, NULL);
+        free_memory(info, info.textures[i].buffer_alloc);
     }
 }
@@ -22,6 +22,13 @@
 #define UTIL_INIT
 
 #include "util.hpp"
+#include "util_memory.hpp"
+#include "util_bench.hpp"
+#include "util_pipeline_cache.hpp"
+#include "util_readback.hpp"
+#include "util_spirv.hpp"
+#include "util_variant_cache.hpp"
+#include "util_query.hpp"
 
 // Make sure functions start with init, execute, or destroy to assist codegen
 
@@ -78,13 +85,43 @@ void init_shaders(struct sample_info &info, const VkShaderModuleCreateInfo *vert
 void init_pipeline_cache(struct sample_info &info);
 void init_pipeline(struct sample_info &info, VkBool32 include_depth,
                    VkBool32 include_vi = true);
+void init_pipeline_desc(pipeline_desc &desc, VkBool32 include_depth, VkBool32 include_vi = true);
+// Safe to call from several threads at once, as long as none of them changes
+// what it reads from info: the device, vertex input and pipeline layout, and
+// the stages, extent and render pass that desc leaves to info
+VkResult init_pipeline(struct sample_info &info, VkPipelineCache cache, const pipeline_desc &desc, VkPipeline &pipeline);
 void init_sampler(struct sample_info &info, VkSampler &sampler);
 void init_image(struct sample_info &info, texture_object &texObj,
                 const char *textureName, VkImageUsageFlags extraUsages = 0,
-                VkFormatFeatureFlags extraFeatures = 0);
+                VkFormatFeatureFlags extraFeatures = 0,
+                upload_batch *uploads = nullptr);
 void init_texture(struct sample_info &info, const char *textureName = nullptr,
                   VkImageUsageFlags extraUsages = 0,
-                  VkFormatFeatureFlags extraFeatures = 0);
+                  VkFormatFeatureFlags extraFeatures = 0,
+                  upload_batch *uploads = nullptr);
+void init_upload_batch(struct sample_info &info, upload_batch &batch,
+                       VkDeviceSize chunk_size = 4 * 1024 * 1024);
+unsigned char *execute_upload_image(upload_batch &batch, VkImage image,
+                                    uint32_t width, uint32_t height,
+                                    uint32_t texel_size,
+                                    VkImageLayout final_layout,
+                                    VkPipelineStageFlags dst_stage,
+                                    VkAccessFlags dst_access);
+unsigned char *execute_upload_buffer(upload_batch &batch, VkBuffer buffer,
+                                     VkDeviceSize offset, VkDeviceSize size,
+                                     VkPipelineStageFlags dst_stage,
+                                     VkAccessFlags dst_access);
+void execute_submit_upload_batch(upload_batch &batch);
+bool execute_poll_upload_batch(upload_batch &batch);
+void execute_wait_upload_batch(upload_batch &batch);
+void destroy_upload_batch(upload_batch &batch);
+void init_frame_loop(struct sample_info &info, frame_loop &loop,
+                     frame_loop_record record, void *user_data,
+                     bool include_depth, uint32_t frames_in_flight = 2);
+void init_frame_loop_capture(frame_loop &loop, const char *basename);
+bool execute_frame_loop_frame(frame_loop &loop);
+double execute_frame_loop(frame_loop &loop, uint32_t frame_count);
+void destroy_frame_loop(frame_loop &loop);
 void init_viewports(struct sample_info &info);
 void init_scissors(struct sample_info &info);
 void init_fence(struct sample_info &info, VkFence &fence);
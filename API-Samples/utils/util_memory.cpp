@@ -0,0 +1,266 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include "util_buddy.hpp"
+#include <assert.h>
+#include <stdio.h>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/* The memory behind a block of a buddy_pool */
+struct memory_block {
+    VkDeviceMemory memory;
+    unsigned char *mapped;
+};
+
+/* The blocks of one memory type, for either optimal images or everything else */
+struct memory_pool {
+    uint32_t type_index;
+    buddy_pool buddy;
+    /* indexed like buddy.blocks */
+    std::vector<memory_block> blocks;
+};
+
+}  // namespace
+
+struct memory_allocator {
+    std::mutex mutex;
+    VkDeviceSize block_size;
+    /* indexed by memory type * 2 + optimal_image */
+    memory_pool pools[VK_MAX_MEMORY_TYPES * 2];
+    memory_stats stats;
+};
+
+void init_memory_allocator(struct sample_info &info, VkDeviceSize block_size) {
+    assert(!info.allocator);
+    memory_allocator *allocator = new memory_allocator();
+    allocator->block_size = block_size;
+
+    for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES * 2; i++) {
+        memory_pool &pool = allocator->pools[i];
+        pool.type_index = i / 2;
+
+        VkDeviceSize heap_size = block_size * 8;
+        if (pool.type_index < info.memory_properties.memoryTypeCount) {
+            const uint32_t heap = info.memory_properties.memoryTypes[pool.type_index].heapIndex;
+            heap_size = info.memory_properties.memoryHeaps[heap].size;
+        }
+        init_buddy_pool(pool.buddy, block_size, heap_size);
+    }
+
+    info.allocator = allocator;
+}
+
+static void destroy_memory_block(struct sample_info &info, memory_block &block) {
+    /* Freeing mapped memory implicitly unmaps it */
+    vkFreeMemory(info.device, block.memory, NULL);
+    block.memory = VK_NULL_HANDLE;
+    block.mapped = NULL;
+}
+
+void destroy_memory_allocator(struct sample_info &info) {
+    memory_allocator *allocator = info.allocator;
+    if (!allocator) return;
+
+    if (allocator->stats.allocation_count) {
+        printf("%u device memory allocations were not freed\n", allocator->stats.allocation_count);
+    }
+
+    for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES * 2; i++) {
+        std::vector<memory_block> &blocks = allocator->pools[i].blocks;
+        for (size_t b = 0; b < blocks.size(); b++) {
+            if (blocks[b].memory) destroy_memory_block(info, blocks[b]);
+        }
+    }
+
+    delete allocator;
+    info.allocator = NULL;
+}
+
+static VkResult allocate_device_memory(struct sample_info &info, uint32_t type_index, VkDeviceSize size, VkDeviceMemory &memory,
+                                       unsigned char *&mapped) {
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.pNext = NULL;
+    alloc_info.allocationSize = size;
+    alloc_info.memoryTypeIndex = type_index;
+
+    VkResult res = vkAllocateMemory(info.device, &alloc_info, NULL, &memory);
+    if (res != VK_SUCCESS) return res;
+
+    mapped = NULL;
+    if (info.memory_properties.memoryTypes[type_index].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        res = vkMapMemory(info.device, memory, 0, VK_WHOLE_SIZE, 0, (void **)&mapped);
+        if (res != VK_SUCCESS) {
+            vkFreeMemory(info.device, memory, NULL);
+            memory = VK_NULL_HANDLE;
+        }
+    }
+
+    return res;
+}
+
+bool allocate_memory(struct sample_info &info, const VkMemoryRequirements &reqs, VkFlags requirements_mask, bool optimal_image,
+                     memory_allocation &alloc) {
+    uint32_t type_index;
+    if (!memory_type_from_properties(info, reqs.memoryTypeBits, requirements_mask, &type_index)) return false;
+
+    if (!info.allocator) init_memory_allocator(info);
+    memory_allocator *allocator = info.allocator;
+    std::lock_guard<std::mutex> lock(allocator->mutex);
+
+    /* Linear and optimal resources only need separating when
+     * bufferImageGranularity is more than a byte */
+    const bool separate = optimal_image && info.gpu_props.limits.bufferImageGranularity > 1;
+    const uint32_t pool_index = type_index * 2 + (separate ? 1 : 0);
+    memory_pool &pool = allocator->pools[pool_index];
+    const uint32_t order = get_buddy_order(reqs.size > reqs.alignment ? reqs.size : reqs.alignment);
+
+    if (order < pool.buddy.order) {
+        uint32_t b;
+        uint64_t offset;
+        bool found = execute_buddy_allocate(pool.buddy, order, b, offset);
+
+        if (!found) {
+            memory_block block;
+            const VkDeviceSize block_size = (VkDeviceSize)1 << pool.buddy.order;
+            if (allocate_device_memory(info, type_index, block_size, block.memory, block.mapped) == VK_SUCCESS) {
+                b = execute_buddy_add_block(pool.buddy);
+                pool.blocks.resize(pool.buddy.blocks.size());
+                pool.blocks[b] = block;
+
+                found = execute_buddy_allocate(pool.buddy, order, b, offset);
+                assert(found);
+                allocator->stats.block_count++;
+                allocator->stats.block_bytes += block_size;
+            }
+        }
+
+        if (found) {
+            const memory_block &block = pool.blocks[b];
+            alloc.memory = block.memory;
+            alloc.offset = offset;
+            alloc.size = reqs.size;
+            alloc.mapped = block.mapped ? block.mapped + offset : NULL;
+            alloc.pool = pool_index;
+            alloc.block = b;
+            alloc.order = order;
+
+            allocator->stats.allocation_count++;
+            allocator->stats.used_bytes += reqs.size;
+            allocator->stats.wasted_bytes += ((VkDeviceSize)1 << order) - reqs.size;
+            return true;
+        }
+
+        /* The heap may be too full for another block, but not for this */
+    }
+
+    unsigned char *mapped;
+    if (allocate_device_memory(info, type_index, reqs.size, alloc.memory, mapped) != VK_SUCCESS) return false;
+
+    alloc.offset = 0;
+    alloc.size = reqs.size;
+    alloc.mapped = mapped;
+    alloc.pool = DEDICATED_POOL;
+    alloc.block = 0;
+    alloc.order = 0;
+
+    allocator->stats.dedicated_count++;
+    allocator->stats.dedicated_bytes += reqs.size;
+    allocator->stats.allocation_count++;
+    allocator->stats.used_bytes += reqs.size;
+    return true;
+}
+
+void free_memory(struct sample_info &info, memory_allocation &alloc) {
+    if (!alloc.memory) return;
+
+    memory_allocator *allocator = info.allocator;
+    assert(allocator);
+    std::lock_guard<std::mutex> lock(allocator->mutex);
+
+    allocator->stats.allocation_count--;
+    allocator->stats.used_bytes -= alloc.size;
+
+    if (alloc.pool == DEDICATED_POOL) {
+        vkFreeMemory(info.device, alloc.memory, NULL);
+        allocator->stats.dedicated_count--;
+        allocator->stats.dedicated_bytes -= alloc.size;
+    } else {
+        memory_pool &pool = allocator->pools[alloc.pool];
+        memory_block &block = pool.blocks[alloc.block];
+        assert(block.memory == alloc.memory);
+
+        allocator->stats.wasted_bytes -= ((VkDeviceSize)1 << alloc.order) - alloc.size;
+        if (execute_buddy_free(pool.buddy, alloc.block, alloc.order, alloc.offset)) {
+            destroy_memory_block(info, block);
+            allocator->stats.block_count--;
+            allocator->stats.block_bytes -= (VkDeviceSize)1 << pool.buddy.order;
+        }
+    }
+
+    alloc.memory = VK_NULL_HANDLE;
+    alloc.mapped = NULL;
+}
+
+bool allocate_buffer_memory(struct sample_info &info, VkBuffer buffer, VkFlags requirements_mask, memory_allocation &alloc) {
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(info.device, buffer, &mem_reqs);
+
+    if (!allocate_memory(info, mem_reqs, requirements_mask, false, alloc)) return false;
+
+    VkResult U_ASSERT_ONLY res = vkBindBufferMemory(info.device, buffer, alloc.memory, alloc.offset);
+    assert(res == VK_SUCCESS);
+    return true;
+}
+
+bool allocate_image_memory(struct sample_info &info, VkImage image, VkImageTiling tiling, VkFlags requirements_mask,
+                           memory_allocation &alloc) {
+    VkMemoryRequirements mem_reqs;
+    vkGetImageMemoryRequirements(info.device, image, &mem_reqs);
+
+    if (!allocate_memory(info, mem_reqs, requirements_mask, tiling == VK_IMAGE_TILING_OPTIMAL, alloc)) return false;
+
+    VkResult U_ASSERT_ONLY res = vkBindImageMemory(info.device, image, alloc.memory, alloc.offset);
+    assert(res == VK_SUCCESS);
+    return true;
+}
+
+void get_memory_stats(struct sample_info &info, memory_stats &stats) {
+    if (!info.allocator) {
+        stats = memory_stats();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(info.allocator->mutex);
+    stats = info.allocator->stats;
+}
+
+void print_memory_stats(struct sample_info &info) {
+    memory_stats stats;
+    get_memory_stats(info, stats);
+
+    printf("Device memory: %u allocations in %u blocks (%llu KB) and %u dedicated allocations (%llu KB)\n",
+           stats.allocation_count, stats.block_count, (unsigned long long)(stats.block_bytes / 1024), stats.dedicated_count,
+           (unsigned long long)(stats.dedicated_bytes / 1024));
+    printf("  used %llu KB, %llu KB lost to rounding\n", (unsigned long long)(stats.used_bytes / 1024),
+           (unsigned long long)(stats.wasted_bytes / 1024));
+}
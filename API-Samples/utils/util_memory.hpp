@@ -0,0 +1,78 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_MEMORY_HPP
+#define UTIL_MEMORY_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+/*
+ * Device memory suballocator for the sample utilities.
+ *
+ * Memory is allocated from the driver in large blocks, one list of blocks per
+ * memory type, and handed out with a buddy allocator: requests are rounded
+ * up to a power of two of at least 256 bytes, which also satisfies their
+ * alignment.  Unless bufferImageGranularity is 1, buffers and linear images
+ * never share a block with optimal images, so it never has to be padded for.
+ * Requests larger than half a block, or that fail to get a new block, get a
+ * dedicated allocation of their own.
+ *
+ * Blocks of host visible memory are mapped once when they are created, so
+ * resources in them must be written through memory_allocation::mapped rather
+ * than vkMapMemory.
+ *
+ * The allocator is created by init_device, or by the first allocation, and
+ * destroyed by destroy_device.  All functions may be called from several
+ * threads at once.
+ */
+
+/* memory_allocation::pool of a dedicated allocation, which has no block */
+#define DEDICATED_POOL (~0u)
+
+struct memory_stats {
+    uint32_t block_count;
+    uint32_t dedicated_count;
+    uint32_t allocation_count;
+
+    /* allocated from the driver */
+    VkDeviceSize block_bytes;
+    VkDeviceSize dedicated_bytes;
+    /* as requested by the resources */
+    VkDeviceSize used_bytes;
+    /* lost to rounding up to powers of two */
+    VkDeviceSize wasted_bytes;
+};
+
+void init_memory_allocator(struct sample_info &info, VkDeviceSize block_size = 64 * 1024 * 1024);
+void destroy_memory_allocator(struct sample_info &info);
+
+/* Returns false if no memory type in reqs.memoryTypeBits has all of
+ * requirements_mask, or if the memory could not be allocated. */
+bool allocate_memory(struct sample_info &info, const VkMemoryRequirements &reqs, VkFlags requirements_mask, bool optimal_image,
+                     memory_allocation &alloc);
+void free_memory(struct sample_info &info, memory_allocation &alloc);
+
+/* Allocate memory for the resource and bind it */
+bool allocate_buffer_memory(struct sample_info &info, VkBuffer buffer, VkFlags requirements_mask, memory_allocation &alloc);
+bool allocate_image_memory(struct sample_info &info, VkImage image, VkImageTiling tiling, VkFlags requirements_mask,
+                           memory_allocation &alloc);
+
+void get_memory_stats(struct sample_info &info, memory_stats &stats);
+void print_memory_stats(struct sample_info &info);
+
+#endif  // UTIL_MEMORY_HPP
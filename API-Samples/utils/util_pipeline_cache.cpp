@@ -0,0 +1,173 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include "util_pipeline_cache_file.hpp"
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+std::string get_pipeline_cache_path(struct sample_info &info, const char *name) {
+    return get_pipeline_cache_file_path(get_file_directory() + name, info.gpu_props);
+}
+
+bool validate_pipeline_cache_data(struct sample_info &info, const void *data, size_t size, const char *source) {
+    pipeline_cache_header header;
+    if (!read_pipeline_cache_header(data, size, header)) {
+        printf("  %s is too short for a pipeline cache header.\n", source);
+        return false;
+    }
+
+    /* report every bad field, not just the first */
+    const uint32_t errors = get_pipeline_cache_header_errors(header, size, info.gpu_props);
+
+    if (errors & PIPELINE_CACHE_BAD_LENGTH) {
+        printf("  Bad header length in %s.\n", source);
+        printf("    Cache contains: 0x%.8x\n", header.length);
+    }
+
+    if (errors & PIPELINE_CACHE_BAD_VERSION) {
+        printf("  Unsupported cache header version in %s.\n", source);
+        printf("    Cache contains: 0x%.8x\n", header.version);
+    }
+
+    if (errors & PIPELINE_CACHE_BAD_VENDOR_ID) {
+        printf("  Vendor ID mismatch in %s.\n", source);
+        printf("    Cache contains: 0x%.8x\n", header.vendor_id);
+        printf("    Driver expects: 0x%.8x\n", info.gpu_props.vendorID);
+    }
+
+    if (errors & PIPELINE_CACHE_BAD_DEVICE_ID) {
+        printf("  Device ID mismatch in %s.\n", source);
+        printf("    Cache contains: 0x%.8x\n", header.device_id);
+        printf("    Driver expects: 0x%.8x\n", info.gpu_props.deviceID);
+    }
+
+    if (errors & PIPELINE_CACHE_BAD_UUID) {
+        printf("  UUID mismatch in %s.\n", source);
+        printf("    Cache contains: ");
+        print_UUID(header.uuid);
+        printf("\n");
+        printf("    Driver expects: ");
+        print_UUID(info.gpu_props.pipelineCacheUUID);
+        printf("\n");
+    }
+
+    return errors == 0;
+}
+
+bool load_pipeline_cache_data(struct sample_info &info, const char *name, std::vector<uint8_t> &data) {
+    const std::string path = get_pipeline_cache_path(info, name);
+    if (!read_pipeline_cache_file(path, data)) return false;
+
+    /* a bad file is left for the next save to replace */
+    if (!validate_pipeline_cache_data(info, data.data(), data.size(), path.c_str())) {
+        data.clear();
+        return false;
+    }
+
+    return true;
+}
+
+VkResult load_pipeline_cache(struct sample_info &info, const char *name, VkPipelineCache &cache, bool *loaded) {
+    std::vector<uint8_t> data;
+    const bool valid = load_pipeline_cache_data(info, name, data);
+    if (loaded) *loaded = valid;
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.initialDataSize = data.size();
+    cache_info.pInitialData = data.empty() ? NULL : data.data();
+    return vkCreatePipelineCache(info.device, &cache_info, NULL, &cache);
+}
+
+bool save_pipeline_cache(struct sample_info &info, const char *name, VkPipelineCache cache) {
+    size_t size = 0;
+    if (vkGetPipelineCacheData(info.device, cache, &size, NULL) != VK_SUCCESS) return false;
+
+    std::vector<uint8_t> data(size);
+    if (vkGetPipelineCacheData(info.device, cache, &size, data.data()) != VK_SUCCESS) return false;
+
+    return write_pipeline_cache_file(get_pipeline_cache_path(info, name), data.data(), size);
+}
+
+VkResult merge_pipeline_caches(struct sample_info &info, VkPipelineCache dst, const std::vector<VkPipelineCache> &srcs) {
+    if (srcs.empty()) return VK_SUCCESS;
+    return vkMergePipelineCaches(info.device, dst, (uint32_t)srcs.size(), srcs.data());
+}
+
+VkResult warm_up_pipelines(struct sample_info &info, VkPipelineCache cache, const std::vector<pipeline_desc> &descs,
+                           std::vector<VkPipeline> &pipelines, uint32_t thread_count) {
+    pipelines.assign(descs.size(), VK_NULL_HANDLE);
+    if (descs.empty()) return VK_SUCCESS;
+
+    if (!thread_count) thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    thread_count = (uint32_t)std::min<size_t>(thread_count, descs.size());
+
+    VkResult res;
+    size_t seed_size = 0;
+    res = vkGetPipelineCacheData(info.device, cache, &seed_size, NULL);
+    if (res != VK_SUCCESS) return res;
+    std::vector<uint8_t> seed(seed_size);
+    res = vkGetPipelineCacheData(info.device, cache, &seed_size, seed.data());
+    if (res != VK_SUCCESS) return res;
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.initialDataSize = seed_size;
+    cache_info.pInitialData = seed.data();
+
+    std::vector<VkPipelineCache> thread_caches;
+    for (uint32_t i = 0; i < thread_count; i++) {
+        VkPipelineCache thread_cache;
+        res = vkCreatePipelineCache(info.device, &cache_info, NULL, &thread_cache);
+        if (res != VK_SUCCESS) break;
+        thread_caches.push_back(thread_cache);
+    }
+
+    if (res == VK_SUCCESS) {
+        /* threads take the next description until there are none left */
+        std::atomic<size_t> next(0);
+        std::vector<VkResult> results(thread_count, VK_SUCCESS);
+        auto work = [&](uint32_t thread) {
+            for (size_t i = next++; i < descs.size(); i = next++) {
+                VkResult thread_res = init_pipeline(info, thread_caches[thread], descs[i], pipelines[i]);
+                if (thread_res != VK_SUCCESS) {
+                    pipelines[i] = VK_NULL_HANDLE;
+                    if (results[thread] == VK_SUCCESS) results[thread] = thread_res;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t i = 1; i < thread_count; i++) threads.push_back(std::thread(work, i));
+        work(0);
+        for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+
+        for (uint32_t i = 0; i < thread_count && res == VK_SUCCESS; i++) res = results[i];
+
+        VkResult merge_res = merge_pipeline_caches(info, cache, thread_caches);
+        if (res == VK_SUCCESS) res = merge_res;
+    }
+
+    for (size_t i = 0; i < thread_caches.size(); i++) vkDestroyPipelineCache(info.device, thread_caches[i], NULL);
+
+    return res;
+}
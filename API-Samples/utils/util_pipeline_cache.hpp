@@ -0,0 +1,66 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_PIPELINE_CACHE_HPP
+#define UTIL_PIPELINE_CACHE_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+/*
+ * An on-disk store for pipeline caches.
+ *
+ * Each cache is kept in get_file_directory(), in a file per device as
+ * util_pipeline_cache_file.hpp describes.  Data whose header does not match
+ * the device is ignored and replaced by the next save.
+ */
+
+/* Path of the file that holds the cache called name for this device */
+std::string get_pipeline_cache_path(struct sample_info &info, const char *name);
+
+/* Checks the header of pipeline cache data against the device, printing
+ * why it does not match.  source names the data in the messages. */
+bool validate_pipeline_cache_data(struct sample_info &info, const void *data, size_t size, const char *source);
+
+/* Reads the stored data of the cache called name.  Returns false, leaving
+ * data empty, when there is none or it does not match the device. */
+bool load_pipeline_cache_data(struct sample_info &info, const char *name, std::vector<uint8_t> &data);
+
+/* Creates cache, seeded with the stored data of the cache called name when
+ * there is valid data; loaded, when given, tells whether there was */
+VkResult load_pipeline_cache(struct sample_info &info, const char *name, VkPipelineCache &cache, bool *loaded = NULL);
+
+/* Replaces the stored data of the cache called name with that of cache */
+bool save_pipeline_cache(struct sample_info &info, const char *name, VkPipelineCache cache);
+
+/* Merges srcs into dst; srcs are left alone */
+VkResult merge_pipeline_caches(struct sample_info &info, VkPipelineCache dst, const std::vector<VkPipelineCache> &srcs);
+
+/*
+ * Creates a pipeline for each of descs on thread_count threads, or one per
+ * core when thread_count is 0, and merges what they add into cache.
+ *
+ * Creating pipelines in a shared cache serializes the threads on its lock,
+ * so each thread gets a cache of its own, seeded with the data cache
+ * already holds.  pipelines[i] is the pipeline of descs[i]; it is left
+ * VK_NULL_HANDLE when its creation fails, and the first failure is
+ * returned.
+ */
+VkResult warm_up_pipelines(struct sample_info &info, VkPipelineCache cache, const std::vector<pipeline_desc> &descs,
+                           std::vector<VkPipeline> &pipelines, uint32_t thread_count = 0);
+
+#endif  // UTIL_PIPELINE_CACHE_HPP
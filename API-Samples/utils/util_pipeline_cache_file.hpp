@@ -0,0 +1,176 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_PIPELINE_CACHE_FILE_HPP
+#define UTIL_PIPELINE_CACHE_FILE_HPP
+
+/*
+ * Pipeline cache files, without any Vulkan calls.
+ *
+ * This is the file handling of the pipeline cache store of the sample
+ * utilities (util_pipeline_cache.cpp) and of Hologram (PipelineCache.cpp),
+ * which only add the cache objects and their own error reporting.
+ *
+ * A file is named after its cache and the pipelineCacheUUID of the device,
+ * so that caches of several devices or drivers do not overwrite each other.
+ * Its data is only handed to the driver when its header matches the device;
+ * anything else is ignored and replaced by the next write.  Writes go to a
+ * temporary file that is then renamed over the old one, so that an
+ * interrupted write never leaves a truncated cache behind.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <vulkan/vulkan.h>
+
+/*
+ * The header every pipeline cache starts with, as VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+ * lays it out.  Each field is stored least significant byte first.
+ *
+ * Offset    Size            Meaning
+ * ------    ------------    ----------------------------------------------
+ *      0               4    length in bytes of the entire header
+ *      4               4    a VkPipelineCacheHeaderVersion value
+ *      8               4    VkPhysicalDeviceProperties::vendorID
+ *     12               4    VkPhysicalDeviceProperties::deviceID
+ *     16    VK_UUID_SIZE    VkPhysicalDeviceProperties::pipelineCacheUUID
+ */
+#define PIPELINE_CACHE_HEADER_SIZE (16 + VK_UUID_SIZE)
+
+struct pipeline_cache_header {
+    uint32_t length;
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint8_t uuid[VK_UUID_SIZE];
+};
+
+/* Fields of a header that do not match the device */
+enum {
+    PIPELINE_CACHE_BAD_LENGTH = 1 << 0,
+    PIPELINE_CACHE_BAD_VERSION = 1 << 1,
+    PIPELINE_CACHE_BAD_VENDOR_ID = 1 << 2,
+    PIPELINE_CACHE_BAD_DEVICE_ID = 1 << 3,
+    PIPELINE_CACHE_BAD_UUID = 1 << 4,
+};
+
+inline uint32_t read_le32(const uint8_t *bytes) {
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/* Path of the file that holds a cache for the device: prefix, usually the
+ * directory and the name of the cache, followed by the UUID */
+inline std::string get_pipeline_cache_file_path(const std::string &prefix, const VkPhysicalDeviceProperties &props) {
+    static const char hex[] = "0123456789abcdef";
+
+    std::string path = prefix + "_";
+    for (uint32_t i = 0; i < VK_UUID_SIZE; i++) {
+        path += hex[props.pipelineCacheUUID[i] >> 4];
+        path += hex[props.pipelineCacheUUID[i] & 0xf];
+    }
+    return path + ".bin";
+}
+
+/* Returns false when size is too short for a header */
+inline bool read_pipeline_cache_header(const void *data, size_t size, pipeline_cache_header &header) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    if (size < PIPELINE_CACHE_HEADER_SIZE) return false;
+
+    header.length = read_le32(bytes + 0);
+    header.version = read_le32(bytes + 4);
+    header.vendor_id = read_le32(bytes + 8);
+    header.device_id = read_le32(bytes + 12);
+    memcpy(header.uuid, bytes + 16, VK_UUID_SIZE);
+    return true;
+}
+
+/* The PIPELINE_CACHE_BAD_* fields of the header of size bytes of data; 0
+ * when the data can be handed to the device */
+inline uint32_t get_pipeline_cache_header_errors(const pipeline_cache_header &header, size_t size,
+                                                 const VkPhysicalDeviceProperties &props) {
+    uint32_t errors = 0;
+    if (header.length < PIPELINE_CACHE_HEADER_SIZE || header.length > size) errors |= PIPELINE_CACHE_BAD_LENGTH;
+    if (header.version != VK_PIPELINE_CACHE_HEADER_VERSION_ONE) errors |= PIPELINE_CACHE_BAD_VERSION;
+    /* the UUID is in the path too, but it may collide across vendors */
+    if (header.vendor_id != props.vendorID) errors |= PIPELINE_CACHE_BAD_VENDOR_ID;
+    if (header.device_id != props.deviceID) errors |= PIPELINE_CACHE_BAD_DEVICE_ID;
+    if (memcmp(header.uuid, props.pipelineCacheUUID, VK_UUID_SIZE) != 0) errors |= PIPELINE_CACHE_BAD_UUID;
+    return errors;
+}
+
+/* Reads the whole file.  Returns false, leaving data empty, when there is
+ * no file or it cannot be read; its contents are not checked. */
+inline bool read_pipeline_cache_file(const std::string &path, std::vector<uint8_t> &data) {
+    data.clear();
+
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    bool ok = fseek(file, 0, SEEK_END) == 0;
+    const long size = ok ? ftell(file) : -1;
+    ok = size > 0 && fseek(file, 0, SEEK_SET) == 0;
+    if (ok) {
+        data.resize(size);
+        ok = fread(data.data(), 1, data.size(), file) == data.size();
+    }
+    fclose(file);
+
+    if (!ok) data.clear();
+    return ok;
+}
+
+/* Replaces the file with size bytes of data, through a temporary file */
+inline bool write_pipeline_cache_file(const std::string &path, const void *data, size_t size) {
+    const std::string temp_path = path + ".tmp";
+
+    FILE *file = fopen(temp_path.c_str(), "wb");
+    if (!file) return false;
+
+    bool ok = fwrite(data, 1, size, file) == size;
+    ok = fflush(file) == 0 && ok;
+    ok = fclose(file) == 0 && ok;
+
+    /* rename does not replace an existing file on Windows */
+    if (ok) {
+#ifdef _WIN32
+        ok = MoveFileExA(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        ok = rename(temp_path.c_str(), path.c_str()) == 0;
+#endif
+    }
+    if (!ok) remove(temp_path.c_str());
+
+    return ok;
+}
+
+#endif  // UTIL_PIPELINE_CACHE_FILE_HPP
@@ -0,0 +1,218 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include <assert.h>
+#include <string.h>
+
+static uint32_t count_bits(uint32_t bits) {
+    uint32_t count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+}
+
+void init_query_ring(struct sample_info &info, query_ring &ring, VkQueryType type, uint32_t queries_per_frame,
+                     uint32_t slot_count, VkQueryPipelineStatisticFlags statistics) {
+    VkResult U_ASSERT_ONLY res;
+    assert(queries_per_frame > 0 && slot_count > 0);
+    assert(type != VK_QUERY_TYPE_PIPELINE_STATISTICS || (statistics && info.enabled_features.pipelineStatisticsQuery));
+
+    ring.info = &info;
+    ring.type = type;
+    ring.statistics = (type == VK_QUERY_TYPE_PIPELINE_STATISTICS) ? statistics : 0;
+    ring.values_per_query = ring.statistics ? count_bits(ring.statistics) : 1;
+    ring.queries_per_frame = queries_per_frame;
+    ring.slot_index = 0;
+    ring.frame = 0;
+    ring.recording = false;
+    ring.query_stride = (VkDeviceSize)(ring.values_per_query + 1) * sizeof(uint64_t);
+    ring.slot_stride = ring.query_stride * queries_per_frame;
+    ring.results_read = 0;
+    ring.results_not_ready = 0;
+
+    VkQueryPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    pool_info.pNext = NULL;
+    pool_info.queryType = type;
+    pool_info.flags = 0;
+    pool_info.queryCount = queries_per_frame;
+    pool_info.pipelineStatistics = ring.statistics;
+
+    VkEventCreateInfo event_info = {};
+    event_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    event_info.pNext = NULL;
+    event_info.flags = 0;
+
+    ring.slots.resize(slot_count);
+    for (uint32_t i = 0; i < slot_count; i++) {
+        query_ring_slot &slot = ring.slots[i];
+        res = vkCreateQueryPool(info.device, &pool_info, NULL, &slot.pool);
+        assert(res == VK_SUCCESS);
+        res = vkCreateEvent(info.device, &event_info, NULL, &slot.event);
+        assert(res == VK_SUCCESS);
+        slot.used = 0;
+        slot.frame = 0;
+    }
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.pNext = NULL;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buf_info.size = ring.slot_stride * slot_count;
+    buf_info.queueFamilyIndexCount = 0;
+    buf_info.pQueueFamilyIndices = NULL;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buf_info.flags = 0;
+    res = vkCreateBuffer(info.device, &buf_info, NULL, &ring.buffer);
+    assert(res == VK_SUCCESS);
+
+    /* Results are polled without a fence, so the memory has to be coherent;
+     * cached memory is faster to read when there is some */
+    if (!allocate_buffer_memory(info, ring.buffer,
+                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+                                ring.alloc)) {
+        bool U_ASSERT_ONLY pass = allocate_buffer_memory(
+            info, ring.buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, ring.alloc);
+        assert(pass && "No mappable, coherent memory");
+    }
+    memset(ring.alloc.mapped, 0, (size_t)buf_info.size);
+}
+
+static uint64_t *get_query_ring_slot_data(query_ring &ring, uint32_t slot) {
+    return (uint64_t *)((uint8_t *)ring.alloc.mapped + ring.slot_stride * slot);
+}
+
+void execute_query_ring_begin_frame(query_ring &ring, VkCommandBuffer cmd) {
+    VkResult U_ASSERT_ONLY res;
+    assert(!ring.recording);
+
+    ring.frame++;
+    ring.slot_index = (uint32_t)((ring.frame - 1) % ring.slots.size());
+    ring.recording = true;
+
+    /* The frame that last used the slot is done, so nothing else touches
+     * its event or its results */
+    query_ring_slot &slot = ring.slots[ring.slot_index];
+    res = vkResetEvent(ring.info->device, slot.event);
+    assert(res == VK_SUCCESS);
+    memset(get_query_ring_slot_data(ring, ring.slot_index), 0, (size_t)ring.slot_stride);
+    slot.used = 0;
+    slot.frame = ring.frame;
+
+    vkCmdResetQueryPool(cmd, slot.pool, 0, ring.queries_per_frame);
+}
+
+uint32_t execute_query_ring_begin_query(query_ring &ring, VkCommandBuffer cmd, VkQueryControlFlags flags) {
+    query_ring_slot &slot = ring.slots[ring.slot_index];
+    assert(ring.recording && ring.type != VK_QUERY_TYPE_TIMESTAMP);
+    assert(slot.used < ring.queries_per_frame);
+
+    vkCmdBeginQuery(cmd, slot.pool, slot.used, flags);
+    return slot.used++;
+}
+
+void execute_query_ring_end_query(query_ring &ring, VkCommandBuffer cmd, uint32_t query) {
+    assert(ring.recording && query < ring.slots[ring.slot_index].used);
+    vkCmdEndQuery(cmd, ring.slots[ring.slot_index].pool, query);
+}
+
+uint32_t execute_query_ring_timestamp(query_ring &ring, VkCommandBuffer cmd, VkPipelineStageFlagBits stage) {
+    query_ring_slot &slot = ring.slots[ring.slot_index];
+    assert(ring.recording && ring.type == VK_QUERY_TYPE_TIMESTAMP);
+    assert(slot.used < ring.queries_per_frame);
+
+    vkCmdWriteTimestamp(cmd, stage, slot.pool, slot.used);
+    return slot.used++;
+}
+
+void execute_query_ring_end_frame(query_ring &ring, VkCommandBuffer cmd) {
+    query_ring_slot &slot = ring.slots[ring.slot_index];
+    assert(ring.recording);
+    ring.recording = false;
+
+    if (slot.used) {
+        /* The wait is on the device; the host never waits for it */
+        vkCmdCopyQueryPoolResults(cmd, slot.pool, 0, slot.used, ring.buffer, ring.slot_stride * ring.slot_index,
+                                  ring.query_stride,
+                                  VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+        VkBufferMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext = NULL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = ring.buffer;
+        barrier.offset = ring.slot_stride * ring.slot_index;
+        barrier.size = ring.slot_stride;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, NULL, 1, &barrier, 0, NULL);
+    }
+
+    vkCmdSetEvent(cmd, slot.event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+bool get_query_ring_results(query_ring &ring, uint32_t frames_ago, std::vector<uint64_t> &values) {
+    const uint32_t slot_count = (uint32_t)ring.slots.size();
+    if (frames_ago >= slot_count || frames_ago >= ring.frame) return false;
+
+    const uint32_t slot_index = (ring.slot_index + slot_count - frames_ago) % slot_count;
+    const query_ring_slot &slot = ring.slots[slot_index];
+    if (slot.frame != ring.frame - frames_ago || !slot.used) return false;
+
+    if (vkGetEventStatus(ring.info->device, slot.event) != VK_EVENT_SET) {
+        ring.results_not_ready++;
+        return false;
+    }
+
+    const uint64_t *data = get_query_ring_slot_data(ring, slot_index);
+    const uint32_t words_per_query = ring.values_per_query + 1;
+    values.resize((size_t)slot.used * ring.values_per_query);
+    for (uint32_t q = 0; q < slot.used; q++) {
+        const uint64_t *query = data + (size_t)q * words_per_query;
+        if (!query[ring.values_per_query]) {
+            ring.results_not_ready++;
+            return false;
+        }
+        memcpy(&values[(size_t)q * ring.values_per_query], query, ring.values_per_query * sizeof(uint64_t));
+    }
+
+    ring.results_read++;
+    return true;
+}
+
+double get_query_ring_elapsed_ms(const query_ring &ring, uint64_t start, uint64_t end) {
+    /* timestamps wrap around after timestampValidBits bits */
+    const uint32_t valid_bits = ring.info->queue_props[ring.info->graphics_queue_family_index].timestampValidBits;
+    const uint64_t mask = (valid_bits >= 64) ? ~0ull : ((1ull << valid_bits) - 1);
+    const uint64_t ticks = (end - start) & mask;
+    return ticks * (double)ring.info->gpu_props.limits.timestampPeriod / 1e6;
+}
+
+void destroy_query_ring(query_ring &ring) {
+    for (size_t i = 0; i < ring.slots.size(); i++) {
+        vkDestroyQueryPool(ring.info->device, ring.slots[i].pool, NULL);
+        vkDestroyEvent(ring.info->device, ring.slots[i].event, NULL);
+    }
+    ring.slots.clear();
+
+    vkDestroyBuffer(ring.info->device, ring.buffer, NULL);
+    free_memory(*ring.info, ring.alloc);
+    ring.buffer = VK_NULL_HANDLE;
+}
@@ -0,0 +1,115 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_QUERY_HPP
+#define UTIL_QUERY_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+/*
+ * Query results read on the host a few frames after they were recorded,
+ * without waiting for the queue.
+ *
+ * A query ring has a slot per frame it keeps results for, each with a query
+ * pool of its own, an event, and a region of one host visible buffer that
+ * stays mapped.  execute_query_ring_begin_frame resets the pool of the next
+ * slot, and execute_query_ring_end_frame copies the results of the queries
+ * made since into the buffer with VK_QUERY_RESULT_WITH_AVAILABILITY_BIT,
+ * then sets the event.  The copy waits for the queries on the device, not
+ * on the host.  get_query_ring_results polls the event, since nothing
+ * orders the writes of the copy among themselves, and then checks the
+ * availability words, which the host clears before a slot is reused.
+ *
+ * Before a slot is reused, the device must have finished the frame that
+ * last used it, so there must be at least as many slots as frames in
+ * flight.  Results of a frame can be read until its slot is reused, up to
+ * slot_count - 1 frames later.
+ *
+ * A query ring is used from one thread.
+ */
+
+struct query_ring_slot {
+    VkQueryPool pool;
+    /* set once the copy of the results is done */
+    VkEvent event;
+    /* queries made in the frame, and the frame, 0 for none yet */
+    uint32_t used;
+    uint64_t frame;
+};
+
+struct query_ring {
+    struct sample_info *info;
+    VkQueryType type;
+    VkQueryPipelineStatisticFlags statistics;
+    /* one, or a value per statistic */
+    uint32_t values_per_query;
+    uint32_t queries_per_frame;
+
+    std::vector<query_ring_slot> slots;
+    uint32_t slot_index;
+    /* frames begun so far */
+    uint64_t frame;
+    bool recording;
+
+    VkBuffer buffer;
+    memory_allocation alloc;
+    /* each query is its values and an availability word, all 64-bit */
+    VkDeviceSize query_stride;
+    VkDeviceSize slot_stride;
+
+    uint64_t results_read;
+    uint64_t results_not_ready;
+};
+
+/* statistics are the pipeline statistics to count, for
+ * VK_QUERY_TYPE_PIPELINE_STATISTICS, which needs the pipelineStatisticsQuery
+ * feature enabled through info.enabled_features */
+void init_query_ring(struct sample_info &info, query_ring &ring, VkQueryType type, uint32_t queries_per_frame,
+                     uint32_t slot_count, VkQueryPipelineStatisticFlags statistics = 0);
+
+/* Moves to the next slot and records the reset of its pool into cmd,
+ * outside a render pass */
+void execute_query_ring_begin_frame(query_ring &ring, VkCommandBuffer cmd);
+
+/* Begins an occlusion or pipeline statistics query and returns its index
+ * in the frame */
+uint32_t execute_query_ring_begin_query(query_ring &ring, VkCommandBuffer cmd, VkQueryControlFlags flags = 0);
+void execute_query_ring_end_query(query_ring &ring, VkCommandBuffer cmd, uint32_t query);
+
+/* Writes a timestamp once stage is done with earlier commands and returns
+ * its index in the frame */
+uint32_t execute_query_ring_timestamp(query_ring &ring, VkCommandBuffer cmd, VkPipelineStageFlagBits stage);
+
+/* Records the copy of the frame's results into cmd, outside a render pass */
+void execute_query_ring_end_frame(query_ring &ring, VkCommandBuffer cmd);
+
+/*
+ * Reads the results of the frame frames_ago frames before the last one
+ * begun, values_per_query values for each of its queries, in order,
+ * timestamps being in ticks.  Returns false
+ * without waiting when they have not all landed yet, or when that frame is
+ * too old or had no queries.
+ */
+bool get_query_ring_results(query_ring &ring, uint32_t frames_ago, std::vector<uint64_t> &values);
+
+/* Milliseconds between two timestamps of the ring */
+double get_query_ring_elapsed_ms(const query_ring &ring, uint64_t start, uint64_t end);
+
+void destroy_query_ring(query_ring &ring);
+
+#endif  // UTIL_QUERY_HPP
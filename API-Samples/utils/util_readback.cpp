@@ -0,0 +1,313 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include "util_image.hpp"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static bool swaps_red_and_blue(VkFormat format) {
+    return format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8A8_SRGB;
+}
+
+static bool is_readback_format(VkFormat format) {
+    return swaps_red_and_blue(format) || format == VK_FORMAT_R8G8B8A8_UNORM || format == VK_FORMAT_R8G8B8A8_SRGB;
+}
+
+static void execute_readback_io(readback *rb) {
+    std::unique_lock<std::mutex> lock(rb->mutex);
+    for (;;) {
+        while (!rb->quit && rb->queue.empty()) rb->cond.wait(lock);
+        if (rb->queue.empty()) break;
+
+        readback_file file;
+        file.filename.swap(rb->queue.front().filename);
+        file.data.swap(rb->queue.front().data);
+        rb->queue.pop_front();
+        rb->io_busy = true;
+        lock.unlock();
+
+        FILE *out = fopen(file.filename.c_str(), "wb");
+        bool ok = out && fwrite(file.data.data(), 1, file.data.size(), out) == file.data.size();
+        if (out) ok = fclose(out) == 0 && ok;
+
+        lock.lock();
+        if (ok)
+            rb->files_written++;
+        else
+            rb->write_failures++;
+        rb->spare_data.push_back(std::vector<unsigned char>());
+        rb->spare_data.back().swap(file.data);
+        rb->io_busy = false;
+        rb->cond.notify_all();
+    }
+}
+
+void init_readback(struct sample_info &info, readback &rb, uint32_t slot_count) {
+    rb.info = &info;
+    rb.slots.resize(slot_count ? slot_count : 1);
+    for (size_t i = 0; i < rb.slots.size(); i++) {
+        readback_slot &slot = rb.slots[i];
+        slot.buffer = VK_NULL_HANDLE;
+        slot.alloc = memory_allocation();
+        slot.size = 0;
+        slot.coherent = false;
+        slot.pending = false;
+        slot.width = 0;
+        slot.height = 0;
+    }
+
+    rb.io_busy = false;
+    rb.quit = false;
+    rb.images_collected = 0;
+    rb.files_written = 0;
+    rb.write_failures = 0;
+    rb.io_thread = std::thread(execute_readback_io, &rb);
+
+    if (!is_readback_format(info.format)) printf("Unrecognized image format - will not write image files\n");
+}
+
+static void destroy_readback_buffer(readback &rb, readback_slot &slot) {
+    if (slot.buffer == VK_NULL_HANDLE) return;
+
+    vkDestroyBuffer(rb.info->device, slot.buffer, NULL);
+    free_memory(*rb.info, slot.alloc);
+    slot.buffer = VK_NULL_HANDLE;
+    slot.size = 0;
+}
+
+static void init_readback_buffer(readback &rb, readback_slot &slot, VkDeviceSize size) {
+    struct sample_info &info = *rb.info;
+    VkResult U_ASSERT_ONLY res;
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.pNext = NULL;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buf_info.size = size;
+    buf_info.queueFamilyIndexCount = 0;
+    buf_info.pQueueFamilyIndices = NULL;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buf_info.flags = 0;
+    res = vkCreateBuffer(info.device, &buf_info, NULL, &slot.buffer);
+    assert(res == VK_SUCCESS);
+
+    /* The host reads every byte, which is slow from uncached memory */
+    slot.coherent = false;
+    if (!allocate_buffer_memory(info, slot.buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+                                slot.alloc)) {
+        bool U_ASSERT_ONLY pass = allocate_buffer_memory(
+            info, slot.buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, slot.alloc);
+        assert(pass && "No mappable, coherent memory");
+        slot.coherent = true;
+    }
+    slot.size = size;
+}
+
+void execute_readback_copy(readback &rb, uint32_t slot_index, VkCommandBuffer cmd, VkImage image, const char *filename) {
+    struct sample_info &info = *rb.info;
+    readback_slot &slot = rb.slots[slot_index];
+    assert(!slot.pending);
+
+    if (!is_readback_format(info.format)) return;
+
+    /* The slot is not in use, so a buffer that is too small can go */
+    const VkDeviceSize size = (VkDeviceSize)info.width * info.height * 4;
+    if (slot.size < size) {
+        destroy_readback_buffer(rb, slot);
+        init_readback_buffer(rb, slot, size);
+    }
+
+    VkImageMemoryBarrier image_barrier = {};
+    image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    image_barrier.pNext = NULL;
+    image_barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.image = image;
+    image_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    image_barrier.subresourceRange.baseMipLevel = 0;
+    image_barrier.subresourceRange.levelCount = 1;
+    image_barrier.subresourceRange.baseArrayLayer = 0;
+    image_barrier.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL,
+                         1, &image_barrier);
+
+    /* Tightly packed rows, so the host reads one contiguous range */
+    VkBufferImageCopy copy_region = {};
+    copy_region.bufferOffset = 0;
+    copy_region.bufferRowLength = 0;
+    copy_region.bufferImageHeight = 0;
+    copy_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy_region.imageSubresource.mipLevel = 0;
+    copy_region.imageSubresource.baseArrayLayer = 0;
+    copy_region.imageSubresource.layerCount = 1;
+    copy_region.imageOffset.x = 0;
+    copy_region.imageOffset.y = 0;
+    copy_region.imageOffset.z = 0;
+    copy_region.imageExtent.width = info.width;
+    copy_region.imageExtent.height = info.height;
+    copy_region.imageExtent.depth = 1;
+    vkCmdCopyImageToBuffer(cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1, &copy_region);
+
+    image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.dstAccessMask = 0;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkBufferMemoryBarrier buffer_barrier = {};
+    buffer_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buffer_barrier.pNext = NULL;
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.buffer = slot.buffer;
+    buffer_barrier.offset = 0;
+    buffer_barrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                         0, NULL, 1, &buffer_barrier, 1, &image_barrier);
+
+    slot.pending = true;
+    slot.width = info.width;
+    slot.height = info.height;
+    slot.filename = filename;
+}
+
+void execute_readback_collect(readback &rb, uint32_t slot_index) {
+    struct sample_info &info = *rb.info;
+    readback_slot &slot = rb.slots[slot_index];
+    if (!slot.pending) return;
+    slot.pending = false;
+
+    if (!slot.coherent) {
+        /* Suballocations start on 256 byte boundaries, which is the largest
+         * nonCoherentAtomSize allowed, and their blocks extend to the next
+         * power of two, so rounding the size up stays within them */
+        const VkDeviceSize atom = info.gpu_props.limits.nonCoherentAtomSize;
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.pNext = NULL;
+        range.memory = slot.alloc.memory;
+        if (slot.alloc.pool == DEDICATED_POOL) {
+            range.offset = 0;
+            range.size = VK_WHOLE_SIZE;
+        } else {
+            range.offset = slot.alloc.offset;
+            range.size = (slot.alloc.size + atom - 1) / atom * atom;
+        }
+        VkResult U_ASSERT_ONLY res = vkInvalidateMappedMemoryRanges(info.device, 1, &range);
+        assert(res == VK_SUCCESS);
+    }
+
+    /* Wait for the I/O thread when it falls behind, rather than queueing
+     * frames without bound */
+    readback_file file;
+    {
+        std::unique_lock<std::mutex> lock(rb.mutex);
+        while (rb.queue.size() > rb.slots.size()) rb.cond.wait(lock);
+        if (!rb.spare_data.empty()) {
+            file.data.swap(rb.spare_data.back());
+            rb.spare_data.pop_back();
+        }
+    }
+
+    char header[64];
+    const int header_size = snprintf(header, sizeof(header), "P6\n%u %u\n255\n", slot.width, slot.height);
+    const size_t row_size = (size_t)slot.width * 3;
+    file.data.resize(header_size + row_size * slot.height);
+    memcpy(file.data.data(), header, header_size);
+
+    /* the copy is tightly packed, so the whole image converts in one go */
+    rgba8_to_rgb8((const unsigned char *)slot.alloc.mapped, file.data.data() + header_size,
+                  (size_t)slot.width * slot.height, swaps_red_and_blue(info.format));
+    file.filename.swap(slot.filename);
+
+    std::lock_guard<std::mutex> lock(rb.mutex);
+    rb.queue.push_back(readback_file());
+    rb.queue.back().filename.swap(file.filename);
+    rb.queue.back().data.swap(file.data);
+    rb.images_collected++;
+    rb.cond.notify_all();
+}
+
+void execute_readback_flush(readback &rb) {
+    std::unique_lock<std::mutex> lock(rb.mutex);
+    while (!rb.queue.empty() || rb.io_busy) rb.cond.wait(lock);
+}
+
+void destroy_readback(readback &rb) {
+    {
+        std::lock_guard<std::mutex> lock(rb.mutex);
+        rb.quit = true;
+        rb.cond.notify_all();
+    }
+    rb.io_thread.join();
+
+    if (rb.write_failures) printf("Could not write %u image file(s)\n", (uint32_t)rb.write_failures);
+
+    for (size_t i = 0; i < rb.slots.size(); i++) destroy_readback_buffer(rb, rb.slots[i]);
+    rb.slots.clear();
+    rb.spare_data.clear();
+}
+
+void write_ppm(struct sample_info &info, const char *basename) {
+    VkResult U_ASSERT_ONLY res;
+
+    readback rb;
+    init_readback(info, rb, 1);
+
+    VkCommandBufferBeginInfo cmd_buf_info = {};
+    cmd_buf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmd_buf_info.pNext = NULL;
+    cmd_buf_info.flags = 0;
+    cmd_buf_info.pInheritanceInfo = NULL;
+    res = vkBeginCommandBuffer(info.cmd, &cmd_buf_info);
+    assert(res == VK_SUCCESS);
+
+    std::string filename = std::string(basename) + ".ppm";
+    execute_readback_copy(rb, 0, info.cmd, info.buffers[info.current_buffer].image, filename.c_str());
+
+    res = vkEndCommandBuffer(info.cmd);
+    assert(res == VK_SUCCESS);
+
+    VkFence cmdFence;
+    init_fence(info, cmdFence);
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.pNext = NULL;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &info.cmd;
+    res = vkQueueSubmit(info.graphics_queue, 1, &submit_info, cmdFence);
+    assert(res == VK_SUCCESS);
+
+    /* A single capture has nothing to overlap with */
+    do {
+        res = vkWaitForFences(info.device, 1, &cmdFence, VK_TRUE, FENCE_TIMEOUT);
+    } while (res == VK_TIMEOUT);
+    assert(res == VK_SUCCESS);
+    vkDestroyFence(info.device, cmdFence, NULL);
+
+    execute_readback_collect(rb, 0);
+    destroy_readback(rb);
+}
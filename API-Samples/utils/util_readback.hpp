@@ -0,0 +1,98 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_READBACK_HPP
+#define UTIL_READBACK_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+/*
+ * Reads rendered images back to the host and writes them as PPM files
+ * without stalling the GPU.
+ *
+ * A readback has a few slots, typically one per frame in flight, each a
+ * host visible buffer that stays allocated from one capture to the next.
+ * execute_readback_copy records a copy of a swap chain image into a slot,
+ * in the command buffer of the frame.  Once the caller knows that command
+ * buffer has finished, typically when it waits on the fence of the frame
+ * before reusing it, execute_readback_collect converts the pixels into a
+ * PPM file in memory and hands it to an I/O thread, which writes it.
+ *
+ * A readback is used from one thread, apart from its I/O thread.
+ */
+
+struct readback_slot {
+    VkBuffer buffer;
+    memory_allocation alloc;
+    VkDeviceSize size;
+    /* host cached memory is usually not coherent */
+    bool coherent;
+
+    /* a copy was recorded and not collected yet */
+    bool pending;
+    uint32_t width;
+    uint32_t height;
+    std::string filename;
+};
+
+/* A PPM file waiting for the I/O thread */
+struct readback_file {
+    std::string filename;
+    std::vector<unsigned char> data;
+};
+
+struct readback {
+    struct sample_info *info;
+    std::vector<readback_slot> slots;
+
+    std::thread io_thread;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<readback_file> queue;
+    /* written files keep their memory for later ones */
+    std::vector<std::vector<unsigned char> > spare_data;
+    bool io_busy;
+    bool quit;
+
+    uint64_t images_collected;
+    uint64_t files_written;
+    uint64_t write_failures;
+};
+
+void init_readback(struct sample_info &info, readback &rb, uint32_t slot_count);
+
+/* Records into cmd a copy of image, a swap chain image in
+ * VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, into slot, which must not be pending.
+ * The image is back in its layout after the copy. */
+void execute_readback_copy(readback &rb, uint32_t slot, VkCommandBuffer cmd, VkImage image, const char *filename);
+
+/* Queues the file of slot for writing; the copy into it must have finished.
+ * Does nothing unless the slot is pending. */
+void execute_readback_collect(readback &rb, uint32_t slot);
+
+/* Waits until all queued files are written */
+void execute_readback_flush(readback &rb);
+
+/* Writes the queued files first.  Slots still pending are dropped. */
+void destroy_readback(readback &rb);
+
+#endif  // UTIL_READBACK_HPP
@@ -0,0 +1,641 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+
+/*
+ * The few parts of the SPIR-V specification used here, see
+ * https://www.khronos.org/registry/spir-v/specs/unified1/SPIRV.html.
+ * Each instruction starts with a word holding its word count in the high
+ * 16 bits and its opcode in the low 16, after a header of five words:
+ * magic number, version, generator, bound and schema.
+ */
+#define SPIRV_MAGIC 0x07230203
+#define SPIRV_HEADER_WORDS 5
+
+enum {
+    SPIRV_OP_ENTRY_POINT = 15,
+    SPIRV_OP_TYPE_VOID = 19,
+    SPIRV_OP_TYPE_BOOL = 20,
+    SPIRV_OP_TYPE_INT = 21,
+    SPIRV_OP_TYPE_FLOAT = 22,
+    SPIRV_OP_TYPE_VECTOR = 23,
+    SPIRV_OP_TYPE_MATRIX = 24,
+    SPIRV_OP_TYPE_IMAGE = 25,
+    SPIRV_OP_TYPE_SAMPLER = 26,
+    SPIRV_OP_TYPE_SAMPLED_IMAGE = 27,
+    SPIRV_OP_TYPE_ARRAY = 28,
+    SPIRV_OP_TYPE_RUNTIME_ARRAY = 29,
+    SPIRV_OP_TYPE_STRUCT = 30,
+    SPIRV_OP_TYPE_POINTER = 32,
+    SPIRV_OP_TYPE_FORWARD_POINTER = 39,
+    SPIRV_OP_CONSTANT_TRUE = 41,
+    SPIRV_OP_CONSTANT_FALSE = 42,
+    SPIRV_OP_CONSTANT = 43,
+    SPIRV_OP_CONSTANT_COMPOSITE = 44,
+    SPIRV_OP_SPEC_CONSTANT_TRUE = 48,
+    SPIRV_OP_SPEC_CONSTANT_FALSE = 49,
+    SPIRV_OP_SPEC_CONSTANT = 50,
+    SPIRV_OP_SPEC_CONSTANT_COMPOSITE = 51,
+    SPIRV_OP_SPEC_CONSTANT_OP = 52,
+    SPIRV_OP_VARIABLE = 59,
+    SPIRV_OP_DECORATE = 71,
+    SPIRV_OP_MEMBER_DECORATE = 72,
+};
+
+enum {
+    SPIRV_DECORATION_SPEC_ID = 1,
+    SPIRV_DECORATION_BLOCK = 2,
+    SPIRV_DECORATION_BUFFER_BLOCK = 3,
+    SPIRV_DECORATION_ARRAY_STRIDE = 6,
+    SPIRV_DECORATION_MATRIX_STRIDE = 7,
+    SPIRV_DECORATION_BINDING = 33,
+    SPIRV_DECORATION_DESCRIPTOR_SET = 34,
+    SPIRV_DECORATION_OFFSET = 35,
+};
+
+enum {
+    SPIRV_STORAGE_UNIFORM_CONSTANT = 0,
+    SPIRV_STORAGE_UNIFORM = 2,
+    SPIRV_STORAGE_PUSH_CONSTANT = 9,
+    SPIRV_STORAGE_STORAGE_BUFFER = 12,
+};
+
+enum {
+    SPIRV_DIM_BUFFER = 5,
+    SPIRV_DIM_SUBPASS_DATA = 6,
+};
+
+static uint32_t spirv_instruction_word(uint32_t opcode, uint32_t word_count) { return (word_count << 16) | opcode; }
+
+bool parse_spirv_module(const uint32_t *code, size_t code_size, spirv_module &module) {
+    module.code = NULL;
+    module.word_count = 0;
+    module.bound = 0;
+
+    if (!code || code_size % sizeof(uint32_t) != 0) return false;
+    const size_t word_count = code_size / sizeof(uint32_t);
+    if (word_count < SPIRV_HEADER_WORDS || code[0] != SPIRV_MAGIC) return false;
+
+    module.code = code;
+    module.word_count = word_count;
+    module.bound = code[3];
+    return true;
+}
+
+bool next_spirv_instruction(const spirv_module &module, size_t &offset, spirv_instruction &inst) {
+    if (offset < SPIRV_HEADER_WORDS) offset = SPIRV_HEADER_WORDS;
+    if (offset >= module.word_count) return false;
+
+    const uint32_t word_count = module.code[offset] >> 16;
+    if (word_count == 0 || word_count > module.word_count - offset) return false;
+
+    inst.opcode = module.code[offset] & 0xffff;
+    inst.word_count = word_count;
+    inst.words = module.code + offset;
+    inst.offset = offset;
+    offset += word_count;
+    return true;
+}
+
+/*
+ * What reflection needs to know about each result ID, gathered in one walk
+ * over the module: where it is defined and how it is decorated.
+ */
+#define SPIRV_ID_HAS_SET 0x1
+#define SPIRV_ID_HAS_BINDING 0x2
+#define SPIRV_ID_HAS_SPEC_ID 0x4
+#define SPIRV_ID_BLOCK 0x8
+#define SPIRV_ID_BUFFER_BLOCK 0x10
+
+struct spirv_id_info {
+    /* offset of the defining instruction, 0 when not recorded */
+    size_t def;
+    uint32_t flags;
+    uint32_t set;
+    uint32_t binding;
+    uint32_t spec_id;
+    uint32_t array_stride;
+};
+
+struct spirv_context {
+    const spirv_module *module;
+    std::vector<spirv_id_info> ids;
+    /* Offset and MatrixStride of struct members, keyed by struct and member */
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> member_offsets;
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> member_matrix_strides;
+};
+
+/* The defining instruction of id, or NULL */
+static const uint32_t *spirv_def(const spirv_context &ctx, uint32_t id) {
+    if (id >= ctx.ids.size() || ctx.ids[id].def == 0) return NULL;
+    return ctx.module->code + ctx.ids[id].def;
+}
+
+static uint32_t spirv_opcode(const uint32_t *words) { return words ? (words[0] & 0xffff) : 0; }
+
+static uint32_t spirv_word_count(const uint32_t *words) { return words[0] >> 16; }
+
+/* Value of a 32-bit integer OpConstant, such as an array length */
+static bool spirv_constant_u32(const spirv_context &ctx, uint32_t id, uint32_t &value) {
+    const uint32_t *words = spirv_def(ctx, id);
+    if (spirv_opcode(words) != SPIRV_OP_CONSTANT || spirv_word_count(words) < 4) return false;
+    value = words[3];
+    return true;
+}
+
+/* Size in bytes of a type laid out as Offset, ArrayStride and MatrixStride
+ * say.  matrix_stride is that of the member holding the type, if any. */
+static uint32_t spirv_type_size(const spirv_context &ctx, uint32_t type_id, uint32_t matrix_stride, uint32_t depth = 0) {
+    const uint32_t *words = spirv_def(ctx, type_id);
+    if (!words || depth > 32) return 0;
+
+    switch (spirv_opcode(words)) {
+        case SPIRV_OP_TYPE_BOOL:
+            return sizeof(VkBool32);
+        case SPIRV_OP_TYPE_INT:
+        case SPIRV_OP_TYPE_FLOAT:
+            return words[2] / 8;
+        case SPIRV_OP_TYPE_VECTOR:
+            return words[3] * spirv_type_size(ctx, words[2], 0, depth + 1);
+        case SPIRV_OP_TYPE_MATRIX:
+            return words[3] * (matrix_stride ? matrix_stride : spirv_type_size(ctx, words[2], 0, depth + 1));
+        case SPIRV_OP_TYPE_ARRAY: {
+            uint32_t length = 0;
+            if (!spirv_constant_u32(ctx, words[3], length)) return 0;
+            const uint32_t stride = ctx.ids[type_id].array_stride;
+            return length * (stride ? stride : spirv_type_size(ctx, words[2], matrix_stride, depth + 1));
+        }
+        case SPIRV_OP_TYPE_STRUCT: {
+            uint32_t size = 0;
+            for (uint32_t m = 0; m + 2 < spirv_word_count(words); m++) {
+                const std::pair<uint32_t, uint32_t> key(type_id, m);
+                std::map<std::pair<uint32_t, uint32_t>, uint32_t>::const_iterator offset = ctx.member_offsets.find(key);
+                std::map<std::pair<uint32_t, uint32_t>, uint32_t>::const_iterator stride =
+                    ctx.member_matrix_strides.find(key);
+                const uint32_t member_offset = (offset != ctx.member_offsets.end()) ? offset->second : size;
+                const uint32_t member_stride = (stride != ctx.member_matrix_strides.end()) ? stride->second : 0;
+                size = std::max(size, member_offset + spirv_type_size(ctx, words[2 + m], member_stride, depth + 1));
+            }
+            return size;
+        }
+        default:
+            /* runtime arrays and opaque types have no size */
+            return 0;
+    }
+}
+
+static VkShaderStageFlagBits spirv_stage(uint32_t execution_model) {
+    switch (execution_model) {
+        case 0:
+            return VK_SHADER_STAGE_VERTEX_BIT;
+        case 1:
+            return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+        case 2:
+            return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        case 3:
+            return VK_SHADER_STAGE_GEOMETRY_BIT;
+        case 4:
+            return VK_SHADER_STAGE_FRAGMENT_BIT;
+        case 5:
+            return VK_SHADER_STAGE_COMPUTE_BIT;
+        default:
+            return (VkShaderStageFlagBits)0;
+    }
+}
+
+/* Descriptor type of a resource variable, given the type it points to with
+ * any arrays stripped.  Returns false for anything that is not a descriptor. */
+static bool spirv_descriptor_type(const spirv_context &ctx, uint32_t storage, uint32_t type_id, VkDescriptorType &type) {
+    const uint32_t *words = spirv_def(ctx, type_id);
+    if (!words) return false;
+
+    if (storage == SPIRV_STORAGE_STORAGE_BUFFER) {
+        type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        return true;
+    }
+
+    if (storage == SPIRV_STORAGE_UNIFORM) {
+        if (ctx.ids[type_id].flags & SPIRV_ID_BUFFER_BLOCK)
+            type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        else
+            type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        return true;
+    }
+
+    switch (spirv_opcode(words)) {
+        case SPIRV_OP_TYPE_SAMPLER:
+            type = VK_DESCRIPTOR_TYPE_SAMPLER;
+            return true;
+        case SPIRV_OP_TYPE_SAMPLED_IMAGE:
+            type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            return true;
+        case SPIRV_OP_TYPE_IMAGE: {
+            /* Dim is words[3] and Sampled words[7]: 1 with a sampler, 2 without */
+            const bool storage_image = (words[7] == 2);
+            if (words[3] == SPIRV_DIM_BUFFER)
+                type = storage_image ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+            else if (words[3] == SPIRV_DIM_SUBPASS_DATA)
+                type = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+            else
+                type = storage_image ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static void reflect_spirv_variable(const spirv_context &ctx, const uint32_t *words, spirv_reflection &reflection) {
+    const uint32_t variable_id = words[2];
+    const uint32_t storage = words[3];
+
+    const uint32_t *pointer = spirv_def(ctx, words[1]);
+    if (spirv_opcode(pointer) != SPIRV_OP_TYPE_POINTER) return;
+    uint32_t type_id = pointer[3];
+
+    if (storage == SPIRV_STORAGE_PUSH_CONSTANT) {
+        const uint32_t *block = spirv_def(ctx, type_id);
+        if (spirv_opcode(block) != SPIRV_OP_TYPE_STRUCT) return;
+
+        /* the range starts at the first member, which need not be at 0 */
+        uint32_t begin = UINT32_MAX;
+        for (uint32_t m = 0; m + 2 < spirv_word_count(block); m++) {
+            std::map<std::pair<uint32_t, uint32_t>, uint32_t>::const_iterator offset =
+                ctx.member_offsets.find(std::make_pair(type_id, m));
+            if (offset != ctx.member_offsets.end()) begin = std::min(begin, offset->second);
+        }
+        if (begin == UINT32_MAX) begin = 0;
+
+        const uint32_t end = spirv_type_size(ctx, type_id, 0);
+        reflection.push_constants.stageFlags = reflection.stage;
+        reflection.push_constants.offset = begin;
+        reflection.push_constants.size = (end > begin) ? end - begin : 0;
+        return;
+    }
+
+    if (storage != SPIRV_STORAGE_UNIFORM_CONSTANT && storage != SPIRV_STORAGE_UNIFORM &&
+        storage != SPIRV_STORAGE_STORAGE_BUFFER)
+        return;
+
+    const spirv_id_info &info = ctx.ids[variable_id];
+    if (!(info.flags & SPIRV_ID_HAS_BINDING)) return;
+
+    spirv_binding binding;
+    binding.set = (info.flags & SPIRV_ID_HAS_SET) ? info.set : 0;
+    binding.binding = info.binding;
+    binding.count = 1;
+    binding.variable_id = variable_id;
+
+    for (;;) {
+        const uint32_t *array = spirv_def(ctx, type_id);
+        if (spirv_opcode(array) == SPIRV_OP_TYPE_ARRAY) {
+            uint32_t length = 0;
+            if (!spirv_constant_u32(ctx, array[3], length)) return;
+            binding.count *= length;
+        } else if (spirv_opcode(array) == SPIRV_OP_TYPE_RUNTIME_ARRAY) {
+            binding.count = 0;
+        } else {
+            break;
+        }
+        type_id = array[2];
+    }
+
+    if (!spirv_descriptor_type(ctx, storage, type_id, binding.type)) return;
+    reflection.bindings.push_back(binding);
+}
+
+static bool spirv_binding_less(const spirv_binding &a, const spirv_binding &b) {
+    return (a.set != b.set) ? a.set < b.set : a.binding < b.binding;
+}
+
+bool reflect_spirv(const spirv_module &module, spirv_reflection &reflection) {
+    reflection.stage = (VkShaderStageFlagBits)0;
+    reflection.entry_point.clear();
+    reflection.bindings.clear();
+    memset(&reflection.push_constants, 0, sizeof(reflection.push_constants));
+    reflection.spec_constants.clear();
+
+    spirv_context ctx;
+    ctx.module = &module;
+    spirv_id_info empty = {};
+    ctx.ids.assign(module.bound, empty);
+
+    std::vector<size_t> variables;
+    std::vector<size_t> spec_constants;
+    bool has_entry_point = false;
+
+    size_t offset = 0;
+    spirv_instruction inst;
+    while (next_spirv_instruction(module, offset, inst)) {
+        const uint32_t *words = inst.words;
+
+        /* result IDs follow the result type, which types do not have */
+        uint32_t result_id = 0;
+        if (inst.opcode >= SPIRV_OP_TYPE_VOID && inst.opcode < SPIRV_OP_TYPE_FORWARD_POINTER && inst.word_count >= 2)
+            result_id = words[1];
+        else if (inst.opcode >= SPIRV_OP_CONSTANT_TRUE && inst.opcode <= SPIRV_OP_SPEC_CONSTANT_OP && inst.word_count >= 3)
+            result_id = words[2];
+        else if (inst.opcode == SPIRV_OP_VARIABLE && inst.word_count >= 4)
+            result_id = words[2];
+        if (result_id != 0 && result_id < module.bound) ctx.ids[result_id].def = inst.offset;
+
+        switch (inst.opcode) {
+            case SPIRV_OP_ENTRY_POINT:
+                if (!has_entry_point && inst.word_count >= 4) {
+                    has_entry_point = true;
+                    reflection.stage = spirv_stage(words[1]);
+                    const char *name = (const char *)&words[3];
+                    const size_t max_length = (inst.word_count - 3) * sizeof(uint32_t);
+                    reflection.entry_point.assign(name, std::find(name, name + max_length, '\0'));
+                }
+                break;
+            case SPIRV_OP_DECORATE: {
+                if (inst.word_count < 3 || words[1] >= module.bound) break;
+                spirv_id_info &info = ctx.ids[words[1]];
+                const uint32_t operand = (inst.word_count >= 4) ? words[3] : 0;
+                switch (words[2]) {
+                    case SPIRV_DECORATION_SPEC_ID:
+                        info.flags |= SPIRV_ID_HAS_SPEC_ID;
+                        info.spec_id = operand;
+                        break;
+                    case SPIRV_DECORATION_BLOCK:
+                        info.flags |= SPIRV_ID_BLOCK;
+                        break;
+                    case SPIRV_DECORATION_BUFFER_BLOCK:
+                        info.flags |= SPIRV_ID_BUFFER_BLOCK;
+                        break;
+                    case SPIRV_DECORATION_ARRAY_STRIDE:
+                        info.array_stride = operand;
+                        break;
+                    case SPIRV_DECORATION_BINDING:
+                        info.flags |= SPIRV_ID_HAS_BINDING;
+                        info.binding = operand;
+                        break;
+                    case SPIRV_DECORATION_DESCRIPTOR_SET:
+                        info.flags |= SPIRV_ID_HAS_SET;
+                        info.set = operand;
+                        break;
+                }
+                break;
+            }
+            case SPIRV_OP_MEMBER_DECORATE:
+                if (inst.word_count < 5) break;
+                if (words[3] == SPIRV_DECORATION_OFFSET)
+                    ctx.member_offsets[std::make_pair(words[1], words[2])] = words[4];
+                else if (words[3] == SPIRV_DECORATION_MATRIX_STRIDE)
+                    ctx.member_matrix_strides[std::make_pair(words[1], words[2])] = words[4];
+                break;
+            case SPIRV_OP_VARIABLE:
+                if (inst.word_count >= 4) variables.push_back(inst.offset);
+                break;
+            case SPIRV_OP_SPEC_CONSTANT_TRUE:
+            case SPIRV_OP_SPEC_CONSTANT_FALSE:
+            case SPIRV_OP_SPEC_CONSTANT:
+                if (inst.word_count >= 3) spec_constants.push_back(inst.offset);
+                break;
+        }
+    }
+    if (!has_entry_point) return false;
+
+    /* decorations come before the types and variables they decorate, but
+     * types can be forward referenced, so these wait for the whole walk */
+    for (size_t i = 0; i < variables.size(); i++) reflect_spirv_variable(ctx, module.code + variables[i], reflection);
+    std::sort(reflection.bindings.begin(), reflection.bindings.end(), spirv_binding_less);
+
+    for (size_t i = 0; i < spec_constants.size(); i++) {
+        const uint32_t *words = module.code + spec_constants[i];
+        const uint32_t opcode = spirv_opcode(words);
+        const uint32_t result_id = words[2];
+        if (result_id >= module.bound || !(ctx.ids[result_id].flags & SPIRV_ID_HAS_SPEC_ID)) continue;
+
+        spirv_spec_constant constant;
+        constant.spec_id = ctx.ids[result_id].spec_id;
+        constant.result_id = result_id;
+        constant.is_bool = (opcode != SPIRV_OP_SPEC_CONSTANT);
+        if (constant.is_bool) {
+            constant.size = sizeof(VkBool32);
+            constant.default_value = (opcode == SPIRV_OP_SPEC_CONSTANT_TRUE) ? 1 : 0;
+        } else {
+            constant.size = spirv_type_size(ctx, words[1], 0);
+            constant.default_value = (spirv_word_count(words) > 3) ? words[3] : 0;
+            if (spirv_word_count(words) > 4) constant.default_value |= (uint64_t)words[4] << 32;
+        }
+        reflection.spec_constants.push_back(constant);
+    }
+
+    return true;
+}
+
+void get_spirv_set_layout_bindings(const std::vector<spirv_reflection> &stages, uint32_t set,
+                                   std::vector<VkDescriptorSetLayoutBinding> &bindings) {
+    std::map<uint32_t, VkDescriptorSetLayoutBinding> merged;
+    for (size_t s = 0; s < stages.size(); s++) {
+        for (size_t b = 0; b < stages[s].bindings.size(); b++) {
+            const spirv_binding &binding = stages[s].bindings[b];
+            if (binding.set != set) continue;
+
+            std::map<uint32_t, VkDescriptorSetLayoutBinding>::iterator it = merged.find(binding.binding);
+            if (it == merged.end()) {
+                VkDescriptorSetLayoutBinding layout_binding = {};
+                layout_binding.binding = binding.binding;
+                layout_binding.descriptorType = binding.type;
+                layout_binding.descriptorCount = binding.count;
+                layout_binding.stageFlags = stages[s].stage;
+                layout_binding.pImmutableSamplers = NULL;
+                merged[binding.binding] = layout_binding;
+            } else {
+                it->second.descriptorCount = std::max(it->second.descriptorCount, binding.count);
+                it->second.stageFlags |= stages[s].stage;
+            }
+        }
+    }
+
+    bindings.clear();
+    for (std::map<uint32_t, VkDescriptorSetLayoutBinding>::const_iterator it = merged.begin(); it != merged.end(); ++it)
+        bindings.push_back(it->second);
+}
+
+void get_spirv_push_constant_ranges(const std::vector<spirv_reflection> &stages, std::vector<VkPushConstantRange> &ranges) {
+    ranges.clear();
+    for (size_t s = 0; s < stages.size(); s++) {
+        if (stages[s].push_constants.size > 0) ranges.push_back(stages[s].push_constants);
+    }
+}
+
+uint32_t find_spirv_constant_id(const spirv_module &module, uint32_t value) {
+    size_t offset = 0;
+    spirv_instruction inst;
+    while (next_spirv_instruction(module, offset, inst)) {
+        if (inst.opcode == SPIRV_OP_CONSTANT && inst.word_count == 4 && inst.words[3] == value) return inst.words[2];
+    }
+    return 0;
+}
+
+size_t find_spirv_constant_word(const spirv_module &module, uint32_t result_id) {
+    size_t offset = 0;
+    spirv_instruction inst;
+    while (next_spirv_instruction(module, offset, inst)) {
+        if ((inst.opcode == SPIRV_OP_CONSTANT || inst.opcode == SPIRV_OP_SPEC_CONSTANT) && inst.word_count >= 4 &&
+            inst.words[2] == result_id)
+            return inst.offset + 3;
+    }
+    return 0;
+}
+
+bool patch_spirv_constant(uint32_t *code, size_t code_size, uint32_t result_id, uint32_t value) {
+    spirv_module module;
+    if (!parse_spirv_module(code, code_size, module)) return false;
+
+    const size_t word = find_spirv_constant_word(module, result_id);
+    if (word == 0 || spirv_word_count(&code[word - 3]) != 4) return false;
+
+    code[word] = value;
+    return true;
+}
+
+/* Looks up the data specialization gives spec_id, if any */
+static bool find_specialization_data(const VkSpecializationInfo *specialization, uint32_t spec_id, const uint8_t *&data,
+                                     size_t &size) {
+    if (!specialization) return false;
+    for (uint32_t i = 0; i < specialization->mapEntryCount; i++) {
+        const VkSpecializationMapEntry &entry = specialization->pMapEntries[i];
+        if (entry.constantID != spec_id) continue;
+        if (entry.offset > specialization->dataSize || entry.size > specialization->dataSize - entry.offset) return false;
+
+        data = (const uint8_t *)specialization->pData + entry.offset;
+        size = entry.size;
+        return true;
+    }
+    return false;
+}
+
+bool bake_spirv_specialization(const uint32_t *code, size_t code_size, const VkSpecializationInfo *specialization,
+                               std::vector<uint32_t> &baked) {
+    baked.clear();
+
+    spirv_module module;
+    if (!parse_spirv_module(code, code_size, module)) return false;
+    baked.reserve(module.word_count);
+    baked.assign(code, code + SPIRV_HEADER_WORDS);
+
+    /* SpecId of each result ID, and whether one was given.  Decorations
+     * come before the constants, so one walk is enough. */
+    std::vector<uint32_t> spec_ids(module.bound, 0);
+    std::vector<bool> has_spec_id(module.bound, false);
+    /* scalar types by result ID, as width and signedness */
+    std::vector<uint32_t> widths(module.bound, 0);
+    std::vector<bool> is_signed(module.bound, false);
+    /* results that stay specialization constants */
+    std::vector<bool> still_spec(module.bound, false);
+
+    size_t offset = 0;
+    spirv_instruction inst;
+    while (next_spirv_instruction(module, offset, inst)) {
+        const uint32_t *words = inst.words;
+
+        switch (inst.opcode) {
+            case SPIRV_OP_DECORATE:
+                if (inst.word_count == 4 && words[2] == SPIRV_DECORATION_SPEC_ID && words[1] < module.bound) {
+                    spec_ids[words[1]] = words[3];
+                    has_spec_id[words[1]] = true;
+                    continue;
+                }
+                break;
+            case SPIRV_OP_TYPE_INT:
+            case SPIRV_OP_TYPE_FLOAT:
+                if (inst.word_count >= 3 && words[1] < module.bound) {
+                    widths[words[1]] = words[2];
+                    is_signed[words[1]] = (inst.opcode == SPIRV_OP_TYPE_INT && inst.word_count >= 4 && words[3] != 0);
+                }
+                break;
+            case SPIRV_OP_SPEC_CONSTANT_TRUE:
+            case SPIRV_OP_SPEC_CONSTANT_FALSE: {
+                if (inst.word_count != 3 || words[2] >= module.bound) return false;
+
+                bool value = (inst.opcode == SPIRV_OP_SPEC_CONSTANT_TRUE);
+                const uint8_t *data;
+                size_t size;
+                if (has_spec_id[words[2]] && find_specialization_data(specialization, spec_ids[words[2]], data, size)) {
+                    VkBool32 b;
+                    if (size != sizeof(b)) return false;
+                    memcpy(&b, data, sizeof(b));
+                    value = (b != VK_FALSE);
+                }
+
+                baked.push_back(spirv_instruction_word(value ? SPIRV_OP_CONSTANT_TRUE : SPIRV_OP_CONSTANT_FALSE, 3));
+                baked.push_back(words[1]);
+                baked.push_back(words[2]);
+                continue;
+            }
+            case SPIRV_OP_SPEC_CONSTANT: {
+                if (inst.word_count < 4 || words[1] >= module.bound || words[2] >= module.bound) return false;
+
+                baked.push_back(spirv_instruction_word(SPIRV_OP_CONSTANT, inst.word_count));
+                baked.push_back(words[1]);
+                baked.push_back(words[2]);
+                const size_t value_word = baked.size();
+                baked.insert(baked.end(), words + 3, words + inst.word_count);
+
+                const uint8_t *data;
+                size_t size;
+                if (has_spec_id[words[2]] && find_specialization_data(specialization, spec_ids[words[2]], data, size)) {
+                    const uint32_t width = widths[words[1]];
+                    if (size * 8 != width || size > (inst.word_count - 3) * sizeof(uint32_t)) return false;
+
+                    /* literals narrower than a word are sign extended when signed */
+                    uint64_t value = 0;
+                    memcpy(&value, data, size);
+                    if (width < 32 && is_signed[words[1]] && (value >> (width - 1)) & 1) value |= ~0ull << width;
+
+                    baked[value_word] = (uint32_t)value;
+                    if (inst.word_count > 4) baked[value_word + 1] = (uint32_t)(value >> 32);
+                }
+                continue;
+            }
+            case SPIRV_OP_SPEC_CONSTANT_COMPOSITE: {
+                if (inst.word_count < 3 || words[2] >= module.bound) return false;
+
+                bool from_spec = false;
+                for (uint32_t i = 3; i < inst.word_count; i++) {
+                    if (words[i] < module.bound && still_spec[words[i]]) from_spec = true;
+                }
+                if (from_spec) {
+                    still_spec[words[2]] = true;
+                    break;
+                }
+
+                baked.push_back(spirv_instruction_word(SPIRV_OP_CONSTANT_COMPOSITE, inst.word_count));
+                baked.insert(baked.end(), words + 1, words + inst.word_count);
+                continue;
+            }
+            case SPIRV_OP_SPEC_CONSTANT_OP:
+                if (inst.word_count >= 3 && words[2] < module.bound) still_spec[words[2]] = true;
+                break;
+        }
+
+        baked.insert(baked.end(), words, words + inst.word_count);
+    }
+
+    /* a truncated instruction stops the walk early */
+    return offset == module.word_count;
+}
@@ -0,0 +1,121 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_SPIRV_HPP
+#define UTIL_SPIRV_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+/*
+ * Reads and rewrites SPIR-V modules at run time, without glslang or
+ * SPIRV-Tools: walking the instructions, reflecting the resources a module
+ * uses, patching constants and baking specialization constants in.
+ *
+ * A spirv_module points at the words of the module; nothing is copied or
+ * allocated to walk it.  None of these functions validate the module beyond
+ * its header and the length of each instruction, so they expect what a
+ * front end emits.
+ */
+
+struct spirv_module {
+    const uint32_t *code;
+    size_t word_count;
+    /* every result ID is below this */
+    uint32_t bound;
+};
+
+struct spirv_instruction {
+    uint32_t opcode;
+    uint32_t word_count;
+    /* words[0] holds the opcode and word count, operands follow */
+    const uint32_t *words;
+    /* of words[0] in the module */
+    size_t offset;
+};
+
+/* Checks the header of code_size bytes of SPIR-V */
+bool parse_spirv_module(const uint32_t *code, size_t code_size, spirv_module &module);
+
+/* Reads the instruction at offset, which starts at 0, and moves offset to
+ * the next one.  Returns false at the end or on a malformed instruction. */
+bool next_spirv_instruction(const spirv_module &module, size_t &offset, spirv_instruction &inst);
+
+struct spirv_binding {
+    uint32_t set;
+    uint32_t binding;
+    /* uniform and storage buffers are never reported as dynamic */
+    VkDescriptorType type;
+    /* 0 for a runtime array, which the caller has to size */
+    uint32_t count;
+    uint32_t variable_id;
+};
+
+struct spirv_spec_constant {
+    uint32_t spec_id;
+    uint32_t result_id;
+    /* in bytes, as VkSpecializationMapEntry::size expects it */
+    uint32_t size;
+    bool is_bool;
+    uint64_t default_value;
+};
+
+struct spirv_reflection {
+    /* of the first entry point */
+    VkShaderStageFlagBits stage;
+    std::string entry_point;
+
+    std::vector<spirv_binding> bindings;
+    /* size is 0 when the module has no push constants */
+    VkPushConstantRange push_constants;
+    std::vector<spirv_spec_constant> spec_constants;
+};
+
+bool reflect_spirv(const spirv_module &module, spirv_reflection &reflection);
+
+/* The bindings of set across the stages of a pipeline, merged by binding
+ * number and sorted, ready for a VkDescriptorSetLayoutCreateInfo */
+void get_spirv_set_layout_bindings(const std::vector<spirv_reflection> &stages, uint32_t set,
+                                   std::vector<VkDescriptorSetLayoutBinding> &bindings);
+
+/* A push constant range per stage that has push constants */
+void get_spirv_push_constant_ranges(const std::vector<spirv_reflection> &stages, std::vector<VkPushConstantRange> &ranges);
+
+/* Result ID of the first 32-bit scalar OpConstant holding value, or 0 */
+uint32_t find_spirv_constant_id(const spirv_module &module, uint32_t value);
+
+/* Offset of the first value word of the OpConstant or OpSpecConstant
+ * result_id, or 0 when there is none.  Patching a copy of the module at the
+ * offset changes the constant without walking the module again. */
+size_t find_spirv_constant_word(const spirv_module &module, uint32_t result_id);
+
+/* Sets the 32-bit scalar constant result_id of code_size bytes of SPIR-V */
+bool patch_spirv_constant(uint32_t *code, size_t code_size, uint32_t result_id, uint32_t value);
+
+/*
+ * Writes to baked a copy of code_size bytes of SPIR-V in which every
+ * specialization constant is an ordinary constant, holding its value in
+ * specialization when that maps its SpecId, or its default otherwise, so
+ * that the module no longer needs pSpecializationInfo.  OpSpecConstantOp
+ * and the composites built from it stay specialization constants, computed
+ * from constants.  Returns false when the module is malformed or an entry
+ * of specialization does not fit its constant.
+ */
+bool bake_spirv_specialization(const uint32_t *code, size_t code_size, const VkSpecializationInfo *specialization,
+                               std::vector<uint32_t> &baked);
+
+#endif  // UTIL_SPIRV_HPP
@@ -0,0 +1,275 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util_init.hpp"
+#include <assert.h>
+#include <string.h>
+
+/* 64-bit FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/ */
+#define FNV_OFFSET_BASIS 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/* Only for scalars and handles, which have no padding to hash */
+template <typename T>
+static uint64_t hash_value(uint64_t hash, const T &value) {
+    return hash_bytes(hash, &value, sizeof(value));
+}
+
+size_t variant_key_hash::operator()(const variant_key &key) const {
+    return (size_t)hash_bytes(key.desc_hash, key.data.data(), key.data.size());
+}
+
+uint64_t hash_pipeline_desc(struct sample_info &info, const pipeline_desc &desc) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = hash_value(hash, desc.include_depth);
+    hash = hash_value(hash, desc.include_vi);
+    hash = hash_value(hash, desc.topology);
+    hash = hash_value(hash, desc.cull_mode);
+    hash = hash_value(hash, desc.front_face);
+    hash = hash_value(hash, desc.depth_compare_op);
+    /* what desc leaves to info as init_variant_job resolves it, so a variant
+     * made before a resize is not found after it */
+    hash = hash_value(hash, desc.render_pass ? desc.render_pass : info.render_pass);
+#ifdef __ANDROID__
+    /* elsewhere the viewport is dynamic and the extent unused */
+    const bool use_info_extent = (desc.extent.width == 0 && desc.extent.height == 0);
+    hash = hash_value(hash, use_info_extent ? info.width : desc.extent.width);
+    hash = hash_value(hash, use_info_extent ? info.height : desc.extent.height);
+#endif
+
+    const VkPipelineShaderStageCreateInfo *stages = desc.stages ? desc.stages : info.shaderStages;
+    for (uint32_t i = 0; i < 2; i++) {
+        hash = hash_value(hash, stages[i].flags);
+        hash = hash_value(hash, stages[i].stage);
+        hash = hash_value(hash, stages[i].module);
+        hash = hash_bytes(hash, stages[i].pName, strlen(stages[i].pName) + 1);
+
+        const VkSpecializationInfo *spec = stages[i].pSpecializationInfo;
+        if (!spec) continue;
+        for (uint32_t j = 0; j < spec->mapEntryCount; j++) {
+            hash = hash_value(hash, spec->pMapEntries[j].constantID);
+            hash = hash_value(hash, spec->pMapEntries[j].offset);
+            hash = hash_value(hash, spec->pMapEntries[j].size);
+        }
+        hash = hash_bytes(hash, spec->pData, spec->dataSize);
+    }
+    return hash;
+}
+
+/* Copies desc and its stages into job, along with what it leaves to info,
+ * which the thread using the cache may change while the job waits, as
+ * execute_frame_loop_frame does with the extent on a resize */
+static void init_variant_job(variant_cache &vc, const pipeline_desc &desc, variant_job &job) {
+    const VkPipelineShaderStageCreateInfo *stages = desc.stages ? desc.stages : vc.info->shaderStages;
+    job.desc = desc;
+    job.stages[0] = stages[0];
+    job.stages[1] = stages[1];
+    if (job.desc.extent.width == 0 && job.desc.extent.height == 0) {
+        job.desc.extent.width = vc.info->width;
+        job.desc.extent.height = vc.info->height;
+    }
+    if (!job.desc.render_pass) job.desc.render_pass = vc.info->render_pass;
+    job.pipeline = VK_NULL_HANDLE;
+    job.result = VK_NOT_READY;
+    job.duration_ns = 0;
+}
+
+/* Safe to call from several threads at once */
+static void create_variant(variant_cache &vc, variant_job &job) {
+    VkSpecializationInfo spec = {};
+    spec.mapEntryCount = (uint32_t)vc.map_entries.size();
+    spec.pMapEntries = vc.map_entries.data();
+    spec.dataSize = job.key.data.size();
+    spec.pData = job.key.data.data();
+    job.stages[vc.stage].pSpecializationInfo = &spec;
+    job.desc.stages = job.stages;
+
+    const timestamp_t start = get_nanoseconds();
+    job.result = init_pipeline(*vc.info, vc.cache, job.desc, job.pipeline);
+    job.duration_ns = get_nanoseconds() - start;
+
+    /* neither points anywhere useful once the job moves */
+    job.stages[vc.stage].pSpecializationInfo = NULL;
+    job.desc.stages = NULL;
+    if (job.result != VK_SUCCESS) job.pipeline = VK_NULL_HANDLE;
+}
+
+static void finish_variant(variant_cache &vc, variant_job &job) {
+    variant_entry &entry = vc.variants[job.key];
+    entry.pipeline = job.pipeline;
+    entry.pending = false;
+
+    if (job.result == VK_SUCCESS)
+        vc.variants_created++;
+    else
+        vc.creation_failures++;
+    vc.creation_ns += job.duration_ns;
+}
+
+static void execute_variant_thread(variant_cache *vc) {
+    std::unique_lock<std::mutex> lock(vc->mutex);
+    for (;;) {
+        while (!vc->quit && vc->queue.empty()) vc->cond.wait(lock);
+        if (vc->quit) break;
+
+        variant_job job = std::move(vc->queue.front());
+        vc->queue.pop_front();
+        vc->busy++;
+        lock.unlock();
+
+        create_variant(*vc, job);
+
+        lock.lock();
+        vc->done.push_back(std::move(job));
+        vc->busy--;
+        vc->cond.notify_all();
+    }
+}
+
+void init_variant_cache(struct sample_info &info, variant_cache &vc, VkPipelineCache cache, uint32_t stage,
+                        const std::vector<VkSpecializationMapEntry> &map_entries, size_t data_size, uint32_t thread_count) {
+    assert(stage < 2);
+
+    vc.info = &info;
+    vc.cache = cache;
+    vc.stage = stage;
+    vc.map_entries = map_entries;
+    vc.data_size = data_size;
+    vc.lookup.desc_hash = 0;
+    vc.lookup.data.reserve(data_size);
+
+    vc.busy = 0;
+    vc.quit = false;
+    vc.hits = 0;
+    vc.misses = 0;
+    vc.fallback_draws = 0;
+    vc.variants_created = 0;
+    vc.creation_failures = 0;
+    vc.creation_ns = 0;
+
+    for (uint32_t i = 0; i < thread_count; i++) vc.threads.push_back(std::thread(execute_variant_thread, &vc));
+}
+
+/* desc with the specialized stage left at its default constants */
+static VkPipeline get_fallback_pipeline(variant_cache &vc, const pipeline_desc &desc, uint64_t desc_hash) {
+    std::unordered_map<uint64_t, VkPipeline>::const_iterator it = vc.fallbacks.find(desc_hash);
+    if (it != vc.fallbacks.end()) return it->second;
+
+    variant_job job;
+    init_variant_job(vc, desc, job);
+    job.stages[vc.stage].pSpecializationInfo = NULL;
+    job.desc.stages = job.stages;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult U_ASSERT_ONLY res = init_pipeline(*vc.info, vc.cache, job.desc, pipeline);
+    assert(res == VK_SUCCESS);
+
+    vc.fallbacks[desc_hash] = pipeline;
+    return pipeline;
+}
+
+VkPipeline get_variant_pipeline(variant_cache &vc, const pipeline_desc &desc, const void *data) {
+    const uint64_t desc_hash = hash_pipeline_desc(*vc.info, desc);
+
+    /* reuses the memory of the lookup key rather than allocating a key each time */
+    vc.lookup.desc_hash = desc_hash;
+    vc.lookup.data.assign((const uint8_t *)data, (const uint8_t *)data + vc.data_size);
+
+    std::unordered_map<variant_key, variant_entry, variant_key_hash>::const_iterator it = vc.variants.find(vc.lookup);
+    if (it != vc.variants.end() && it->second.pipeline != VK_NULL_HANDLE) {
+        vc.hits++;
+        return it->second.pipeline;
+    }
+
+    if (it == vc.variants.end()) {
+        vc.misses++;
+
+        variant_job job;
+        job.key = vc.lookup;
+        init_variant_job(vc, desc, job);
+
+        if (vc.threads.empty()) {
+            create_variant(vc, job);
+            finish_variant(vc, job);
+            if (job.pipeline != VK_NULL_HANDLE) return job.pipeline;
+        } else {
+            variant_entry &entry = vc.variants[vc.lookup];
+            entry.pipeline = VK_NULL_HANDLE;
+            entry.pending = true;
+
+            std::lock_guard<std::mutex> lock(vc.mutex);
+            vc.queue.push_back(std::move(job));
+            vc.cond.notify_all();
+        }
+    }
+
+    vc.fallback_draws++;
+    return get_fallback_pipeline(vc, desc, desc_hash);
+}
+
+void execute_variant_cache_update(variant_cache &vc) {
+    std::vector<variant_job> done;
+    {
+        std::lock_guard<std::mutex> lock(vc.mutex);
+        done.swap(vc.done);
+    }
+
+    for (size_t i = 0; i < done.size(); i++) finish_variant(vc, done[i]);
+}
+
+void execute_variant_cache_flush(variant_cache &vc) {
+    {
+        std::unique_lock<std::mutex> lock(vc.mutex);
+        while (!vc.queue.empty() || vc.busy) vc.cond.wait(lock);
+    }
+
+    execute_variant_cache_update(vc);
+}
+
+void destroy_variant_cache(variant_cache &vc) {
+    {
+        std::lock_guard<std::mutex> lock(vc.mutex);
+        vc.quit = true;
+        vc.queue.clear();
+        vc.cond.notify_all();
+    }
+    for (size_t i = 0; i < vc.threads.size(); i++) vc.threads[i].join();
+    vc.threads.clear();
+
+    /* pipelines created since the last update are destroyed with the rest */
+    execute_variant_cache_update(vc);
+
+    for (std::unordered_map<variant_key, variant_entry, variant_key_hash>::const_iterator it = vc.variants.begin();
+         it != vc.variants.end(); ++it) {
+        if (it->second.pipeline != VK_NULL_HANDLE) vkDestroyPipeline(vc.info->device, it->second.pipeline, NULL);
+    }
+    for (std::unordered_map<uint64_t, VkPipeline>::const_iterator it = vc.fallbacks.begin(); it != vc.fallbacks.end(); ++it)
+        vkDestroyPipeline(vc.info->device, it->second, NULL);
+
+    vc.variants.clear();
+    vc.fallbacks.clear();
+}
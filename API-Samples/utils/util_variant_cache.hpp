@@ -0,0 +1,138 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_VARIANT_CACHE_HPP
+#define UTIL_VARIANT_CACHE_HPP
+
+/* util.hpp has no include guard, so this expects to be included after it */
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+
+/*
+ * Pipelines for the specializations of an ubershader, created as they are
+ * first asked for.
+ *
+ * A variant is a pipeline description together with the data of the
+ * specialization constants of one of its stages.  The first time a variant
+ * is asked for, get_variant_pipeline queues it for a background thread and
+ * returns the fallback pipeline of the description, the ubershader with
+ * its default constants, so that the frame does not wait for the driver.
+ * The threads create variants in a pipeline cache they share, and
+ * execute_variant_cache_update, called once a frame, swaps in those that
+ * are done.  With no threads, variants are created on the spot instead,
+ * which is what the background threads avoid.
+ *
+ * A variant cache is used from one thread, apart from its own threads.
+ * Its pipelines live as long as it does.
+ */
+
+/* A variant: the hash of a description and the specialization data */
+struct variant_key {
+    uint64_t desc_hash;
+    std::vector<uint8_t> data;
+
+    bool operator==(const variant_key &other) const { return desc_hash == other.desc_hash && data == other.data; }
+};
+
+struct variant_key_hash {
+    size_t operator()(const variant_key &key) const;
+};
+
+struct variant_entry {
+    /* VK_NULL_HANDLE until created, or when creation failed */
+    VkPipeline pipeline;
+    bool pending;
+};
+
+/* A variant for a background thread to create, and then its result */
+struct variant_job {
+    variant_key key;
+    pipeline_desc desc;
+    VkPipelineShaderStageCreateInfo stages[2];
+    VkPipeline pipeline;
+    VkResult result;
+    timestamp_t duration_ns;
+};
+
+struct variant_cache {
+    struct sample_info *info;
+    VkPipelineCache cache;
+
+    /* the stage that is specialized, how, and the size of its data */
+    uint32_t stage;
+    std::vector<VkSpecializationMapEntry> map_entries;
+    size_t data_size;
+
+    /* only touched by the thread using the cache */
+    std::unordered_map<variant_key, variant_entry, variant_key_hash> variants;
+    std::unordered_map<uint64_t, VkPipeline> fallbacks;
+    variant_key lookup;
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<variant_job> queue;
+    std::vector<variant_job> done;
+    /* jobs taken off the queue and not done yet */
+    uint32_t busy;
+    bool quit;
+
+    uint64_t hits;
+    uint64_t misses;
+    /* lookups answered with the fallback, misses included */
+    uint64_t fallback_draws;
+    uint64_t variants_created;
+    uint64_t creation_failures;
+    /* spent creating variants, on any thread */
+    timestamp_t creation_ns;
+};
+
+/*
+ * Specializes stage, an index into the stages of the descriptions, with
+ * map_entries over data_size bytes of data.  Variants are created in
+ * cache, which may be VK_NULL_HANDLE, on thread_count threads.
+ */
+void init_variant_cache(struct sample_info &info, variant_cache &vc, VkPipelineCache cache, uint32_t stage,
+                        const std::vector<VkSpecializationMapEntry> &map_entries, size_t data_size, uint32_t thread_count = 1);
+
+/* Hash of everything init_pipeline uses for desc, shader modules and entry
+ * points included, and the render pass and extent it takes from info */
+uint64_t hash_pipeline_desc(struct sample_info &info, const pipeline_desc &desc);
+
+/*
+ * The pipeline of desc specialized with data, vc.data_size bytes of it, or
+ * the fallback pipeline of desc while that is not created yet.  The stages of
+ * desc are copied, but what they point to, shader modules included, must
+ * stay valid until the cache is destroyed.  The fallback of a description
+ * is created here the first time it is used.
+ */
+VkPipeline get_variant_pipeline(variant_cache &vc, const pipeline_desc &desc, const void *data);
+
+/* Swaps in the variants created since the last call */
+void execute_variant_cache_update(variant_cache &vc);
+
+/* Waits until no variant is queued or being created, and swaps them in */
+void execute_variant_cache_flush(variant_cache &vc);
+
+/* Abandons queued variants and destroys every pipeline */
+void destroy_variant_cache(variant_cache &vc);
+
+#endif  // UTIL_VARIANT_CACHE_HPP
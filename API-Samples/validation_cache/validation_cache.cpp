@@ -25,6 +25,8 @@ Create and use a validation cache across runs.
 
 #include <util_init.hpp>
 #include <array>
+#include <atomic>
+#include <thread>
 #include <assert.h>
 #include <string.h>
 #include <cstdlib>
@@ -38,17 +40,12 @@ Create and use a validation cache across runs.
 // caches could be created and merged.
 
 // The fragment shader contains a 32-bit integer constant (tweak_value)
-// which we can search for in the compiled SPIRV and replace with new
-// values to generate "different" shaders.
+// which we can find in the compiled SPIRV and replace with new values to
+// generate "different" shaders.
 
-struct ShaderVariant {
-    std::vector<uint32_t> spv;
-#if defined(VK_EXT_validation_cache)
-    VkShaderModuleValidationCacheCreateInfoEXT moduleValidationCacheCreateInfo;
-#endif
-    VkShaderModuleCreateInfo moduleCreateInfo;
-    VkShaderModule module;
-};
+// The variants are created on a pool of threads to measure how module
+// creation, and validation with the cache cold and warm, scales with the
+// thread count.
 
 int sample_main(int argc, char *argv[]) {
     VkResult U_ASSERT_ONLY res;
@@ -258,54 +255,134 @@ int sample_main(int argc, char *argv[]) {
     // Generate a set of "different" SPIRV modules by patching in new
     // values for tweak_value in the fragment shader.
 
-    int32_t tweakValueIndex = -1;
-    for (size_t i = 0; i < sizeof(validation_cache_frag); ++i) {
-        if (validation_cache_frag[i] == 0xdeadbeef) {
-            tweakValueIndex = i;
-            break;
+    // The constant is looked up by value once, rather than by scanning for
+    // a word that may as well be an ID or a literal of another instruction,
+    // and each variant then patches its value word directly.
+    const size_t shaderWords = sizeof(validation_cache_frag) / sizeof(validation_cache_frag[0]);
+    spirv_module fragModule;
+    bool U_ASSERT_ONLY parsed = parse_spirv_module(validation_cache_frag, sizeof(validation_cache_frag), fragModule);
+    assert(parsed);
+    const uint32_t tweakValueId = find_spirv_constant_id(fragModule, 0xdeadbeef);
+    const size_t tweakValueIndex = find_spirv_constant_word(fragModule, tweakValueId);
+    assert(tweakValueIndex != 0);
+
+    // Each variant is written into a shared arena by the thread that creates
+    // its module, just before creating it, rather than all of them being
+    // copied up front.
+    const size_t SHADER_COUNT = 10000;
+    std::vector<uint32_t> arena(SHADER_COUNT * shaderWords);
+    std::vector<VkShaderModule> modules(SHADER_COUNT, VK_NULL_HANDLE);
+
+    auto createVariant = [&](size_t i, const void *moduleNext) {
+        uint32_t *spv = &arena[i * shaderWords];
+        memcpy(spv, validation_cache_frag, sizeof(validation_cache_frag));
+        spv[tweakValueIndex] = (uint32_t)i;
+
+        VkShaderModuleCreateInfo moduleCreateInfo = {};
+        moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleCreateInfo.pNext = moduleNext;
+        moduleCreateInfo.codeSize = sizeof(validation_cache_frag);
+        moduleCreateInfo.pCode = spv;
+        moduleCreateInfo.flags = 0;
+        VkResult U_ASSERT_ONLY res = vkCreateShaderModule(info.device, &moduleCreateInfo, NULL, &modules[i]);
+        assert(res == VK_SUCCESS);
+    };
+
+    // Time spent and modules created by each thread, over all the trials of
+    // a thread count
+    std::vector<timestamp_t> threadTimes;
+    std::vector<size_t> threadModules;
+
+    // Threads take the next variant until there are none left
+    auto createModules = [&](uint32_t threadCount, const void *moduleNext) {
+        std::atomic<size_t> next(0);
+        auto work = [&](uint32_t thread) {
+            scoped_timer timer(threadTimes[thread]);
+            for (size_t i = next++; i < SHADER_COUNT; i = next++) {
+                createVariant(i, moduleNext);
+                threadModules[thread]++;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 1; t < threadCount; t++) threads.push_back(std::thread(work, t));
+        work(0);
+        for (auto &thread : threads) thread.join();
+    };
+    auto destroyModules = [&]() {
+        for (auto &module : modules) {
+            vkDestroyShaderModule(info.device, module, NULL);
+            module = VK_NULL_HANDLE;
         }
-    }
-    assert(tweakValueIndex >= 0);
+    };
+
+    const uint32_t trials = get_bench_trials(info, 5);
+    std::vector<bench_result> results;
+    auto benchModules = [&](const char *cacheState, uint32_t threadCount, const std::function<void()> &setup,
+                            const void *moduleNext, const std::function<void()> &teardown) {
+        threadTimes.assign(threadCount, 0);
+        threadModules.assign(threadCount, 0);
+
+        char name[96];
+        snprintf(name, sizeof(name), "vkCreateShaderModule, %u thread(s), %s", threadCount, cacheState);
+        results.push_back(run_bench_trials(name, trials, setup, [&]() { createModules(threadCount, moduleNext); },
+                                           [&]() {
+                                               destroyModules();
+                                               if (teardown) teardown();
+                                           }));
+
+        double minRate = 0.0, maxRate = 0.0;
+        for (uint32_t t = 0; t < threadCount; t++) {
+            const double rate = threadTimes[t] ? threadModules[t] / (threadTimes[t] / 1000000000.0) : 0.0;
+            if (t == 0 || rate < minRate) minRate = rate;
+            if (t == 0 || rate > maxRate) maxRate = rate;
+        }
+        printf("  %u thread(s), %s: %.0f modules/s, %.0f to %.0f modules/s per thread\n", threadCount, cacheState,
+               SHADER_COUNT / (results.back().median_ms / 1000.0), minRate, maxRate);
+    };
 
-    // Generate the unique variants from the template
-    const size_t SHADER_COUNT = 10000;
-    std::vector<ShaderVariant> shaderVariants(SHADER_COUNT);
-    for (size_t i = 0; i < SHADER_COUNT; ++i) {
-        auto ptr = const_cast<uint32_t *>(validation_cache_frag);
-        shaderVariants[i].spv = std::vector<uint32_t>(ptr, ptr + sizeof(validation_cache_frag));
-        shaderVariants[i].spv[tweakValueIndex] = i;
+    const std::vector<uint32_t> threadCounts = get_bench_thread_counts(info);
 #if defined(VK_EXT_validation_cache)
-        shaderVariants[i].moduleValidationCacheCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT;
-        shaderVariants[i].moduleValidationCacheCreateInfo.pNext = 0;
-        shaderVariants[i].moduleValidationCacheCreateInfo.validationCache = validationCache;
-        shaderVariants[i].moduleCreateInfo.pNext = &shaderVariants[i].moduleValidationCacheCreateInfo;
-#endif
-        shaderVariants[i].moduleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        shaderVariants[i].moduleCreateInfo.codeSize = sizeof(validation_cache_frag);
-        shaderVariants[i].moduleCreateInfo.pCode = shaderVariants[i].spv.data();
-        shaderVariants[i].moduleCreateInfo.flags = 0;
-    }
-
-    // Time (roughly) taken to create (and validate) the shader modules.
-    timestamp_t start = get_milliseconds();
-    for (auto &variant : shaderVariants) {
-        res = vkCreateShaderModule(info.device, &variant.moduleCreateInfo, NULL, &variant.module);
+    VkShaderModuleValidationCacheCreateInfoEXT moduleValidationCacheCreateInfo;
+    moduleValidationCacheCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT;
+    moduleValidationCacheCreateInfo.pNext = NULL;
+    const void *moduleNext = &moduleValidationCacheCreateInfo;
+
+    // Cold: every trial validates the variants into a new, empty cache
+    VkValidationCacheCreateInfoEXT emptyCacheCreateInfo = validationCacheCreateInfo;
+    emptyCacheCreateInfo.initialDataSize = 0;
+    emptyCacheCreateInfo.pInitialData = NULL;
+    auto createEmptyCache = [&]() {
+        VkResult U_ASSERT_ONLY res = vkCreateValidationCache(info.device, &emptyCacheCreateInfo, nullptr,
+                                                             &moduleValidationCacheCreateInfo.validationCache);
         assert(res == VK_SUCCESS);
-    }
-    timestamp_t elapsed = get_milliseconds() - start;
-    printf("  vkCreateShaderModule time: %0.f ms for %u calls\n", static_cast<double>(elapsed),
-           static_cast<uint32_t>(SHADER_COUNT));
-
-    // Delete module variants
-    for (auto &variant : shaderVariants) {
-        vkDestroyShaderModule(info.device, variant.module, NULL);
-    }
+    };
+    auto destroyEmptyCache = [&]() {
+        vkDestroyValidationCache(info.device, moduleValidationCacheCreateInfo.validationCache, NULL);
+    };
+    for (uint32_t threadCount : threadCounts)
+        benchModules("cold cache", threadCount, createEmptyCache, moduleNext, destroyEmptyCache);
+
+    // Warm: the cache loaded from disk already holds the variants, unless
+    // this is the first run, so fill it first
+    moduleValidationCacheCreateInfo.validationCache = validationCache;
+    threadTimes.assign(1, 0);
+    threadModules.assign(1, 0);
+    createModules(1, moduleNext);
+    destroyModules();
+    for (uint32_t threadCount : threadCounts) benchModules("warm cache", threadCount, nullptr, moduleNext, nullptr);
+#else
+    const void *moduleNext = NULL;
+    for (uint32_t threadCount : threadCounts) benchModules("no cache", threadCount, nullptr, moduleNext, nullptr);
+#endif
+    report_bench_results(info, "validation_cache", results);
 
     // Replace the module entry of info.shaderStages with a module created with the
     // validation cache active
     vkDestroyShaderModule(info.device, info.shaderStages[1].module, NULL);
-    res = vkCreateShaderModule(info.device, &shaderVariants[0].moduleCreateInfo, NULL, &info.shaderStages[1].module);
-    assert(res == VK_SUCCESS);
+    createVariant(0, moduleNext);
+    info.shaderStages[1].module = modules[0];
+    modules[0] = VK_NULL_HANDLE;
 
     // Begin standard draw stuff
     init_pipeline(info, depthPresent);
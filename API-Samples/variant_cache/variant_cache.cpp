@@ -0,0 +1,221 @@
+/*
+ * Vulkan Samples
+ *
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+VULKAN_SAMPLE_SHORT_DESCRIPTION
+Create specialized pipelines of an ubershader in the background while drawing
+*/
+
+#include <util_init.hpp>
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include "cube_data.h"
+
+#define FRAME_COUNT 240
+#define DRAWS_PER_FRAME 16
+/* with the textured variant, COLOR_LEVELS^3 + 1 variants can be asked for */
+#define COLOR_LEVELS 16
+
+/* The specialization constants of the fragment shader of spirv_specialization */
+struct material {
+    VkBool32 draw_user_color;
+    float color[3];
+};
+
+struct stress_state {
+    variant_cache *vc;
+    pipeline_desc desc;
+    std::mt19937 rng;
+};
+
+/* One in eight materials is textured, as the ubershader is by default */
+static material random_material(std::mt19937 &rng) {
+    material m = {};
+    if (rng() % 8 == 0) return m;
+
+    m.draw_user_color = VK_TRUE;
+    for (int c = 0; c < 3; c++) m.color[c] = (float)(rng() % COLOR_LEVELS) / (COLOR_LEVELS - 1);
+    return m;
+}
+
+/* Draws the cube with a new random material each time, as a scene would
+ * when materials it has not drawn before come into view */
+static void record_frame(struct sample_info &info, uint32_t frame, void *user_data) {
+    stress_state &state = *(stress_state *)user_data;
+    execute_variant_cache_update(*state.vc);
+
+    VkClearValue clear_values[2];
+    init_clear_color_and_depth(info, clear_values);
+
+    VkRenderPassBeginInfo rp_begin;
+    init_render_pass_begin_info(info, rp_begin);
+    rp_begin.clearValueCount = 2;
+    rp_begin.pClearValues = clear_values;
+
+    vkCmdBeginRenderPass(info.cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindDescriptorSets(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, info.pipeline_layout, 0, NUM_DESCRIPTOR_SETS,
+                            info.desc_set.data(), 0, NULL);
+
+    const VkDeviceSize offsets[1] = {0};
+    vkCmdBindVertexBuffers(info.cmd, 0, 1, &info.vertex_buffer.buf, offsets);
+
+    init_viewports(info);
+    init_scissors(info);
+
+    for (uint32_t i = 0; i < DRAWS_PER_FRAME; i++) {
+        const material m = random_material(state.rng);
+        vkCmdBindPipeline(info.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, get_variant_pipeline(*state.vc, state.desc, &m));
+        vkCmdDraw(info.cmd, 12 * 3, 1, 0, 0);
+    }
+
+    vkCmdEndRenderPass(info.cmd);
+}
+
+/* Runs the stress test with variants created on thread_count threads, or
+ * while recording when there are none, starting from an empty cache */
+static bench_result run_stress(struct sample_info &info, const char *name, uint32_t thread_count, bool depthPresent) {
+    const VkSpecializationMapEntry entries[] = {
+        // id, offset,                           size
+        {5, offsetof(material, draw_user_color), sizeof(VkBool32)},
+        {7, offsetof(material, color[0]), sizeof(float)},
+        {8, offsetof(material, color[1]), sizeof(float)},
+        {9, offsetof(material, color[2]), sizeof(float)},
+    };
+    const std::vector<VkSpecializationMapEntry> map_entries(entries, entries + sizeof(entries) / sizeof(entries[0]));
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    VkPipelineCache cache;
+    VkResult U_ASSERT_ONLY res = vkCreatePipelineCache(info.device, &cache_info, NULL, &cache);
+    assert(res == VK_SUCCESS);
+
+    variant_cache vc;
+    init_variant_cache(info, vc, cache, 1, map_entries, sizeof(material), thread_count);
+
+    /* the same materials in the same order for every run */
+    stress_state state;
+    state.vc = &vc;
+    init_pipeline_desc(state.desc, depthPresent);
+    state.rng.seed(1);
+
+    frame_loop loop;
+    init_frame_loop(info, loop, record_frame, &state, depthPresent, 2);
+
+    /* resizes are handled inside the frame; only a window that stays
+     * minimized ends the run early, as in execute_frame_loop */
+    std::vector<timestamp_t> frame_ns;
+    for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+        const timestamp_t start = get_nanoseconds();
+        if (!execute_frame_loop_frame(loop)) break;
+        frame_ns.push_back(get_nanoseconds() - start);
+    }
+    destroy_frame_loop(loop);
+
+    const bench_result result = compute_bench_result(name, frame_ns);
+    printf("%s: %llu variants created, %llu failed, %.2f ms each; %llu hits, %llu misses, %llu fallback draws\n", name,
+           (unsigned long long)vc.variants_created, (unsigned long long)vc.creation_failures,
+           vc.variants_created ? vc.creation_ns / 1e6 / vc.variants_created : 0.0, (unsigned long long)vc.hits,
+           (unsigned long long)vc.misses, (unsigned long long)vc.fallback_draws);
+
+    destroy_variant_cache(vc);
+    vkDestroyPipelineCache(info.device, cache, NULL);
+    return result;
+}
+
+int sample_main(int argc, char *argv[]) {
+    struct sample_info info = {};
+    char sample_title[] = "Variant Cache";
+    const bool depthPresent = true;
+
+    process_command_line_args(info, argc, argv);
+    init_global_layer_properties(info);
+    init_instance_extension_names(info);
+    init_device_extension_names(info);
+    init_instance(info, sample_title);
+    init_enumerate_device(info);
+    init_window_size(info, 500, 500);
+    init_connection(info);
+    init_window(info);
+    init_swapchain_extension(info);
+    init_device(info);
+    init_command_pool(info);
+    init_command_buffer(info);
+    execute_begin_command_buffer(info);
+    init_device_queue(info);
+    init_swap_chain(info);
+    init_depth_buffer(info);
+    init_texture(info);
+    init_uniform_buffer(info);
+    init_descriptor_and_pipeline_layouts(info, true);
+    init_renderpass(info, depthPresent);
+#include "variant_cache.vert.h"
+#include "variant_cache.frag.h"
+    VkShaderModuleCreateInfo vert_info = {};
+    VkShaderModuleCreateInfo frag_info = {};
+    vert_info.sType = frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    vert_info.codeSize = sizeof(variant_cache_vert);
+    vert_info.pCode = variant_cache_vert;
+    frag_info.codeSize = sizeof(variant_cache_frag);
+    frag_info.pCode = variant_cache_frag;
+    init_shaders(info, &vert_info, &frag_info);
+    init_framebuffers(info, depthPresent);
+    init_vertex_buffer(info, g_vb_texture_Data, sizeof(g_vb_texture_Data), sizeof(g_vb_texture_Data[0]), true);
+    init_descriptor_pool(info, true);
+    init_descriptor_set(info, true);
+
+    /* init_texture recorded its upload into info.cmd */
+    execute_end_command_buffer(info);
+    execute_queue_command_buffer(info);
+
+    /* VULKAN_KEY_START */
+
+    /* Creating each new variant while recording stalls the frame on the
+     * driver's compiler.  Drawing with the fallback instead, while threads
+     * create the variant, keeps frame times even; the variant shows up a
+     * few frames later.  One core is left for recording. */
+    const uint32_t background_threads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+    std::vector<bench_result> results;
+    results.push_back(run_stress(info, "synchronous creation", 0, depthPresent));
+    results.push_back(run_stress(info, "background creation", background_threads, depthPresent));
+    report_bench_results(info, "variant_cache", results);
+
+    /* VULKAN_KEY_END */
+
+    destroy_textures(info);
+    destroy_descriptor_pool(info);
+    destroy_vertex_buffer(info);
+    destroy_framebuffers(info);
+    destroy_shaders(info);
+    destroy_renderpass(info);
+    destroy_descriptor_and_pipeline_layouts(info);
+    destroy_uniform_buffer(info);
+    destroy_depth_buffer(info);
+    destroy_swap_chain(info);
+    destroy_command_buffer(info);
+    destroy_command_pool(info);
+    destroy_device(info);
+    destroy_window(info);
+    destroy_instance(info);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Vulkan
+ *
+ * Copyright (C) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Bakes the overlay font into overlay_font.h, which is checked in, so the
+ * layer does not load and rasterize a TTF file at every vkCreateDevice.
+ * The bake_overlay_font target regenerates it.
+ *
+ * Usage: bake_font <font.ttf> <pixel height> <atlas size> <first char> <char count> <output.h>
+ *
+ * The header records the parameters it was baked with, which overlay.cpp
+ * checks against its own, and only the atlas rows holding glyphs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "stb_truetype.h"
+
+static bool read_file(char const *filename, std::vector<unsigned char> &vec) {
+    FILE *f = fopen(filename, "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    bool ok = length > 0;
+    if (ok) {
+        vec.resize(length);
+        ok = fread(&vec[0], 1, length, f) == (size_t)length;
+    }
+
+    fclose(f);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 7) {
+        fprintf(stderr, "usage: %s <font.ttf> <pixel height> <atlas size> <first char> <char count> <output.h>\n", argv[0]);
+        return 1;
+    }
+
+    const char *fontFile = argv[1];
+    const int pixelHeight = atoi(argv[2]);
+    const int atlasSize = atoi(argv[3]);
+    const int firstChar = atoi(argv[4]);
+    const int charCount = atoi(argv[5]);
+    const char *output = argv[6];
+
+    std::vector<unsigned char> fontData;
+    if (!read_file(fontFile, fontData)) {
+        fprintf(stderr, "failed to read %s\n", fontFile);
+        return 1;
+    }
+
+    std::vector<unsigned char> atlas(atlasSize * atlasSize);
+    std::vector<stbtt_bakedchar> glyphs(charCount);
+    const int rows = stbtt_BakeFontBitmap(&fontData[0], 0, (float)pixelHeight, &atlas[0], atlasSize, atlasSize, firstChar,
+                                          charCount, &glyphs[0]);
+    if (rows <= 0) {
+        fprintf(stderr, "%d glyphs of %s do not fit a %dx%d atlas\n", charCount, fontFile, atlasSize, atlasSize);
+        return 1;
+    }
+
+    FILE *f = fopen(output, "w");
+    if (!f) {
+        fprintf(stderr, "failed to create %s\n", output);
+        return 1;
+    }
+
+    const char *name = fontFile;
+    for (const char *p = fontFile; *p; p++) {
+        if (*p == '/' || *p == '\\') name = p + 1;
+    }
+
+    fprintf(f, "/* Generated by bake_font from %s; do not edit. */\n\n", name);
+    fprintf(f, "#define OVERLAY_FONT_SIZE_PIXELS %d\n", pixelHeight);
+    fprintf(f, "#define OVERLAY_FONT_ATLAS_SIZE %d\n", atlasSize);
+    fprintf(f, "#define OVERLAY_FONT_FIRST_CHAR %d\n", firstChar);
+    fprintf(f, "#define OVERLAY_FONT_CHAR_COUNT %d\n", charCount);
+    fprintf(f, "/* rows below this are empty */\n");
+    fprintf(f, "#define OVERLAY_FONT_ATLAS_ROWS %d\n\n", rows);
+
+    fprintf(f, "static const stbtt_bakedchar overlay_font_glyphs[OVERLAY_FONT_CHAR_COUNT] = {\n");
+    for (const auto &g : glyphs) {
+        fprintf(f, "    {%u, %u, %u, %u, %.9g, %.9g, %.9g},\n", g.x0, g.y0, g.x1, g.y1, g.xoff, g.yoff, g.xadvance);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const unsigned char overlay_font_atlas[OVERLAY_FONT_ATLAS_ROWS * OVERLAY_FONT_ATLAS_SIZE] = {\n");
+    for (int i = 0; i < rows * atlasSize; i++) {
+        fprintf(f, "%s%u,%s", (i % 16) ? " " : "    ", atlas[i], (i % 16 == 15) ? "\n" : "");
+    }
+    fprintf(f, "%s};\n", (rows * atlasSize) % 16 ? "\n" : "");
+
+    const bool ok = !ferror(f);
+    fclose(f);
+
+    return ok ? 0 : 1;
+}
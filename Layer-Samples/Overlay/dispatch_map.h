@@ -0,0 +1,145 @@
+/*
+ * Vulkan
+ *
+ * Copyright (C) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DISPATCH_MAP_H
+#define DISPATCH_MAP_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+
+/*
+ * Maps dispatch keys to per-instance or per-device layer data, or other
+ * dispatchable handles to per-object data.
+ *
+ * find() is wait-free: a linear probe over a fixed, open-addressed table of
+ * atomics, so the hot entry points (vkQueueSubmit, vkQueuePresentKHR) never
+ * take a lock or touch the heap.  get_or_create() and erase() only run at
+ * instance and device creation and destruction, and are serialized by a
+ * mutex.  Erased slots become tombstones, so probes for other keys still
+ * reach them, and are reused by later keys.
+ *
+ * At most Capacity keys can be live at once.  Past that, get_or_create()
+ * returns nullptr and the caller decides how to fail.
+ */
+template <typename T, uint32_t Capacity = 256>
+class DispatchMap {
+    static_assert(Capacity && !(Capacity & (Capacity - 1)), "Capacity must be a power of two");
+
+   public:
+    DispatchMap() {
+        for (auto &slot : slots_) {
+            slot.key.store(nullptr, std::memory_order_relaxed);
+            slot.value.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~DispatchMap() {
+        for (auto &slot : slots_) delete slot.value.load(std::memory_order_relaxed);
+    }
+
+    DispatchMap(const DispatchMap &) = delete;
+    DispatchMap &operator=(const DispatchMap &) = delete;
+
+    /* Returns nullptr if key was never added */
+    T *find(void *key) const {
+        const Slot *slot = find_slot(key);
+        return slot ? slot->value.load(std::memory_order_acquire) : nullptr;
+    }
+
+    /* Returns the data for key, value-initialized when first added, or
+     * nullptr when key is new and Capacity keys are already live */
+    T *get_or_create(void *key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        T *value = find(key);
+        if (value) return value;
+
+        uint32_t i = hash(key);
+        for (uint32_t n = 0; n < Capacity; n++, i = (i + 1) & (Capacity - 1)) {
+            void *k = slots_[i].key.load(std::memory_order_relaxed);
+            if (k && k != tombstone()) continue;
+
+            /* publish the value before readers can match the key */
+            value = new T();
+            slots_[i].value.store(value, std::memory_order_release);
+            slots_[i].key.store(key, std::memory_order_release);
+            return value;
+        }
+
+        return nullptr;
+    }
+
+    /* Destroys the data for key.  The caller guarantees that no other thread
+     * is still using it, as Vulkan requires of the app for the dispatchable
+     * object itself. */
+    void erase(void *key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        Slot *slot = const_cast<Slot *>(find_slot(key));
+        if (!slot) return;
+
+        T *value = slot->value.load(std::memory_order_relaxed);
+        slot->key.store(tombstone(), std::memory_order_release);
+        slot->value.store(nullptr, std::memory_order_release);
+        delete value;
+    }
+
+    /* Calls f(key, value) for every entry.  Entries added or erased
+     * concurrently may or may not be visited. */
+    template <typename F>
+    void for_each(F f) const {
+        for (const auto &slot : slots_) {
+            void *k = slot.key.load(std::memory_order_acquire);
+            if (!k || k == tombstone()) continue;
+
+            T *value = slot.value.load(std::memory_order_acquire);
+            if (value) f(k, value);
+        }
+    }
+
+   private:
+    struct Slot {
+        std::atomic<void *> key;
+        std::atomic<T *> value;
+    };
+
+    static void *tombstone() { return reinterpret_cast<void *>(uintptr_t(1)); }
+
+    static uint32_t hash(void *key) {
+        /* dispatch keys are aligned pointers; the high bits of a Fibonacci
+         * hash mix the low ones in */
+        const uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<uint32_t>(h >> 32) & (Capacity - 1);
+    }
+
+    const Slot *find_slot(void *key) const {
+        uint32_t i = hash(key);
+        for (uint32_t n = 0; n < Capacity; n++, i = (i + 1) & (Capacity - 1)) {
+            void *k = slots_[i].key.load(std::memory_order_acquire);
+            if (k == key) return &slots_[i];
+            if (!k) break;
+        }
+
+        return nullptr;
+    }
+
+    Slot slots_[Capacity];
+    std::mutex mutex_;
+};
+
+#endif  // DISPATCH_MAP_H
@@ -0,0 +1,114 @@
+/*
+ * Vulkan
+ *
+ * Copyright (C) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures the per-call cost of the dispatch key lookup every intercepted
+ * entry point of the overlay layer does, as a stand-in for the layer's
+ * overhead on vkQueueSubmit against a driver that does nothing.  Compares
+ * DispatchMap with the std::unordered_map it replaced, both as it was used
+ * (unsynchronized) and behind the mutex a thread-safe version would need.
+ *
+ * Usage: overlay_dispatch_bench [threads] [lookups per thread]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "dispatch_map.h"
+
+namespace {
+
+struct fake_layer_data {
+    int submits;
+};
+
+/* Like a dispatchable object: the first word points to the loader's table */
+struct fake_object {
+    void *dispatch_table;
+};
+
+void *get_dispatch_key(const fake_object *obj) { return *(void *const *)obj; }
+
+std::unordered_map<void *, fake_layer_data *> unordered;
+std::mutex unordered_mutex;
+DispatchMap<fake_layer_data> dispatch_map;
+
+template <typename Lookup>
+double run(int threads, long lookups, const std::vector<fake_object> &queues, Lookup lookup) {
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            const fake_object *queue = &queues[t % queues.size()];
+            int sum = 0;
+            for (long i = 0; i < lookups; i++) sum += lookup(get_dispatch_key(queue))->submits;
+
+            /* keep the loop from being optimized away */
+            if (sum == -1) printf("unexpected\n");
+        });
+    }
+    for (auto &worker : workers) worker.join();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const int threads = (argc > 1) ? atoi(argv[1]) : 4;
+    const long lookups = (argc > 2) ? atol(argv[2]) : 10000000;
+    if (threads <= 0 || lookups <= 0) {
+        printf("usage: %s [threads] [lookups per thread]\n", argv[0]);
+        return 1;
+    }
+
+    /* an instance and a few devices, each with its own dispatch table */
+    static void *tables[5][64];
+    std::vector<fake_object> queues;
+    for (auto &table : tables) {
+        fake_object obj = {table};
+        queues.push_back(obj);
+
+        unordered[table] = new fake_layer_data();
+        dispatch_map.get_or_create(table);
+    }
+
+    printf("%d threads, %ld lookups each (ns per lookup, wall clock)\n", threads, lookups);
+
+    const double ns_unordered = run(threads, lookups, queues, [](void *key) { return unordered.find(key)->second; });
+    printf("  unordered_map, unsynchronized: %6.2f\n", ns_unordered);
+
+    const double ns_locked = run(threads, lookups, queues, [](void *key) {
+        std::lock_guard<std::mutex> lock(unordered_mutex);
+        return unordered.find(key)->second;
+    });
+    printf("  unordered_map, mutex:          %6.2f\n", ns_locked);
+
+    const double ns_dispatch_map = run(threads, lookups, queues, [](void *key) { return dispatch_map.find(key); });
+    printf("  DispatchMap:                   %6.2f\n", ns_dispatch_map);
+
+    for (auto &entry : unordered) delete entry.second;
+
+    return 0;
+}
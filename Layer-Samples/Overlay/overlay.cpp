@@ -22,6 +22,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <atomic>
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 #include "util.hpp"
@@ -29,32 +31,51 @@
 #include <vulkan/vulkan.h>
 #include <vk_dispatch_table_helper.h>
 #include <vulkan/vk_layer.h>
-#include "vk_layer_data.h"
 #include "vk_layer_table.h"
 #include "vk_layer_extension_utils.h"
+#include "dispatch_map.h"
 
 #define STB_TRUETYPE_IMPLEMENTATION
 //#define STBTT_STATIC
 #include "stb_truetype.h"
 
+/* baked by bake_font at build time */
+#include "overlay_font.h"
+
 struct vertex {
     float x, y, u, v;
 };
 
-#define MAX_TEXT_VERTICES 16384
+/* Each line of text has a fixed range of MAX_LINE_GLYPHS quads of 4
+ * vertices, so a line can be rewritten without moving the others. */
+#define MAX_TEXT_LINES 16
+#define MAX_LINE_GLYPHS 64
 #define FONT_SIZE_PIXELS 18
 #define FONT_ATLAS_SIZE 512
 
+static_assert(OVERLAY_FONT_SIZE_PIXELS == FONT_SIZE_PIXELS && OVERLAY_FONT_ATLAS_SIZE == FONT_ATLAS_SIZE &&
+                  OVERLAY_FONT_FIRST_CHAR == 32 && OVERLAY_FONT_CHAR_COUNT == 96,
+              "overlay_font.h was baked for another font size or charset");
+
 struct WsiImageData {
     VkImage image;
     VkImageView view;
     VkFramebuffer framebuffer;
+
+    /* Each image retires its own overlay draw, so presenting one image never
+     * waits on another's. */
+    VkCommandPool pool;
     VkCommandBuffer cmd;
+    VkFence fence;
+    VkSemaphore overlayDone;
 
     VkBuffer vertexBuffer;
     VkDeviceMemory vertexBufferMemory;
-    int numVertices;
-    VkDeviceSize vertexBufferSize;
+    vertex *vertices; /* persistently mapped */
+
+    /* the text last written to vertices, so unchanged lines are skipped */
+    char lines[MAX_TEXT_LINES][MAX_LINE_GLYPHS + 1];
+    uint32_t lineGlyphs[MAX_TEXT_LINES];
 
     void Cleanup(VkDevice dev);
 };
@@ -71,6 +92,26 @@ struct SwapChainData {
     void Cleanup(VkDevice dev);
 };
 
+/* Submit statistics of one queue.  Submits to a queue are externally
+ * synchronized, so relaxed atomics never contend; they only make the reads
+ * at present time, possibly from another queue's thread, well defined. */
+struct QueueStats {
+    std::atomic<uint32_t> submits;
+    std::atomic<uint32_t> commandBuffers;
+    std::atomic<uint32_t> waits;
+    std::atomic<uint32_t> signals;
+    std::atomic<uint64_t> submitNanoseconds;
+};
+
+/* All queues of a device, between two presents */
+struct FrameStats {
+    uint32_t submits;
+    uint32_t commandBuffers;
+    uint32_t waits;
+    uint32_t signals;
+    double submitMilliseconds;
+};
+
 struct layer_data {
     VkLayerDispatchTable *device_dispatch_table;
     VkLayerInstanceDispatchTable *instance_dispatch_table;
@@ -99,23 +140,30 @@ struct layer_data {
     stbtt_bakedchar glyphs[96];
     VkCommandBuffer fontUploadCmdBuffer;
     bool fontUploadComplete;
+    /* freed once fontUploadFence shows the copy is done */
+    VkBuffer fontStagingBuffer;
+    VkDeviceMemory fontStagingMemory;
+    VkFence fontUploadFence;
 
     VkDescriptorSetLayout dsl;
     VkPipelineLayout pl;
     VkDescriptorPool desc_pool;
     VkDescriptorSet desc_set;
     VkSampler sampler;
-    VkFence fence;
+
+    /* 6 indices for each of MAX_LINE_GLYPHS quads, shared by all lines */
+    VkBuffer indexBuffer;
+    VkDeviceMemory indexBufferMemory;
 
     int frame;
-    int cmdBuffersThisFrame;
+    DispatchMap<QueueStats, 64> queueStats;
+    FrameStats lastFrame;
 
     void Cleanup();
 };
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
-
-template layer_data *GetLayerDataPtr<layer_data>(void *data_key, std::unordered_map<void *, layer_data *> &data_map);
+// instances and devices, 256 of them at most
+static DispatchMap<layer_data> layer_data_map;
 
 // static LOADER_PLATFORM_THREAD_ONCE_DECLARATION(g_initOnce);
 // TODO : This can be much smarter, using separate locks for separate global
@@ -163,7 +211,7 @@ static bool get_file_contents(char const *filename, std::vector<unsigned char> &
 }
 
 static bool compile_shader(VkDevice device, char const *filename, VkShaderModule *module) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(device));
 
     std::vector<unsigned char> bytecode;
     if (!get_file_contents(filename, bytecode)) {
@@ -190,7 +238,7 @@ static bool compile_shader(VkDevice device, char const *filename, VkShaderModule
 }
 
 static uint32_t choose_memory_type(VkPhysicalDevice gpu, uint32_t typeBits, VkMemoryPropertyFlags properties) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(gpu), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(gpu));
 
     VkPhysicalDeviceMemoryProperties props;
     my_data->instance_dispatch_table->GetPhysicalDeviceMemoryProperties(gpu, &props);
@@ -205,50 +253,62 @@ static uint32_t choose_memory_type(VkPhysicalDevice gpu, uint32_t typeBits, VkMe
     return 0;
 }
 
-static int fill_vertex_buffer(layer_data *data, vertex *vertices, int index) {
-    char str[1024];
-    sprintf(str,
-            "Vulkan Overlay Example\nWSI Image Index: %d\nFrame: "
-            "%d\nCmdBuffers: %d",
-            index, data->frame++, data->cmdBuffersThisFrame);
+/* Write the quads of one line of text, returning the glyph count */
+static uint32_t write_line(layer_data *data, vertex *v, int line, char const *text) {
     float x = 0;
-    float y = 16;
-
-    vertex *v = vertices;
-
-    for (char const *p = str; *p; p++) {
-        if (*p == '\n') {
-            y += 16;
-            x = 0;
-        } else {
-            stbtt_aligned_quad q;
-            stbtt_GetBakedQuad(data->glyphs, FONT_ATLAS_SIZE, FONT_ATLAS_SIZE, *p - 32, &x, &y, &q, 1);
-
-            v[0].x = q.x0;
-            v[0].y = q.y0;
-            v[0].u = q.s0;
-            v[0].v = q.t0;
-            v[1].x = q.x1;
-            v[1].y = q.y0;
-            v[1].u = q.s1;
-            v[1].v = q.t0;
-            v[2].x = q.x0;
-            v[2].y = q.y1;
-            v[2].u = q.s0;
-            v[2].v = q.t1;
-
-            v[3] = v[1];
-            v[4].x = q.x1;
-            v[4].y = q.y1;
-            v[4].u = q.s1;
-            v[4].v = q.t1;
-            v[5] = v[2];
-
-            v += 6;
-        }
+    float y = 16.0f * (line + 1);
+    uint32_t glyphs = 0;
+
+    for (char const *p = text; *p && glyphs < MAX_LINE_GLYPHS; p++) {
+        if ((unsigned char)*p < 32 || (unsigned char)*p >= 32 + 96) continue;
+
+        stbtt_aligned_quad q;
+        stbtt_GetBakedQuad(data->glyphs, FONT_ATLAS_SIZE, FONT_ATLAS_SIZE, *p - 32, &x, &y, &q, 1);
+
+        v[0].x = q.x0;
+        v[0].y = q.y0;
+        v[0].u = q.s0;
+        v[0].v = q.t0;
+        v[1].x = q.x1;
+        v[1].y = q.y0;
+        v[1].u = q.s1;
+        v[1].v = q.t0;
+        v[2].x = q.x0;
+        v[2].y = q.y1;
+        v[2].u = q.s0;
+        v[2].v = q.t1;
+        v[3].x = q.x1;
+        v[3].y = q.y1;
+        v[3].u = q.s1;
+        v[3].v = q.t1;
+
+        v += 4;
+        glyphs++;
     }
 
-    return (int)(v - vertices);
+    return glyphs;
+}
+
+/* Rewrite the quads of the lines that changed since this image was last drawn */
+static void update_text(layer_data *data, WsiImageData *id, int index) {
+    char lines[MAX_TEXT_LINES][MAX_LINE_GLYPHS + 1];
+    int lineCount = 0;
+
+    snprintf(lines[lineCount++], sizeof(lines[0]), "Vulkan Overlay Example");
+    snprintf(lines[lineCount++], sizeof(lines[0]), "WSI Image Index: %d", index);
+    snprintf(lines[lineCount++], sizeof(lines[0]), "Frame: %d", data->frame++);
+    snprintf(lines[lineCount++], sizeof(lines[0]), "Submits: %u (%u CmdBuffers)", data->lastFrame.submits,
+             data->lastFrame.commandBuffers);
+    snprintf(lines[lineCount++], sizeof(lines[0]), "Waits/Signals: %u/%u", data->lastFrame.waits, data->lastFrame.signals);
+    snprintf(lines[lineCount++], sizeof(lines[0]), "QueueSubmit: %.3f ms", data->lastFrame.submitMilliseconds);
+
+    for (int i = 0; i < MAX_TEXT_LINES; i++) {
+        char const *text = (i < lineCount) ? lines[i] : "";
+        if (!strcmp(text, id->lines[i])) continue;
+
+        strcpy(id->lines[i], text);
+        id->lineGlyphs[i] = write_line(data, id->vertices + i * MAX_LINE_GLYPHS * 4, i, text);
+    }
 }
 
 static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_data *data) {
@@ -257,7 +317,7 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     data->gpu = gpu;
     data->dev = device;
     data->frame = 0;
-    data->cmdBuffersThisFrame = 0;
+    memset(&data->lastFrame, 0, sizeof(data->lastFrame));
 
     VkLayerDispatchTable *pTable = data->device_dispatch_table;
 
@@ -283,7 +343,8 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     compile_shader(device, VULKAN_SAMPLES_BASE_DIR "/Layer-Samples/data/overlay-vert.spv", &data->vsShaderModule);
     compile_shader(device, VULKAN_SAMPLES_BASE_DIR "/Layer-Samples/data/overlay-frag.spv", &data->fsShaderModule);
 
-    /* Upload the font bitmap */
+    /* Create the font image, optimally tiled and filled from a staging
+     * buffer holding the rows of the atlas that have glyphs */
     VkImageCreateInfo ici;
     memset(&ici, 0, sizeof(ici));
     ici.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -295,9 +356,9 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     ici.mipLevels = 1;
     ici.arrayLayers = 1;
     ici.samples = VK_SAMPLE_COUNT_1_BIT;
-    ici.tiling = VK_IMAGE_TILING_LINEAR;
-    ici.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
-    ici.initialLayout = VK_IMAGE_LAYOUT_PREINITIALIZED;
+    ici.tiling = VK_IMAGE_TILING_OPTIMAL;
+    ici.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
     err = pTable->CreateImage(device, &ici, nullptr, &data->fontGlyphsImage);
     assert(!err);
@@ -309,38 +370,43 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     memset(&mem_alloc, 0, sizeof(mem_alloc));
     mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     mem_alloc.allocationSize = mem_reqs.size;
-    mem_alloc.memoryTypeIndex = choose_memory_type(gpu, mem_reqs.memoryTypeBits,
-                                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    mem_alloc.memoryTypeIndex = choose_memory_type(gpu, mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
     err = pTable->AllocateMemory(device, &mem_alloc, nullptr, &data->fontGlyphsMemory);
     assert(!err);
     err = pTable->BindImageMemory(device, data->fontGlyphsImage, data->fontGlyphsMemory, 0);
     assert(!err);
 
-    VkImageSubresource subres;
-    subres.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    subres.mipLevel = 0;
-    subres.arrayLayer = 0;
-    VkSubresourceLayout layout;
-    void *bits;
+    VkBufferCreateInfo sbci;
+    memset(&sbci, 0, sizeof(sbci));
+    sbci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    sbci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    sbci.size = sizeof(overlay_font_atlas);
+
+    err = pTable->CreateBuffer(device, &sbci, nullptr, &data->fontStagingBuffer);
+    assert(!err);
 
-    pTable->GetImageSubresourceLayout(device, data->fontGlyphsImage, &subres, &layout);
+    pTable->GetBufferMemoryRequirements(device, data->fontStagingBuffer, &mem_reqs);
 
-    /* ensure we can directly upload into this layout */
-    assert(!layout.offset);
-    assert(layout.size >= FONT_ATLAS_SIZE * FONT_ATLAS_SIZE);
-    assert(layout.rowPitch == FONT_ATLAS_SIZE);
+    memset(&mem_alloc, 0, sizeof(mem_alloc));
+    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mem_alloc.allocationSize = mem_reqs.size;
+    mem_alloc.memoryTypeIndex = choose_memory_type(gpu, mem_reqs.memoryTypeBits,
+                                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-    err = pTable->MapMemory(device, data->fontGlyphsMemory, 0, VK_WHOLE_SIZE, 0, &bits);
+    err = pTable->AllocateMemory(device, &mem_alloc, nullptr, &data->fontStagingMemory);
+    assert(!err);
+    err = pTable->BindBufferMemory(device, data->fontStagingBuffer, data->fontStagingMemory, 0);
     assert(!err);
 
-    /* Load the font glyphs directly into the mapped buffer */
-    std::vector<unsigned char> fontData;
-    get_file_contents(VULKAN_SAMPLES_BASE_DIR "/Layer-Samples/data/FreeSans.ttf", fontData);
-    stbtt_BakeFontBitmap(&fontData[0], 0, FONT_SIZE_PIXELS, (unsigned char *)bits, FONT_ATLAS_SIZE, FONT_ATLAS_SIZE, 32, 96,
-                         data->glyphs);
+    void *bits;
+    err = pTable->MapMemory(device, data->fontStagingMemory, 0, VK_WHOLE_SIZE, 0, &bits);
+    assert(!err);
+
+    memcpy(bits, overlay_font_atlas, sizeof(overlay_font_atlas));
+    memcpy(data->glyphs, overlay_font_glyphs, sizeof(data->glyphs));
 
-    pTable->UnmapMemory(device, data->fontGlyphsMemory);
+    pTable->UnmapMemory(device, data->fontStagingMemory);
 
     VkImageViewCreateInfo ivci;
     ivci.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -362,8 +428,8 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     err = pTable->CreateImageView(device, &ivci, nullptr, &data->fontGlyphsImageView);
     assert(!err);
 
-    /* transition from undefined layout to shader readonly so we can use it.
-     * requires a command buffer. */
+    /* clear the image, copy the glyph rows in and transition it to shader
+     * readonly. requires a command buffer; submitted with the first present. */
     VkCommandBufferAllocateInfo cbai;
     cbai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     cbai.pNext = nullptr;
@@ -396,13 +462,15 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     err = pTable->BeginCommandBuffer(cmd, &cbbi);
     assert(!err);
 
+    /* vkCmdClearColorImage clears whole levels, so clear all of the atlas
+     * and then copy the rows holding glyphs over it */
     VkImageMemoryBarrier imb;
     imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     imb.pNext = nullptr;
-    imb.dstAccessMask = VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
     imb.srcAccessMask = 0;
+    imb.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
     imb.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imb.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
     imb.image = data->fontGlyphsImage;
     imb.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     imb.subresourceRange.baseMipLevel = 0;
@@ -412,15 +480,51 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     imb.srcQueueFamilyIndex = data->graphicsQueueFamilyIndex;
     imb.dstQueueFamilyIndex = data->graphicsQueueFamilyIndex;
 
-    pTable->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0 /* dependency flags */,
+    pTable->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0 /* dependency flags */,
+                               0, nullptr, /* memory barriers */
+                               0, nullptr, /* buffer memory barriers */
+                               1, &imb);   /* image memory barriers */
+
+    VkClearColorValue black;
+    memset(&black, 0, sizeof(black));
+    pTable->CmdClearColorImage(cmd, data->fontGlyphsImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &black, 1,
+                               &imb.subresourceRange);
+
+    imb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    imb.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    pTable->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0 /* dependency flags */,
                                0, nullptr, /* memory barriers */
                                0, nullptr, /* buffer memory barriers */
                                1, &imb);   /* image memory barriers */
 
+    VkBufferImageCopy region;
+    memset(&region, 0, sizeof(region));
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent.width = FONT_ATLAS_SIZE;
+    region.imageExtent.height = OVERLAY_FONT_ATLAS_ROWS;
+    region.imageExtent.depth = 1;
+    pTable->CmdCopyBufferToImage(cmd, data->fontStagingBuffer, data->fontGlyphsImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                                 &region);
+
+    imb.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    imb.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    pTable->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                               0 /* dependency flags */, 0, nullptr, /* memory barriers */
+                               0, nullptr,                           /* buffer memory barriers */
+                               1, &imb);                             /* image memory barriers */
+
     pTable->EndCommandBuffer(cmd);
     data->fontUploadCmdBuffer = cmd;
     data->fontUploadComplete = false; /* we will schedule this at first present on this device */
 
+    VkFenceCreateInfo fci;
+    fci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fci.pNext = nullptr;
+    fci.flags = 0;
+    err = pTable->CreateFence(device, &fci, nullptr, &data->fontUploadFence);
+    assert(!err);
+
 #ifdef OVERLAY_DEBUG
     printf("Font upload done.\n");
 #endif
@@ -502,7 +606,7 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
     VkDescriptorImageInfo descs[1];
     descs[0].sampler = data->sampler;
     descs[0].imageView = data->fontGlyphsImageView;
-    descs[0].imageLayout = VK_IMAGE_LAYOUT_GENERAL;  // TODO: cube does this, is it correct?
+    descs[0].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
     VkWriteDescriptorSet writes[1];
     memset(&writes, 0, sizeof(writes));
@@ -515,11 +619,46 @@ static void after_device_create(VkPhysicalDevice gpu, VkDevice device, layer_dat
 
     pTable->UpdateDescriptorSets(device, 1, writes, 0, nullptr);
 
-    VkFenceCreateInfo fci;
-    fci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fci.pNext = NULL;
-    fci.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-    pTable->CreateFence(device, &fci, NULL, &data->fence);
+    /* Index buffer for the glyph quads */
+    VkBufferCreateInfo bci;
+    memset(&bci, 0, sizeof(bci));
+    bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bci.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    bci.size = sizeof(uint16_t) * 6 * MAX_LINE_GLYPHS;
+
+    err = pTable->CreateBuffer(device, &bci, nullptr, &data->indexBuffer);
+    assert(!err);
+
+    pTable->GetBufferMemoryRequirements(device, data->indexBuffer, &mem_reqs);
+
+    memset(&mem_alloc, 0, sizeof(mem_alloc));
+    mem_alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mem_alloc.allocationSize = mem_reqs.size;
+    mem_alloc.memoryTypeIndex = choose_memory_type(gpu, mem_reqs.memoryTypeBits,
+                                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    err = pTable->AllocateMemory(device, &mem_alloc, nullptr, &data->indexBufferMemory);
+    assert(!err);
+    err = pTable->BindBufferMemory(device, data->indexBuffer, data->indexBufferMemory, 0);
+    assert(!err);
+
+    uint16_t *indices;
+    err = pTable->MapMemory(device, data->indexBufferMemory, 0, VK_WHOLE_SIZE, 0, (void **)&indices);
+    assert(!err);
+
+    /* two triangles per quad, over vertices (x0,y0) (x1,y0) (x0,y1) (x1,y1) */
+    for (uint16_t i = 0; i < MAX_LINE_GLYPHS; i++) {
+        const uint16_t base = i * 4;
+        indices[0] = base + 0;
+        indices[1] = base + 1;
+        indices[2] = base + 2;
+        indices[3] = base + 1;
+        indices[4] = base + 3;
+        indices[5] = base + 2;
+        indices += 6;
+    }
+
+    pTable->UnmapMemory(device, data->indexBufferMemory);
 }
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
@@ -542,7 +681,14 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice g
         return result;
     }
 
-    layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
+    layer_data *my_device_data = layer_data_map.get_or_create(get_dispatch_key(*pDevice));
+    if (!my_device_data) {
+        // more instances and devices than layer_data_map holds
+        PFN_vkDestroyDevice fpDestroyDevice = (PFN_vkDestroyDevice)fpGetDeviceProcAddr(*pDevice, "vkDestroyDevice");
+        fpDestroyDevice(*pDevice, pAllocator);
+        *pDevice = VK_NULL_HANDLE;
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
     // Setup device dispatch table
     my_device_data->device_dispatch_table = new VkLayerDispatchTable;
@@ -557,7 +703,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice g
     }
 
     uint32_t queue_family_count;
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(gpu), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(gpu));
     my_data->instance_dispatch_table->GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, NULL);
     VkQueueFamilyProperties *queue_props = (VkQueueFamilyProperties *)malloc(queue_family_count * sizeof(VkQueueFamilyProperties));
     if (queue_props == NULL) {
@@ -579,7 +725,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice g
 
 VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(device);
-    layer_data *my_data = GetLayerDataPtr(key, layer_data_map);
+    layer_data *my_data = layer_data_map.find(key);
     my_data->Cleanup();
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
     pTable->DeviceWaitIdle(device);
@@ -605,7 +751,14 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstance
     VkResult result = fpCreateInstance(pCreateInfo, pAllocator, pInstance);
     if (result != VK_SUCCESS) return result;
 
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
+    layer_data *my_data = layer_data_map.get_or_create(get_dispatch_key(*pInstance));
+    if (!my_data) {
+        // more instances and devices than layer_data_map holds
+        PFN_vkDestroyInstance fpDestroyInstance = (PFN_vkDestroyInstance)fpGetInstanceProcAddr(*pInstance, "vkDestroyInstance");
+        fpDestroyInstance(*pInstance, pAllocator);
+        *pInstance = VK_NULL_HANDLE;
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     my_data->instance_dispatch_table = new VkLayerInstanceDispatchTable;
     layer_init_instance_dispatch_table(*pInstance, my_data->instance_dispatch_table, fpGetInstanceProcAddr);
 
@@ -615,7 +768,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstance
 
 VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(instance);
-    layer_data *my_data = GetLayerDataPtr(key, layer_data_map);
+    layer_data *my_data = layer_data_map.find(key);
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyInstance(instance, pAllocator);
     delete pTable;
@@ -625,7 +778,7 @@ VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                                     const VkAllocationCallbacks *pAllocator,
                                                                     VkSwapchainKHR *pSwapChain) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(device));
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
     VkResult result = my_data->pfnCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapChain);
 
@@ -817,7 +970,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(VkDevice dev
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapChain, uint32_t *pCount,
                                                                        VkImage *pImages) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(device));
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
     VkResult result = my_data->pfnGetSwapchainImagesKHR(device, swapChain, pCount, pImages);
     VkResult U_ASSERT_ONLY err;
@@ -868,11 +1021,22 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice
             VkFramebuffer fb;
             pTable->CreateFramebuffer(device, &fci, nullptr, &fb);
 
-            /* Create command buffer for each */
+            /* Create command pool and buffer for each, re-recorded at every
+             * present of the image */
+            VkCommandPoolCreateInfo cpci;
+            cpci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            cpci.pNext = nullptr;
+            cpci.queueFamilyIndex = my_data->graphicsQueueFamilyIndex;
+            cpci.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+            VkCommandPool pool;
+            err = pTable->CreateCommandPool(device, &cpci, nullptr, &pool);
+            assert(!err);
+
             VkCommandBufferAllocateInfo cbai;
             cbai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
             cbai.pNext = nullptr;
-            cbai.commandPool = my_data->pool;
+            cbai.commandPool = pool;
             cbai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
             cbai.commandBufferCount = 1;
 
@@ -893,12 +1057,33 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice
                 assert(!err);
             }
 
+            /* Create the fence retiring the overlay draw, signaled so the
+             * first present does not skip it */
+            VkFenceCreateInfo fenceci;
+            fenceci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceci.pNext = nullptr;
+            fenceci.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+            VkFence fence;
+            err = pTable->CreateFence(device, &fenceci, nullptr, &fence);
+            assert(!err);
+
+            /* Create the semaphore the present waits on instead of the app's */
+            VkSemaphoreCreateInfo sci;
+            sci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            sci.pNext = nullptr;
+            sci.flags = 0;
+
+            VkSemaphore overlayDone;
+            err = pTable->CreateSemaphore(device, &sci, nullptr, &overlayDone);
+            assert(!err);
+
             /* Create vertex buffer */
             VkBufferCreateInfo bci;
             memset(&bci, 0, sizeof(bci));
             bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
             bci.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
-            bci.size = sizeof(vertex) * MAX_TEXT_VERTICES;
+            bci.size = sizeof(vertex) * 4 * MAX_LINE_GLYPHS * MAX_TEXT_LINES;
 
             VkBuffer buf;
             err = pTable->CreateBuffer(device, &bci, nullptr, &buf);
@@ -922,15 +1107,24 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice
             err = pTable->BindBufferMemory(device, buf, mem, 0);
             assert(!err);
 
+            /* Map it for good; only the lines that change are rewritten */
+            vertex *vertices;
+            err = pTable->MapMemory(device, mem, 0, VK_WHOLE_SIZE, 0, (void **)&vertices);
+            assert(!err);
+
             auto imageData = new WsiImageData;
             imageData->image = pImages[i];
             imageData->view = v;
             imageData->framebuffer = fb;
+            imageData->pool = pool;
             imageData->cmd = cmd;
+            imageData->fence = fence;
+            imageData->overlayDone = overlayDone;
             imageData->vertexBuffer = buf;
             imageData->vertexBufferMemory = mem;
-            imageData->numVertices = 0;
-            imageData->vertexBufferSize = mem_alloc.allocationSize;
+            imageData->vertices = vertices;
+            memset(imageData->lines, 0, sizeof(imageData->lines));
+            memset(imageData->lineGlyphs, 0, sizeof(imageData->lineGlyphs));
 
             data->presentableImages.push_back(imageData);
         }
@@ -940,15 +1134,58 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR(VkDevice
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                                              VkFence fence) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(queue));
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
 
-    my_data->cmdBuffersThisFrame += submitCount;  // XXX WRONG
+    QueueStats *stats = my_data->queueStats.find(queue);
+    if (!stats) stats = my_data->queueStats.get_or_create(queue);
+
+    uint32_t commandBuffers = 0, waits = 0, signals = 0;
+    for (uint32_t i = 0; i < submitCount; i++) {
+        commandBuffers += pSubmits[i].commandBufferCount;
+        waits += pSubmits[i].waitSemaphoreCount;
+        signals += pSubmits[i].signalSemaphoreCount;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    VkResult result = pTable->QueueSubmit(queue, submitCount, pSubmits, fence);
+    auto end = std::chrono::steady_clock::now();
+
+    // queues past the capacity of queueStats are not counted
+    if (!stats) return result;
+
+    stats->submits.fetch_add(submitCount, std::memory_order_relaxed);
+    stats->commandBuffers.fetch_add(commandBuffers, std::memory_order_relaxed);
+    stats->waits.fetch_add(waits, std::memory_order_relaxed);
+    stats->signals.fetch_add(signals, std::memory_order_relaxed);
+    stats->submitNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                                       std::memory_order_relaxed);
+
+    return result;
+}
 
-    return pTable->QueueSubmit(queue, submitCount, pSubmits, fence);
+/* Move the counts of every queue since the last present into lastFrame */
+static void collect_frame_stats(layer_data *my_data) {
+    FrameStats frame = {};
+    uint64_t submitNanoseconds = 0;
+
+    my_data->queueStats.for_each([&](void *, QueueStats *stats) {
+        frame.submits += stats->submits.exchange(0, std::memory_order_relaxed);
+        frame.commandBuffers += stats->commandBuffers.exchange(0, std::memory_order_relaxed);
+        frame.waits += stats->waits.exchange(0, std::memory_order_relaxed);
+        frame.signals += stats->signals.exchange(0, std::memory_order_relaxed);
+        submitNanoseconds += stats->submitNanoseconds.exchange(0, std::memory_order_relaxed);
+    });
+
+    frame.submitMilliseconds = submitNanoseconds / 1e6;
+    my_data->lastFrame = frame;
 }
 
-static void before_present(VkQueue queue, layer_data *my_data, SwapChainData *swapChain, unsigned imageIndex) {
+/* Draw the overlay into a presentable image once waitCount semaphores are
+ * signaled.  Returns the semaphore signaled when the overlay is drawn, or
+ * VK_NULL_HANDLE if it was skipped. */
+static VkSemaphore before_present(VkQueue queue, layer_data *my_data, SwapChainData *swapChain, unsigned imageIndex,
+                                  uint32_t waitCount, const VkSemaphore *pWaitSemaphores) {
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
 
     if (!my_data->fontUploadComplete) {
@@ -960,28 +1197,35 @@ static void before_present(VkQueue queue, layer_data *my_data, SwapChainData *sw
         si.signalSemaphoreCount = 0;
         si.pCommandBuffers = &my_data->fontUploadCmdBuffer;
 
-        pTable->QueueSubmit(queue, 1, &si, VK_NULL_HANDLE);
+        pTable->QueueSubmit(queue, 1, &si, my_data->fontUploadFence);
         my_data->fontUploadComplete = true;
 #ifdef OVERLAY_DEBUG
-        printf("Font image layout transition queued\n");
+        printf("Font image upload queued\n");
 #endif
+    } else if (my_data->fontStagingBuffer != VK_NULL_HANDLE &&
+               pTable->GetFenceStatus(my_data->dev, my_data->fontUploadFence) == VK_SUCCESS) {
+        pTable->DestroyBuffer(my_data->dev, my_data->fontStagingBuffer, nullptr);
+        pTable->FreeMemory(my_data->dev, my_data->fontStagingMemory, nullptr);
+        my_data->fontStagingBuffer = VK_NULL_HANDLE;
+        my_data->fontStagingMemory = VK_NULL_HANDLE;
     }
 
     WsiImageData *id = swapChain->presentableImages[imageIndex];
 
-    /* update the overlay content */
-
-    vertex *vertices = nullptr;
-
-    /* guaranteed not in flight due to WSI surface being available */
-    VkResult U_ASSERT_ONLY err =
-        pTable->MapMemory(my_data->dev, id->vertexBufferMemory, 0, id->vertexBufferSize, 0, (void **)&vertices);
-    assert(!err);
-
-    /* write vertices for string in here */
-    id->numVertices = fill_vertex_buffer(my_data, vertices, imageIndex);
+    /* The overlay drawn at the last present of this image has almost always
+     * retired by the time the image is acquired again.  If it has not, skip
+     * the overlay for this frame rather than stall the app. */
+    if (pTable->GetFenceStatus(my_data->dev, id->fence) != VK_SUCCESS) {
+#ifdef OVERLAY_DEBUG
+        printf("Overlay for image %u still in flight, skipped\n", imageIndex);
+#endif
+        return VK_NULL_HANDLE;
+    }
+    pTable->ResetFences(my_data->dev, 1, &id->fence);
+    pTable->ResetCommandPool(my_data->dev, id->pool, 0);
 
-    pTable->UnmapMemory(my_data->dev, id->vertexBufferMemory);
+    /* update the overlay content */
+    update_text(my_data, id, imageIndex);
 
     /* JIT record a command buffer to draw the overlay */
 
@@ -991,11 +1235,13 @@ static void before_present(VkQueue queue, layer_data *my_data, SwapChainData *sw
     cbbi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     cbbi.pInheritanceInfo = nullptr;
 
+    /* the transition waits for the app's semaphores, which block the color
+     * attachment output stage */
     VkImageMemoryBarrier imb;
     imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     imb.pNext = nullptr;
-    imb.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
-    imb.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    imb.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    imb.srcAccessMask = 0;
     imb.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
     imb.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     imb.image = id->image;
@@ -1020,10 +1266,11 @@ static void before_present(VkQueue queue, layer_data *my_data, SwapChainData *sw
     rpbi.pClearValues = nullptr;
 
     pTable->BeginCommandBuffer(id->cmd, &cbbi);
-    pTable->CmdPipelineBarrier(id->cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                               0 /* dependency flags */, 0, nullptr, /* memory barriers */
-                               0, nullptr,                           /* buffer memory barriers */
-                               1, &imb);                             /* image memory barriers */
+    pTable->CmdPipelineBarrier(id->cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                               VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0 /* dependency flags */,
+                               0, nullptr, /* memory barriers */
+                               0, nullptr, /* buffer memory barriers */
+                               1, &imb);   /* image memory barriers */
     pTable->CmdBeginRenderPass(id->cmd, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
 
     pTable->CmdBindPipeline(id->cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, swapChain->pipeline);
@@ -1033,62 +1280,83 @@ static void before_present(VkQueue queue, layer_data *my_data, SwapChainData *sw
     VkBuffer buffers[] = {id->vertexBuffer};
 
     pTable->CmdBindVertexBuffers(id->cmd, 0, 1, buffers, offsets);
+    pTable->CmdBindIndexBuffer(id->cmd, my_data->indexBuffer, 0, VK_INDEX_TYPE_UINT16);
 
-    pTable->CmdDraw(id->cmd, id->numVertices, 1, 0, 0);
+    for (uint32_t i = 0; i < MAX_TEXT_LINES; i++) {
+        if (id->lineGlyphs[i]) pTable->CmdDrawIndexed(id->cmd, id->lineGlyphs[i] * 6, 1, 0, i * MAX_LINE_GLYPHS * 4, 0);
+    }
 
     pTable->CmdEndRenderPass(id->cmd);
     pTable->EndCommandBuffer(id->cmd);
 
-    /* Schedule this command buffer for execution. TODO: Do we need to protect
-     * ourselves from an app that didn't wait for the presentation image to
-     * be idle before mangling it? If the app is well-behaved, our command
-     * buffer is guaranteed to have been retired before the app tries to
-     * present it again.
-     */
+    /* Schedule this command buffer for execution after the app's rendering,
+     * and have the present wait for it instead. */
+    std::vector<VkPipelineStageFlags> waitStages(waitCount, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
     VkSubmitInfo si = {};
     si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     si.pNext = nullptr;
-    si.waitSemaphoreCount = 0;
+    si.waitSemaphoreCount = waitCount;
+    si.pWaitSemaphores = pWaitSemaphores;
+    si.pWaitDstStageMask = waitStages.data();
     si.commandBufferCount = 1;
-    si.signalSemaphoreCount = 0;
     si.pCommandBuffers = &id->cmd;
-    pTable->WaitForFences(my_data->dev, 1, &my_data->fence, VK_TRUE, UINT64_MAX);
-    pTable->ResetFences(my_data->dev, 1, &my_data->fence);
-    pTable->QueueSubmit(queue, 1, &si, my_data->fence);
+    si.signalSemaphoreCount = 1;
+    si.pSignalSemaphores = &id->overlayDone;
+    VkResult U_ASSERT_ONLY err = pTable->QueueSubmit(queue, 1, &si, id->fence);
+    assert(!err);
 
-    /* Reset per-frame stats */
-    my_data->cmdBuffersThisFrame = 0;
+    return id->overlayDone;
 }
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(queue));
+
+    collect_frame_stats(my_data);
+
+    /* Chain the overlay draws: the first waits for the app's semaphores, each
+     * later one for the draw before it, and the present for the last. */
+    uint32_t waitCount = pPresentInfo->waitSemaphoreCount;
+    const VkSemaphore *pWaitSemaphores = pPresentInfo->pWaitSemaphores;
+    VkSemaphore overlayDone = VK_NULL_HANDLE;
 
     for (uint32_t i = 0; i < pPresentInfo->swapchainCount; i++) {
         auto data = my_data->swapChains->find(pPresentInfo->pSwapchains[i]);
         assert(data != my_data->swapChains->end());
 
-        before_present(queue, my_data, data->second, pPresentInfo->pImageIndices[i]);
+        VkSemaphore done = before_present(queue, my_data, data->second, pPresentInfo->pImageIndices[i], waitCount, pWaitSemaphores);
+        if (done != VK_NULL_HANDLE) {
+            overlayDone = done;
+            waitCount = 1;
+            pWaitSemaphores = &overlayDone;
+        }
     }
 
-    VkResult result = my_data->pfnQueuePresentKHR(queue, pPresentInfo);
+    VkPresentInfoKHR presentInfo = *pPresentInfo;
+    presentInfo.waitSemaphoreCount = waitCount;
+    presentInfo.pWaitSemaphores = pWaitSemaphores;
+
+    VkResult result = my_data->pfnQueuePresentKHR(queue, &presentInfo);
     return result;
 }
 
 void WsiImageData::Cleanup(VkDevice dev) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(dev));
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
     pTable->DeviceWaitIdle(dev);
 
-    // XXX: needs device data
-    //    pTable->FreeCommandBuffers(dev, cmd, nullptr);
+    pTable->DestroyCommandPool(dev, pool, nullptr);
+    pTable->DestroyFence(dev, fence, nullptr);
+    pTable->DestroySemaphore(dev, overlayDone, nullptr);
     pTable->DestroyFramebuffer(dev, framebuffer, nullptr);
     pTable->DestroyImageView(dev, view, nullptr);
+    pTable->UnmapMemory(dev, vertexBufferMemory);
     pTable->DestroyBuffer(dev, vertexBuffer, nullptr);
     pTable->FreeMemory(dev, vertexBufferMemory, nullptr);
 }
 
 void SwapChainData::Cleanup(VkDevice dev) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(dev));
     VkLayerDispatchTable *pTable = my_data->device_dispatch_table;
 
     for (uint32_t i = 0; i < presentableImages.size(); i++) {
@@ -1106,24 +1374,28 @@ void layer_data::Cleanup() {
     VkLayerDispatchTable *pTable = this->device_dispatch_table;
 
     pTable->DestroySampler(dev, sampler, nullptr);
+    pTable->DestroyBuffer(dev, indexBuffer, nullptr);
+    pTable->FreeMemory(dev, indexBufferMemory, nullptr);
     pTable->DestroyDescriptorPool(dev, desc_pool, nullptr);
     pTable->DestroyPipelineLayout(dev, pl, nullptr);
     pTable->DestroyDescriptorSetLayout(dev, dsl, nullptr);
     pTable->DestroyImageView(dev, fontGlyphsImageView, nullptr);
     pTable->DestroyImage(dev, fontGlyphsImage, nullptr);
     pTable->FreeMemory(dev, fontGlyphsMemory, nullptr);
+    pTable->DestroyBuffer(dev, fontStagingBuffer, nullptr);
+    pTable->FreeMemory(dev, fontStagingMemory, nullptr);
+    pTable->DestroyFence(dev, fontUploadFence, nullptr);
 
     pTable->FreeCommandBuffers(dev, pool, 1, &fontUploadCmdBuffer);
     pTable->DestroyCommandPool(dev, pool, nullptr);
 
     pTable->DestroyShaderModule(dev, vsShaderModule, nullptr);
     pTable->DestroyShaderModule(dev, fsShaderModule, nullptr);
-    pTable->DestroyFence(dev, fence, nullptr);
 }
 
 VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                                  const VkAllocationCallbacks *pAllocator) {
-    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    layer_data *my_data = layer_data_map.find(get_dispatch_key(device));
 
     /* Clean up our resources associated with this swapchain */
     auto it = my_data->swapChains->find(swapchain);
@@ -1152,7 +1424,7 @@ VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkD
     if (dev == NULL) return NULL;
 
     layer_data *dev_data;
-    dev_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
+    dev_data = layer_data_map.find(get_dispatch_key(dev));
     VkLayerDispatchTable *pTable = dev_data->device_dispatch_table;
 
     if (pTable->GetDeviceProcAddr == NULL) return NULL;
@@ -1171,7 +1443,7 @@ VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(V
     if (instance == NULL) return NULL;
 
     layer_data *instance_data;
-    instance_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    instance_data = layer_data_map.find(get_dispatch_key(instance));
     VkLayerInstanceDispatchTable *pTable = instance_data->instance_dispatch_table;
 
     if (pTable->GetInstanceProcAddr == NULL) return NULL;
@@ -0,0 +1,1134 @@
+/* Generated by bake_font from FreeSans.ttf; do not edit. */
+
+#define OVERLAY_FONT_SIZE_PIXELS 18
+#define OVERLAY_FONT_ATLAS_SIZE 512
+#define OVERLAY_FONT_FIRST_CHAR 32
+#define OVERLAY_FONT_CHAR_COUNT 96
+/* rows below this are empty */
+#define OVERLAY_FONT_ATLAS_ROWS 32
+
+static const stbtt_bakedchar overlay_font_glyphs[OVERLAY_FONT_CHAR_COUNT] = {
+    {1, 1, 1, 1, 0, 0, 3.84923053},
+    {2, 1, 4, 12, 1, -11, 3.84923053},
+    {5, 1, 10, 5, 0, -10, 4.91538429},
+    {11, 1, 19, 12, 0, -10, 7.69846106},
+    {20, 1, 28, 14, 0, -11, 7.69846106},
+    {29, 1, 41, 12, 0, -10, 12.3092308},
+    {42, 1, 51, 12, 0, -10, 9.23538399},
+    {52, 1, 54, 5, 0, -10, 2.64461541},
+    {55, 1, 59, 15, 1, -11, 4.61076927},
+    {60, 1, 64, 15, 0, -11, 4.61076927},
+    {65, 1, 70, 6, 0, -11, 5.3861537},
+    {71, 1, 79, 9, 0, -7, 8.08615398},
+    {80, 1, 82, 6, 1, -2, 3.84923053},
+    {83, 1, 87, 3, 0, -5, 4.61076927},
+    {88, 1, 90, 3, 1, -2, 3.84923053},
+    {91, 1, 96, 13, -1, -11, 3.84923053},
+    {97, 1, 105, 12, 0, -10, 7.69846106},
+    {106, 1, 110, 11, 1, -10, 7.69846106},
+    {111, 1, 119, 11, 0, -10, 7.69846106},
+    {120, 1, 128, 12, 0, -10, 7.69846106},
+    {129, 1, 137, 11, 0, -10, 7.69846106},
+    {138, 1, 146, 12, 0, -10, 7.69846106},
+    {147, 1, 155, 12, 0, -10, 7.69846106},
+    {156, 1, 164, 11, 0, -10, 7.69846106},
+    {165, 1, 173, 12, 0, -10, 7.69846106},
+    {174, 1, 182, 12, 0, -10, 7.69846106},
+    {183, 1, 185, 9, 1, -8, 3.84923053},
+    {186, 1, 188, 12, 1, -8, 3.84923053},
+    {189, 1, 197, 9, 0, -7, 8.08615398},
+    {198, 1, 206, 5, 0, -5, 8.08615398},
+    {207, 1, 215, 9, 0, -7, 8.08615398},
+    {216, 1, 223, 12, 1, -11, 7.69846106},
+    {224, 1, 238, 14, 0, -11, 14.0538454},
+    {239, 1, 249, 12, 0, -11, 9.23538399},
+    {250, 1, 258, 12, 1, -11, 9.23538399},
+    {259, 1, 269, 13, 0, -11, 9.99692249},
+    {270, 1, 279, 12, 1, -11, 9.99692249},
+    {280, 1, 288, 12, 1, -11, 9.23538399},
+    {289, 1, 297, 12, 1, -11, 8.46000004},
+    {298, 1, 308, 13, 0, -11, 10.7723074},
+    {309, 1, 317, 12, 1, -11, 9.99692249},
+    {318, 1, 320, 12, 1, -11, 3.84923053},
+    {321, 1, 327, 13, 0, -11, 6.92307663},
+    {328, 1, 337, 12, 1, -11, 9.23538399},
+    {338, 1, 345, 12, 1, -11, 7.69846106},
+    {346, 1, 356, 12, 1, -11, 11.5338459},
+    {357, 1, 365, 12, 1, -11, 9.99692249},
+    {366, 1, 377, 13, 0, -11, 10.7723074},
+    {378, 1, 386, 12, 1, -11, 9.23538399},
+    {387, 1, 398, 13, 0, -11, 10.7723074},
+    {399, 1, 408, 12, 1, -11, 9.99692249},
+    {409, 1, 418, 13, 0, -11, 9.23538399},
+    {419, 1, 428, 12, 0, -11, 8.46000004},
+    {429, 1, 437, 13, 1, -11, 9.99692249},
+    {438, 1, 447, 12, 0, -11, 9.23538399},
+    {448, 1, 461, 12, 0, -11, 13.0707684},
+    {462, 1, 471, 12, 0, -11, 9.23538399},
+    {472, 1, 482, 12, 0, -11, 9.23538399},
+    {483, 1, 492, 12, 0, -11, 8.46000004},
+    {493, 1, 497, 15, 0, -11, 3.84923053},
+    {498, 1, 503, 13, -1, -11, 3.84923053},
+    {504, 1, 507, 15, 0, -11, 3.83538461},
+    {1, 16, 7, 22, 0, -10, 6.49384594},
+    {8, 16, 18, 18, -1, 1, 7.69846106},
+    {19, 16, 23, 19, 0, -11, 4.61076927},
+    {24, 16, 32, 25, 0, -8, 7.69846106},
+    {33, 16, 41, 28, 0, -11, 7.69846106},
+    {42, 16, 49, 25, 0, -8, 6.92307663},
+    {50, 16, 57, 28, 0, -11, 7.69846106},
+    {58, 16, 66, 25, 0, -8, 7.69846106},
+    {67, 16, 71, 27, 0, -11, 3.84923053},
+    {72, 16, 79, 28, 0, -8, 7.69846106},
+    {80, 16, 87, 27, 0, -11, 7.69846106},
+    {88, 16, 91, 28, 0, -11, 3.0738461},
+    {92, 16, 96, 31, -1, -11, 3.0738461},
+    {97, 16, 104, 27, 0, -11, 6.92307663},
+    {105, 16, 108, 27, 0, -11, 3.0738461},
+    {109, 16, 120, 24, 0, -8, 11.5338459},
+    {121, 16, 128, 24, 0, -8, 7.69846106},
+    {129, 16, 137, 25, 0, -8, 7.69846106},
+    {138, 16, 146, 28, 0, -8, 7.69846106},
+    {147, 16, 154, 28, 0, -8, 7.69846106},
+    {155, 16, 160, 24, 0, -8, 4.61076927},
+    {161, 16, 168, 25, 0, -8, 6.92307663},
+    {169, 16, 173, 27, 0, -10, 3.84923053},
+    {174, 16, 181, 25, 0, -8, 7.69846106},
+    {182, 16, 189, 24, 0, -8, 6.92307663},
+    {190, 16, 200, 24, 0, -8, 9.99692249},
+    {201, 16, 208, 24, 0, -8, 6.92307663},
+    {209, 16, 216, 28, 0, -8, 6.92307663},
+    {217, 16, 224, 24, 0, -8, 6.92307663},
+    {225, 16, 229, 30, 0, -11, 4.62461519},
+    {230, 16, 232, 30, 1, -11, 3.5999999},
+    {233, 16, 237, 30, 0, -11, 4.62461519},
+    {238, 16, 245, 20, 1, -7, 8.08615398},
+    {246, 16, 253, 30, 0, -14, 6.92307663},
+};
+
+static const unsigned char overlay_font_atlas[OVERLAY_FONT_ATLAS_ROWS * OVERLAY_FONT_ATLAS_SIZE] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 21, 0, 58, 208, 15, 208, 46, 0, 0, 0, 30, 145, 0,
+    68, 109, 0, 0, 0, 0, 0, 107, 31, 0, 0, 0, 0, 0, 8, 90,
+    45, 0, 0, 0, 0, 162, 28, 0, 0, 0, 0, 0, 34, 140, 176, 79,
+    0, 0, 0, 0, 70, 201, 0, 0, 0, 18, 0, 0, 11, 7, 0, 0,
+    0, 0, 0, 19, 2, 0, 0, 0, 0, 0, 63, 76, 0, 0, 0, 0,
+    89, 74, 0, 30, 82, 82, 76, 0, 89, 72, 0, 0, 0, 0, 0, 18,
+    0, 0, 3, 121, 197, 168, 61, 0, 0, 0, 0, 0, 43, 168, 0, 0,
+    6, 78, 168, 157, 67, 3, 0, 0, 0, 17, 99, 182, 143, 58, 0, 0,
+    0, 0, 0, 0, 0, 93, 155, 0, 0, 0, 0, 111, 208, 208, 208, 208,
+    123, 0, 0, 0, 0, 87, 188, 171, 79, 0, 0, 0, 76, 208, 208, 208,
+    208, 208, 208, 42, 0, 0, 12, 94, 178, 147, 58, 0, 0, 0, 0, 4,
+    80, 178, 168, 65, 0, 0, 0, 31, 63, 0, 30, 64, 0, 0, 0, 0,
+    0, 0, 0, 47, 48, 0, 70, 226, 226, 226, 226, 226, 226, 89, 0, 39,
+    56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28, 53, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 24, 12, 0, 0, 0, 0, 0, 22, 24, 24, 24, 11, 0,
+    0, 0, 0, 0, 0, 0, 0, 29, 43, 0, 0, 0, 0, 0, 18, 24,
+    24, 24, 9, 0, 0, 0, 0, 0, 18, 24, 24, 24, 24, 24, 24, 6,
+    0, 18, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 21, 50,
+    4, 0, 0, 0, 0, 20, 10, 0, 0, 0, 0, 9, 22, 0, 15, 16,
+    0, 0, 0, 0, 0, 9, 22, 0, 22, 9, 0, 0, 0, 0, 15, 24,
+    1, 0, 21, 9, 0, 0, 0, 0, 0, 0, 23, 20, 0, 0, 0, 0,
+    0, 6, 24, 13, 0, 23, 12, 0, 0, 0, 0, 7, 23, 0, 0, 0,
+    0, 0, 24, 54, 15, 0, 0, 0, 0, 0, 18, 24, 24, 24, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, 24, 54, 15, 0, 0, 0, 0, 0, 17,
+    24, 24, 24, 24, 2, 0, 0, 0, 0, 0, 0, 0, 3, 47, 6, 0,
+    0, 0, 0, 17, 24, 24, 24, 24, 24, 24, 24, 5, 0, 20, 11, 0,
+    0, 0, 0, 9, 22, 0, 14, 20, 0, 0, 0, 0, 0, 11, 22, 0,
+    16, 18, 0, 0, 0, 3, 24, 7, 0, 0, 0, 14, 20, 0, 11, 24,
+    3, 0, 0, 0, 0, 18, 19, 0, 19, 19, 0, 0, 0, 0, 0, 10,
+    24, 3, 0, 5, 24, 24, 24, 24, 24, 24, 24, 1, 0, 3, 24, 24,
+    11, 0, 2, 16, 0, 0, 0, 0, 17, 24, 21, 0, 0, 0, 0, 0,
+    0, 0, 69, 224, 0, 69, 253, 16, 255, 55, 0, 0, 0, 84, 184, 0,
+    142, 129, 0, 0, 0, 30, 137, 240, 201, 91, 5, 0, 0, 16, 223, 157,
+    205, 129, 0, 0, 72, 161, 0, 0, 0, 0, 0, 0, 197, 126, 74, 235,
+    32, 0, 0, 0, 84, 244, 0, 0, 23, 183, 0, 0, 53, 153, 0, 0,
+    0, 2, 0, 193, 16, 2, 0, 0, 0, 0, 113, 135, 0, 0, 0, 0,
+    203, 168, 0, 63, 173, 173, 161, 0, 203, 164, 0, 0, 0, 0, 12, 182,
+    0, 0, 137, 248, 127, 185, 246, 48, 0, 0, 0, 41, 185, 205, 0, 0,
+    154, 217, 106, 123, 233, 107, 0, 0, 0, 184, 197, 95, 134, 250, 40, 0,
+    0, 0, 0, 0, 38, 243, 190, 0, 0, 0, 0, 168, 171, 99, 99, 99,
+    58, 0, 0, 0, 101, 252, 148, 111, 238, 72, 0, 0, 36, 99, 99, 99,
+    99, 137, 238, 19, 0, 0, 147, 207, 97, 129, 246, 47, 0, 0, 0, 179,
+    205, 97, 152, 243, 60, 0, 0, 122, 246, 0, 118, 249, 0, 0, 0, 0,
+    5, 86, 194, 225, 61, 0, 6, 21, 21, 21, 21, 21, 21, 8, 0, 47,
+    219, 203, 96, 8, 0, 0, 0, 0, 28, 172, 239, 241, 201, 52, 0, 0,
+    0, 0, 0, 17, 149, 233, 235, 238, 254, 212, 74, 0, 0, 0, 0, 0,
+    0, 0, 96, 255, 180, 0, 0, 0, 0, 0, 231, 255, 255, 255, 254, 214,
+    61, 0, 0, 0, 0, 76, 226, 254, 245, 223, 141, 4, 0, 0, 196, 255,
+    255, 255, 251, 208, 66, 0, 0, 0, 192, 255, 255, 255, 255, 255, 255, 61,
+    0, 192, 255, 255, 255, 255, 255, 255, 4, 0, 0, 0, 67, 215, 255, 244,
+    238, 166, 47, 0, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 97, 0, 0, 0, 58, 242, 121,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 247, 15, 0, 0, 0,
+    0, 114, 255, 137, 0, 242, 207, 4, 0, 0, 0, 70, 241, 0, 0, 0,
+    64, 220, 255, 246, 254, 196, 37, 0, 0, 0, 189, 255, 255, 255, 251, 187,
+    86, 0, 0, 0, 0, 63, 219, 255, 246, 254, 196, 37, 0, 0, 0, 182,
+    255, 255, 255, 255, 232, 155, 30, 0, 0, 0, 21, 161, 235, 227, 241, 170,
+    42, 0, 0, 181, 255, 255, 255, 255, 255, 255, 255, 54, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 95, 245, 12, 0, 0, 0, 0, 162, 185, 0,
+    138, 225, 0, 0, 0, 71, 255, 111, 0, 0, 0, 181, 182, 0, 31, 241,
+    122, 0, 0, 0, 37, 245, 104, 0, 113, 249, 39, 0, 0, 0, 0, 187,
+    198, 2, 0, 57, 255, 255, 255, 255, 255, 255, 255, 11, 0, 29, 255, 231,
+    106, 0, 3, 192, 0, 0, 0, 0, 160, 237, 224, 0, 0, 0, 0, 0,
+    0, 0, 69, 224, 0, 31, 217, 0, 231, 18, 0, 0, 0, 131, 137, 0,
+    187, 82, 0, 0, 1, 220, 126, 176, 96, 206, 94, 0, 0, 110, 134, 0,
+    13, 223, 7, 2, 200, 31, 0, 0, 0, 0, 0, 20, 255, 14, 0, 187,
+    95, 0, 0, 0, 45, 206, 0, 0, 147, 79, 0, 0, 0, 189, 37, 0,
+    0, 69, 203, 227, 185, 136, 0, 0, 0, 0, 113, 135, 0, 0, 0, 0,
+    7, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 109,
+    0, 10, 242, 87, 0, 1, 183, 154, 0, 0, 141, 255, 255, 205, 0, 5,
+    236, 67, 0, 0, 107, 213, 1, 0, 20, 250, 27, 0, 0, 178, 142, 0,
+    0, 0, 0, 6, 205, 205, 190, 0, 0, 0, 0, 203, 89, 0, 0, 0,
+    0, 0, 0, 2, 226, 100, 0, 0, 99, 135, 0, 0, 0, 0, 0, 0,
+    0, 186, 106, 0, 0, 12, 243, 63, 0, 0, 163, 156, 0, 0, 28, 250,
+    27, 0, 0, 160, 174, 0, 0, 22, 45, 0, 22, 46, 0, 0, 24, 125,
+    226, 182, 78, 3, 0, 0, 40, 129, 129, 129, 129, 129, 129, 51, 0, 0,
+    2, 72, 178, 232, 135, 30, 0, 0, 119, 179, 18, 9, 161, 172, 0, 0,
+    0, 0, 71, 233, 148, 31, 0, 7, 83, 177, 250, 147, 0, 0, 0, 0,
+    0, 0, 187, 210, 250, 20, 0, 0, 0, 0, 231, 104, 11, 11, 53, 178,
+    233, 7, 0, 0, 68, 252, 168, 46, 7, 71, 235, 96, 0, 0, 196, 138,
+    11, 11, 78, 190, 251, 66, 0, 0, 192, 141, 11, 11, 11, 11, 11, 3,
+    0, 192, 141, 11, 11, 11, 11, 11, 0, 0, 0, 65, 253, 186, 74, 2,
+    48, 172, 208, 3, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 97, 0, 0, 55, 241, 121, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 246, 94, 0, 0, 0,
+    0, 199, 246, 137, 0, 242, 252, 120, 0, 0, 0, 70, 241, 0, 0, 76,
+    251, 182, 69, 7, 93, 205, 243, 34, 0, 0, 189, 144, 11, 11, 35, 140,
+    247, 16, 0, 0, 76, 251, 182, 70, 7, 93, 206, 243, 35, 0, 0, 182,
+    151, 11, 11, 14, 64, 216, 145, 0, 0, 0, 127, 198, 28, 0, 28, 167,
+    170, 0, 0, 8, 11, 11, 105, 231, 11, 11, 11, 2, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 13, 245, 90, 0, 0, 0, 6, 239, 96, 0,
+    73, 255, 29, 0, 0, 141, 249, 183, 0, 0, 1, 238, 117, 0, 0, 99,
+    248, 41, 0, 2, 193, 182, 1, 0, 3, 203, 187, 0, 0, 0, 81, 251,
+    47, 0, 0, 2, 11, 11, 11, 11, 24, 221, 180, 1, 0, 29, 255, 9,
+    0, 0, 0, 155, 40, 0, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 69, 224, 0, 0, 96, 0, 96, 0, 0, 70, 239, 249, 246, 239,
+    252, 242, 121, 0, 57, 222, 0, 162, 46, 78, 148, 0, 0, 88, 162, 0,
+    31, 216, 2, 93, 140, 0, 0, 0, 0, 0, 0, 0, 199, 133, 102, 232,
+    25, 0, 0, 0, 4, 94, 0, 33, 211, 2, 0, 0, 0, 79, 167, 0,
+    0, 0, 69, 228, 147, 0, 0, 55, 178, 178, 212, 218, 178, 178, 70, 0,
+    113, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 29,
+    0, 60, 255, 33, 0, 0, 130, 218, 0, 0, 1, 2, 107, 205, 0, 31,
+    147, 4, 0, 0, 116, 236, 3, 0, 26, 83, 0, 0, 0, 203, 140, 0,
+    0, 0, 0, 140, 163, 120, 190, 0, 0, 0, 0, 238, 63, 82, 61, 0,
+    0, 0, 0, 48, 255, 38, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 204, 3, 0, 0, 4, 240, 99, 0, 1, 198, 147, 0, 0, 97, 219,
+    0, 0, 0, 96, 230, 0, 0, 0, 0, 0, 0, 0, 0, 75, 248, 149,
+    33, 0, 0, 0, 0, 0, 36, 118, 118, 118, 118, 118, 118, 47, 0, 0,
+    0, 0, 0, 32, 142, 249, 94, 0, 195, 91, 0, 0, 73, 246, 2, 0,
+    0, 28, 234, 76, 0, 0, 4, 19, 0, 0, 49, 245, 100, 0, 0, 0,
+    0, 26, 252, 59, 235, 104, 0, 0, 0, 0, 231, 97, 0, 0, 0, 56,
+    255, 33, 0, 0, 210, 168, 0, 0, 0, 0, 112, 222, 5, 0, 196, 133,
+    0, 0, 0, 0, 180, 199, 0, 0, 192, 136, 0, 0, 0, 0, 0, 0,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 0, 214, 180, 0, 0, 0,
+    0, 14, 221, 98, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 97, 0, 52, 239, 121, 0, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 172, 180, 0, 0, 0,
+    30, 243, 184, 137, 0, 242, 144, 246, 37, 0, 0, 70, 241, 0, 8, 222,
+    164, 0, 0, 0, 0, 0, 215, 176, 0, 0, 189, 140, 0, 0, 0, 5,
+    235, 102, 0, 8, 222, 164, 0, 0, 0, 0, 0, 217, 180, 0, 0, 182,
+    147, 0, 0, 0, 0, 116, 234, 0, 0, 1, 231, 95, 0, 0, 0, 35,
+    217, 19, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 0, 166, 178, 0, 0, 0, 74, 247, 15, 0,
+    12, 250, 88, 0, 0, 210, 143, 246, 9, 0, 42, 255, 52, 0, 0, 0,
+    180, 198, 3, 108, 236, 25, 0, 0, 0, 49, 251, 86, 0, 8, 222, 140,
+    0, 0, 0, 0, 0, 0, 0, 1, 172, 222, 17, 0, 0, 29, 255, 9,
+    0, 0, 0, 74, 120, 0, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 69, 224, 0, 0, 0, 0, 0, 0, 0, 0, 1, 226, 46, 28,
+    241, 2, 1, 0, 22, 239, 32, 162, 46, 0, 0, 0, 0, 6, 183, 216,
+    223, 88, 7, 207, 18, 0, 0, 0, 0, 0, 0, 0, 67, 255, 215, 31,
+    0, 0, 0, 0, 0, 0, 0, 119, 139, 0, 0, 0, 0, 4, 246, 8,
+    0, 0, 138, 30, 155, 13, 0, 21, 69, 69, 151, 167, 69, 69, 27, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 188, 0,
+    0, 85, 245, 2, 0, 0, 88, 241, 0, 0, 0, 0, 106, 205, 0, 0,
+    0, 0, 0, 43, 247, 150, 0, 0, 0, 0, 0, 149, 205, 201, 27, 0,
+    0, 0, 70, 220, 14, 120, 190, 0, 0, 0, 18, 255, 230, 175, 232, 213,
+    48, 0, 0, 76, 241, 86, 207, 234, 138, 21, 0, 0, 0, 0, 0, 12,
+    224, 54, 0, 0, 0, 0, 65, 245, 195, 224, 197, 17, 0, 0, 27, 252,
+    35, 0, 0, 176, 252, 3, 0, 0, 0, 0, 0, 0, 0, 33, 161, 235,
+    150, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 134, 228, 170, 42, 0, 0, 0, 0, 0, 163, 190, 0, 0,
+    0, 189, 134, 0, 9, 108, 208, 187, 84, 222, 49, 113, 219, 0, 0, 0,
+    0, 114, 217, 0, 154, 194, 0, 0, 0, 0, 231, 97, 0, 0, 1, 126,
+    226, 1, 0, 38, 255, 97, 0, 0, 0, 0, 1, 9, 1, 0, 196, 133,
+    0, 0, 0, 0, 112, 255, 12, 0, 192, 136, 0, 0, 0, 0, 0, 0,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 46, 255, 97, 0, 0, 0,
+    0, 0, 0, 0, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 97, 50, 238, 121, 0, 0, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 89, 246, 18, 0, 0,
+    115, 169, 174, 137, 0, 242, 69, 167, 190, 1, 0, 70, 241, 0, 60, 255,
+    80, 0, 0, 0, 0, 0, 133, 253, 9, 0, 189, 140, 0, 0, 0, 25,
+    250, 77, 0, 60, 255, 80, 0, 0, 0, 0, 0, 132, 253, 10, 0, 182,
+    147, 0, 0, 0, 0, 151, 199, 0, 0, 0, 196, 196, 44, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 0, 75, 249, 18, 0, 0, 157, 174, 0, 0,
+    0, 197, 147, 0, 26, 253, 23, 236, 71, 0, 100, 239, 3, 0, 0, 0,
+    25, 236, 142, 243, 84, 0, 0, 0, 0, 0, 138, 227, 12, 125, 225, 12,
+    0, 0, 0, 0, 0, 0, 0, 116, 247, 50, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 7, 187, 0, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 66, 222, 0, 0, 0, 0, 0, 0, 0, 0, 17, 248, 5, 72,
+    196, 0, 0, 0, 0, 140, 245, 227, 127, 24, 0, 0, 0, 0, 0, 31,
+    7, 0, 114, 119, 0, 18, 90, 21, 0, 0, 0, 66, 227, 149, 243, 49,
+    39, 133, 0, 0, 0, 0, 0, 165, 103, 0, 0, 0, 0, 0, 217, 51,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 135, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 122, 0,
+    0, 96, 227, 0, 0, 0, 71, 252, 1, 0, 0, 0, 106, 205, 0, 0,
+    0, 1, 102, 233, 154, 5, 0, 0, 0, 0, 0, 121, 182, 224, 70, 0,
+    0, 22, 227, 57, 0, 120, 190, 0, 0, 0, 23, 134, 31, 0, 6, 174,
+    156, 0, 0, 97, 255, 172, 39, 52, 201, 136, 0, 0, 0, 0, 0, 134,
+    160, 0, 0, 0, 0, 4, 156, 219, 128, 160, 230, 74, 0, 0, 0, 164,
+    235, 150, 201, 202, 251, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    121, 225, 193, 87, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    76, 181, 230, 131, 27, 0, 0, 0, 0, 0, 0, 139, 227, 37, 0, 0,
+    27, 247, 7, 0, 126, 186, 22, 0, 189, 227, 1, 41, 254, 20, 0, 0,
+    0, 205, 126, 0, 68, 253, 30, 0, 0, 0, 231, 215, 190, 191, 232, 246,
+    43, 0, 0, 74, 255, 28, 0, 0, 0, 0, 0, 0, 0, 0, 196, 133,
+    0, 0, 0, 0, 45, 255, 45, 0, 192, 223, 187, 187, 187, 187, 187, 6,
+    0, 192, 223, 187, 187, 187, 187, 66, 0, 0, 86, 251, 19, 0, 0, 33,
+    84, 84, 84, 69, 0, 217, 217, 187, 187, 187, 187, 212, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 144, 233, 250, 75, 0, 0, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 66, 189, 99, 0, 0,
+    200, 83, 174, 137, 0, 242, 69, 23, 237, 99, 0, 70, 241, 0, 100, 243,
+    9, 0, 0, 0, 0, 0, 51, 255, 46, 0, 189, 187, 106, 106, 130, 216,
+    230, 4, 0, 100, 243, 9, 0, 0, 0, 0, 0, 47, 255, 49, 0, 182,
+    199, 123, 123, 127, 181, 216, 47, 0, 0, 0, 52, 203, 254, 211, 142, 62,
+    0, 0, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 0, 5, 234, 100, 0, 5, 236, 86, 0, 0,
+    0, 132, 206, 0, 95, 205, 0, 167, 142, 0, 157, 178, 0, 0, 0, 0,
+    0, 93, 255, 168, 0, 0, 0, 0, 0, 0, 10, 221, 163, 245, 79, 0,
+    0, 0, 0, 0, 0, 0, 62, 251, 99, 0, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 0, 166, 28, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 46, 201, 0, 0, 0, 0, 0, 0, 0, 120, 170, 241, 149, 192,
+    217, 149, 9, 0, 0, 0, 61, 211, 234, 247, 100, 0, 0, 0, 0, 0,
+    0, 16, 208, 9, 59, 225, 157, 223, 72, 0, 5, 240, 77, 0, 126, 225,
+    140, 147, 0, 0, 0, 0, 0, 210, 67, 0, 0, 0, 0, 0, 181, 96,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 135, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 41, 0,
+    0, 73, 254, 11, 0, 0, 109, 231, 0, 0, 0, 0, 106, 205, 0, 0,
+    8, 164, 214, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 206, 0,
+    0, 144, 206, 114, 114, 181, 219, 114, 23, 0, 0, 0, 0, 0, 0, 77,
+    242, 7, 0, 79, 253, 32, 0, 0, 88, 229, 3, 0, 0, 0, 4, 234,
+    71, 0, 0, 0, 0, 67, 251, 26, 0, 0, 120, 222, 0, 0, 0, 0,
+    48, 127, 39, 107, 227, 0, 0, 54, 108, 0, 54, 110, 0, 0, 0, 0,
+    0, 4, 82, 190, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78,
+    200, 92, 7, 0, 0, 0, 0, 0, 0, 0, 90, 237, 35, 0, 0, 0,
+    83, 202, 0, 3, 226, 69, 0, 0, 189, 146, 0, 47, 233, 5, 0, 0,
+    41, 255, 63, 29, 32, 239, 118, 0, 0, 0, 231, 159, 99, 99, 110, 192,
+    208, 26, 0, 76, 253, 23, 0, 0, 0, 0, 0, 0, 0, 0, 196, 133,
+    0, 0, 0, 0, 50, 255, 41, 0, 192, 184, 103, 103, 103, 103, 103, 3,
+    0, 192, 184, 103, 103, 103, 103, 36, 0, 0, 82, 241, 0, 0, 0, 80,
+    205, 205, 221, 208, 0, 217, 169, 103, 103, 103, 103, 159, 234, 0, 157, 175,
+    0, 0, 0, 0, 0, 99, 229, 0, 231, 252, 92, 129, 231, 20, 0, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 66, 102, 185, 0, 31,
+    242, 9, 174, 137, 0, 242, 69, 0, 97, 238, 24, 70, 241, 0, 102, 240,
+    7, 0, 0, 0, 0, 0, 40, 255, 53, 0, 189, 223, 184, 184, 180, 108,
+    18, 0, 0, 102, 240, 7, 0, 0, 0, 0, 0, 46, 255, 49, 0, 182,
+    217, 166, 166, 167, 220, 226, 48, 0, 0, 0, 0, 2, 52, 119, 195, 255,
+    173, 9, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 0, 0, 146, 189, 0, 69, 243, 10, 0, 0,
+    0, 66, 252, 13, 165, 135, 0, 95, 214, 0, 215, 113, 0, 0, 0, 0,
+    0, 151, 248, 215, 10, 0, 0, 0, 0, 0, 0, 70, 255, 177, 0, 0,
+    0, 0, 0, 0, 0, 25, 231, 156, 0, 0, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 0, 87, 107, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 21, 176, 0, 0, 0, 0, 0, 0, 0, 73, 167, 189, 91, 203,
+    153, 91, 6, 0, 0, 0, 0, 162, 50, 119, 247, 14, 0, 0, 0, 0,
+    0, 136, 97, 0, 168, 77, 0, 61, 183, 0, 50, 246, 4, 0, 1, 176,
+    255, 68, 0, 0, 0, 0, 0, 240, 43, 0, 0, 0, 0, 0, 156, 127,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 192, 0, 0,
+    0, 38, 255, 51, 0, 0, 149, 196, 0, 0, 0, 0, 106, 205, 0, 0,
+    193, 159, 9, 0, 0, 0, 0, 0, 85, 177, 0, 0, 0, 90, 226, 0,
+    0, 101, 165, 165, 165, 207, 232, 165, 33, 0, 50, 86, 0, 0, 0, 84,
+    215, 0, 0, 48, 251, 23, 0, 0, 74, 229, 4, 0, 0, 0, 67, 242,
+    7, 0, 0, 0, 0, 94, 222, 0, 0, 0, 67, 243, 8, 0, 13, 61,
+    2, 0, 0, 160, 182, 0, 0, 122, 246, 0, 122, 249, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 159, 0, 0, 0, 0,
+    117, 182, 0, 62, 248, 5, 0, 13, 249, 64, 0, 130, 140, 0, 0, 0,
+    132, 252, 247, 247, 247, 250, 207, 0, 0, 0, 231, 97, 0, 0, 0, 2,
+    227, 113, 0, 45, 255, 96, 0, 0, 0, 0, 17, 174, 40, 0, 196, 133,
+    0, 0, 0, 0, 118, 254, 9, 0, 192, 136, 0, 0, 0, 0, 0, 0,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 44, 255, 34, 0, 0, 0,
+    0, 0, 125, 208, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 47, 34, 0, 0, 99, 229, 0, 231, 125, 0, 5, 204, 173, 0, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 66, 20, 247, 21, 115,
+    167, 0, 174, 137, 0, 242, 69, 0, 1, 188, 170, 70, 241, 0, 62, 255,
+    75, 0, 0, 0, 0, 0, 125, 254, 13, 0, 189, 140, 0, 0, 0, 0,
+    0, 0, 0, 62, 255, 75, 0, 0, 0, 0, 0, 135, 253, 9, 0, 182,
+    147, 0, 0, 0, 1, 186, 178, 0, 0, 17, 48, 0, 0, 0, 0, 59,
+    249, 86, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 210, 118, 0,
+    0, 0, 0, 91, 237, 0, 0, 0, 55, 252, 25, 153, 164, 0, 0, 0,
+    0, 9, 247, 70, 233, 66, 0, 25, 254, 49, 254, 48, 0, 0, 0, 0,
+    72, 249, 58, 219, 146, 0, 0, 0, 0, 0, 0, 0, 237, 92, 0, 0,
+    0, 0, 0, 0, 5, 194, 206, 8, 0, 0, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 0, 13, 181, 0, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 1, 103, 0, 0, 0, 0, 0, 0, 0, 0, 157, 114, 0, 212,
+    59, 0, 0, 0, 103, 134, 0, 162, 46, 16, 252, 22, 0, 0, 0, 0,
+    28, 202, 3, 0, 147, 100, 0, 82, 165, 0, 4, 230, 100, 0, 52, 192,
+    254, 155, 0, 0, 0, 0, 0, 203, 73, 0, 0, 0, 0, 0, 186, 90,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 135, 0, 0,
+    0, 0, 202, 162, 10, 48, 223, 103, 0, 0, 0, 0, 106, 205, 0, 35,
+    248, 63, 52, 52, 52, 52, 0, 0, 17, 246, 63, 0, 15, 187, 127, 0,
+    0, 0, 0, 0, 0, 120, 190, 0, 0, 0, 64, 254, 69, 0, 23, 189,
+    120, 0, 0, 1, 213, 141, 7, 16, 181, 135, 0, 0, 0, 0, 151, 171,
+    0, 0, 0, 0, 0, 11, 239, 86, 1, 13, 175, 150, 0, 0, 6, 225,
+    95, 0, 76, 235, 85, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 36, 0, 0, 0, 0,
+    53, 232, 0, 16, 247, 62, 15, 172, 253, 9, 73, 231, 41, 0, 0, 1,
+    222, 124, 0, 0, 0, 65, 255, 42, 0, 0, 231, 97, 0, 0, 0, 0,
+    187, 121, 0, 1, 222, 171, 0, 0, 0, 0, 114, 221, 2, 0, 196, 133,
+    0, 0, 0, 1, 190, 185, 0, 0, 192, 136, 0, 0, 0, 0, 0, 0,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 5, 218, 141, 0, 0, 0,
+    0, 3, 225, 208, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 189, 153, 0, 0, 124, 216, 0, 231, 97, 0, 0, 42, 247, 96, 0,
+    0, 0, 228, 101, 0, 0, 0, 0, 0, 0, 245, 66, 0, 185, 104, 200,
+    81, 0, 174, 137, 0, 242, 69, 0, 0, 36, 246, 148, 241, 0, 11, 228,
+    158, 0, 0, 0, 0, 0, 211, 188, 0, 0, 189, 140, 0, 0, 0, 0,
+    0, 0, 0, 11, 228, 158, 0, 0, 0, 133, 50, 222, 183, 0, 0, 182,
+    147, 0, 0, 0, 0, 120, 203, 0, 0, 53, 248, 9, 0, 0, 0, 0,
+    193, 140, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 156, 173, 0,
+    0, 0, 0, 146, 181, 0, 0, 0, 0, 218, 114, 233, 75, 0, 0, 0,
+    0, 0, 191, 177, 245, 7, 0, 0, 207, 177, 237, 2, 0, 0, 0, 18,
+    229, 131, 0, 63, 252, 68, 0, 0, 0, 0, 0, 0, 237, 91, 0, 0,
+    0, 0, 0, 0, 141, 238, 34, 0, 0, 0, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 0, 0, 176, 18, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 32, 99, 0, 0, 0, 0, 0, 0, 0, 0, 202, 67, 7, 249,
+    13, 0, 0, 0, 35, 218, 10, 162, 46, 104, 188, 0, 0, 0, 0, 0,
+    157, 76, 0, 0, 38, 210, 206, 214, 47, 0, 0, 101, 234, 225, 254, 182,
+    55, 240, 106, 0, 0, 0, 0, 157, 109, 0, 0, 0, 0, 0, 222, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 54, 0, 0,
+    0, 0, 47, 233, 224, 250, 174, 7, 0, 0, 0, 0, 106, 205, 0, 102,
+    255, 255, 255, 255, 255, 255, 2, 0, 0, 117, 230, 220, 240, 176, 24, 0,
+    0, 0, 0, 0, 0, 120, 190, 0, 0, 0, 0, 142, 254, 219, 238, 154,
+    20, 0, 0, 0, 56, 235, 233, 238, 171, 28, 0, 0, 0, 3, 232, 93,
+    0, 0, 0, 0, 0, 0, 96, 218, 224, 242, 182, 35, 0, 0, 0, 89,
+    236, 223, 254, 145, 0, 0, 0, 0, 0, 0, 64, 109, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 64, 0, 0, 0, 0,
+    2, 231, 92, 0, 112, 231, 189, 90, 221, 222, 175, 53, 0, 0, 0, 59,
+    254, 35, 0, 0, 0, 3, 230, 131, 0, 0, 231, 119, 35, 35, 42, 115,
+    249, 26, 0, 0, 86, 250, 158, 41, 3, 70, 223, 115, 0, 0, 196, 149,
+    35, 35, 102, 213, 245, 51, 0, 0, 192, 152, 35, 35, 35, 35, 35, 17,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 0, 76, 250, 116, 7, 0,
+    50, 158, 239, 208, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 112, 221, 13, 12, 193, 132, 0, 231, 97, 0, 0, 0, 113, 241, 32,
+    0, 0, 228, 122, 35, 35, 35, 35, 13, 0, 245, 66, 0, 98, 214, 241,
+    9, 0, 174, 137, 0, 242, 69, 0, 0, 0, 119, 253, 241, 0, 0, 87,
+    250, 165, 53, 2, 76, 188, 247, 42, 0, 0, 189, 140, 0, 0, 0, 0,
+    0, 0, 0, 0, 87, 250, 164, 52, 0, 107, 249, 249, 37, 0, 0, 182,
+    147, 0, 0, 0, 0, 103, 216, 0, 0, 7, 223, 160, 11, 0, 0, 71,
+    249, 69, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 49, 251, 72,
+    6, 5, 67, 242, 69, 0, 0, 0, 0, 126, 238, 236, 5, 0, 0, 0,
+    0, 0, 125, 254, 182, 0, 0, 0, 136, 254, 174, 0, 0, 0, 0, 168,
+    212, 7, 0, 0, 150, 226, 16, 0, 0, 0, 0, 0, 237, 91, 0, 0,
+    0, 0, 0, 83, 254, 110, 35, 35, 35, 35, 35, 2, 0, 29, 255, 9,
+    0, 0, 0, 0, 0, 100, 94, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 72, 224, 0, 0, 0, 0, 0, 0, 0, 0, 64, 10, 9, 65,
+    0, 0, 0, 0, 0, 135, 209, 225, 218, 202, 60, 0, 0, 0, 0, 0,
+    64, 0, 0, 0, 0, 0, 40, 1, 0, 0, 0, 0, 5, 64, 43, 0,
+    0, 0, 0, 0, 0, 0, 0, 110, 147, 0, 0, 0, 0, 8, 244, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 193, 1, 0, 0,
+    0, 0, 0, 9, 61, 40, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 56, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 69, 14, 0,
+    0, 0, 0, 0, 0, 11, 60, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 50, 22, 0, 0, 0, 0, 0, 0,
+    6, 65, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 145, 0, 0, 0, 0,
+    0, 94, 238, 61, 0, 8, 2, 0, 6, 28, 0, 0, 0, 0, 0, 150,
+    199, 0, 0, 0, 0, 0, 145, 220, 1, 0, 231, 255, 255, 255, 249, 176,
+    76, 0, 0, 0, 0, 99, 241, 253, 236, 222, 135, 15, 0, 0, 196, 255,
+    255, 255, 236, 184, 47, 0, 0, 0, 192, 255, 255, 255, 255, 255, 255, 124,
+    0, 192, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 235, 250, 226,
+    253, 155, 43, 208, 0, 217, 111, 0, 0, 0, 0, 95, 234, 0, 157, 175,
+    0, 20, 199, 240, 236, 200, 33, 0, 231, 97, 0, 0, 0, 2, 191, 192,
+    2, 0, 228, 255, 255, 255, 255, 255, 97, 0, 245, 66, 0, 18, 249, 165,
+    0, 0, 174, 137, 0, 242, 69, 0, 0, 0, 4, 207, 241, 0, 0, 0,
+    79, 233, 255, 235, 255, 212, 47, 0, 0, 0, 189, 140, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 233, 255, 228, 248, 193, 227, 132, 2, 0, 182,
+    147, 0, 0, 0, 0, 63, 253, 60, 0, 0, 52, 217, 250, 220, 235, 240,
+    112, 0, 0, 0, 0, 0, 98, 230, 0, 0, 0, 0, 0, 0, 123, 214,
+    242, 239, 218, 132, 1, 0, 0, 0, 0, 35, 254, 153, 0, 0, 0, 0,
+    0, 0, 60, 255, 113, 0, 0, 0, 64, 255, 109, 0, 0, 0, 89, 252,
+    54, 0, 0, 0, 13, 225, 164, 0, 0, 0, 0, 0, 237, 91, 0, 0,
+    0, 0, 0, 156, 255, 255, 255, 255, 255, 255, 255, 18, 0, 29, 255, 9,
+    0, 0, 0, 0, 0, 22, 172, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 185, 79, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 20, 217, 7, 0, 0, 0, 96, 147, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 72, 241, 161, 82, 41, 53, 96, 81, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 47, 53, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 44, 64,
+    14, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 33, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 39, 69, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 39, 65, 12, 0, 25, 142, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 49, 75, 53, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    38, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 255, 9,
+    0, 0, 0, 0, 0, 0, 54, 0, 0, 69, 224, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 121, 34, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 125, 98, 0, 0, 1, 199, 23, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 36, 112, 171, 228, 212, 164, 100, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 255, 24,
+    7, 0, 0, 0, 0, 0, 0, 0, 11, 80, 224, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 12, 178, 0, 0, 63, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 239, 239,
+    110, 0, 0, 0, 0, 0, 0, 0, 166, 239, 210, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 91, 187, 2, 0, 0, 20, 65, 65, 65, 65, 65, 65, 65,
+    65, 0, 0, 36, 59, 0, 0, 0, 0, 0, 27, 94, 74, 13, 0, 0,
+    0, 6, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 88, 45, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 20, 0, 0, 0, 1, 74, 73, 9,
+    0, 0, 0, 0, 0, 9, 14, 0, 0, 0, 13, 84, 7, 19, 50, 0,
+    1, 24, 3, 0, 0, 0, 0, 0, 2, 24, 2, 0, 0, 1, 24, 3,
+    0, 5, 23, 0, 0, 0, 0, 0, 0, 1, 24, 3, 0, 2, 65, 5,
+    73, 77, 0, 0, 64, 100, 28, 0, 0, 2, 65, 3, 59, 99, 32, 0,
+    0, 0, 0, 5, 83, 39, 0, 0, 0, 0, 16, 53, 11, 79, 72, 1,
+    0, 0, 0, 0, 0, 13, 87, 12, 11, 56, 0, 3, 65, 3, 73, 50,
+    0, 0, 0, 46, 99, 37, 0, 0, 0, 0, 52, 21, 0, 0, 7, 65,
+    3, 0, 0, 31, 44, 0, 53, 31, 0, 0, 0, 40, 44, 0, 57, 25,
+    0, 0, 53, 43, 0, 0, 35, 50, 0, 35, 50, 0, 0, 0, 59, 25,
+    0, 44, 36, 0, 0, 0, 44, 37, 0, 18, 65, 65, 65, 65, 65, 9,
+    0, 0, 0, 0, 18, 0, 15, 5, 0, 14, 4, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 10, 135, 135, 135, 135, 135, 65, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 204, 204, 70, 0, 0, 34, 111, 111, 111, 111, 111, 111, 111,
+    111, 0, 0, 25, 215, 90, 0, 0, 0, 120, 238, 175, 198, 245, 23, 0,
+    0, 64, 229, 0, 0, 0, 0, 0, 0, 0, 0, 102, 230, 187, 229, 186,
+    0, 0, 0, 0, 0, 0, 0, 75, 218, 0, 0, 76, 215, 195, 222, 233,
+    32, 0, 0, 0, 87, 242, 132, 0, 0, 111, 235, 189, 211, 148, 197, 0,
+    8, 255, 30, 0, 0, 0, 0, 0, 22, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 243, 0, 0, 0, 0, 0, 0, 15, 255, 27, 0, 8, 255, 175,
+    182, 208, 194, 160, 203, 186, 253, 41, 0, 8, 255, 143, 211, 177, 249, 76,
+    0, 0, 97, 228, 196, 233, 184, 29, 0, 0, 64, 220, 200, 213, 225, 208,
+    55, 0, 0, 0, 116, 237, 194, 222, 149, 218, 0, 11, 255, 138, 250, 93,
+    0, 0, 185, 219, 172, 234, 131, 0, 0, 0, 210, 83, 0, 0, 26, 255,
+    13, 0, 0, 121, 172, 0, 152, 176, 0, 0, 0, 213, 112, 0, 178, 142,
+    0, 4, 242, 211, 0, 0, 176, 148, 0, 38, 241, 52, 0, 82, 227, 17,
+    0, 120, 193, 0, 0, 2, 227, 87, 0, 54, 193, 193, 193, 214, 255, 29,
+    0, 0, 6, 202, 182, 0, 157, 55, 0, 128, 222, 43, 0, 0, 102, 233,
+    179, 38, 0, 126, 1, 0, 18, 233, 102, 102, 102, 170, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 52, 192, 68, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 25, 167, 8, 0, 3, 203, 65, 0, 0, 188, 120, 0,
+    0, 64, 229, 0, 0, 0, 0, 0, 0, 0, 6, 241, 63, 0, 11, 235,
+    57, 0, 0, 0, 0, 0, 0, 75, 218, 0, 0, 210, 90, 0, 3, 164,
+    191, 0, 0, 0, 187, 145, 0, 0, 11, 247, 57, 0, 26, 231, 197, 0,
+    8, 255, 30, 0, 0, 0, 0, 0, 8, 92, 7, 0, 0, 3, 92, 11,
+    0, 50, 243, 0, 0, 0, 0, 0, 0, 15, 255, 27, 0, 8, 255, 126,
+    0, 10, 243, 179, 0, 0, 199, 126, 0, 8, 255, 161, 1, 0, 150, 175,
+    0, 2, 231, 86, 0, 12, 186, 119, 0, 0, 64, 255, 140, 3, 6, 158,
+    168, 0, 0, 15, 250, 63, 0, 24, 218, 218, 0, 11, 255, 178, 17, 0,
+    0, 52, 245, 12, 0, 63, 175, 1, 0, 52, 221, 127, 34, 0, 26, 255,
+    13, 0, 0, 121, 172, 0, 63, 247, 13, 0, 47, 249, 20, 0, 104, 208,
+    0, 53, 227, 252, 21, 3, 239, 73, 0, 0, 110, 211, 26, 231, 67, 0,
+    0, 34, 252, 24, 0, 64, 240, 9, 0, 0, 0, 0, 11, 207, 135, 0,
+    0, 0, 63, 206, 0, 0, 157, 55, 0, 0, 143, 127, 0, 0, 189, 32,
+    80, 222, 191, 174, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 155, 89, 1, 214, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 28, 77, 221, 137, 0,
+    0, 64, 229, 0, 36, 74, 2, 0, 0, 0, 69, 225, 0, 0, 0, 32,
+    22, 0, 0, 0, 16, 87, 10, 75, 218, 0, 36, 240, 50, 46, 46, 100,
+    241, 0, 0, 49, 214, 135, 37, 0, 78, 216, 0, 0, 0, 165, 197, 0,
+    8, 255, 31, 65, 100, 31, 0, 0, 3, 44, 3, 0, 0, 2, 65, 8,
+    0, 50, 243, 0, 0, 7, 65, 25, 0, 15, 255, 27, 0, 8, 255, 43,
+    0, 0, 209, 96, 0, 0, 156, 140, 0, 8, 255, 72, 0, 0, 104, 189,
+    0, 56, 239, 4, 0, 0, 102, 195, 0, 0, 64, 255, 42, 0, 0, 60,
+    238, 4, 0, 86, 212, 0, 0, 0, 141, 218, 0, 11, 255, 86, 0, 0,
+    0, 22, 250, 143, 50, 3, 0, 0, 0, 141, 241, 201, 90, 0, 26, 255,
+    13, 0, 0, 121, 172, 0, 2, 226, 89, 0, 136, 171, 0, 0, 30, 253,
+    22, 115, 152, 205, 84, 51, 245, 9, 0, 0, 2, 190, 231, 144, 0, 0,
+    0, 0, 203, 106, 0, 155, 154, 0, 0, 0, 0, 2, 174, 178, 2, 0,
+    0, 0, 83, 189, 0, 0, 157, 55, 0, 0, 125, 147, 0, 0, 0, 0,
+    0, 4, 50, 3, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 223, 7, 0, 116, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 142, 235, 211, 164, 202, 137, 0,
+    0, 64, 237, 151, 207, 225, 215, 63, 0, 0, 126, 178, 0, 0, 0, 0,
+    0, 0, 0, 127, 241, 194, 221, 169, 218, 0, 94, 242, 194, 194, 194, 194,
+    194, 11, 0, 131, 238, 204, 100, 0, 133, 172, 0, 0, 0, 120, 197, 0,
+    8, 255, 178, 209, 175, 250, 72, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 243, 0, 7, 179, 183, 8, 0, 15, 255, 27, 0, 8, 255, 34,
+    0, 0, 209, 87, 0, 0, 156, 140, 0, 8, 255, 34, 0, 0, 104, 189,
+    0, 108, 197, 0, 0, 0, 54, 248, 3, 0, 64, 248, 2, 0, 0, 10,
+    254, 42, 0, 144, 162, 0, 0, 0, 93, 218, 0, 11, 255, 32, 0, 0,
+    0, 0, 57, 166, 244, 226, 106, 0, 0, 0, 210, 83, 0, 0, 26, 255,
+    13, 0, 0, 122, 172, 0, 0, 138, 173, 1, 223, 74, 0, 0, 0, 211,
+    87, 178, 89, 140, 149, 116, 178, 0, 0, 0, 0, 103, 255, 65, 0, 0,
+    0, 0, 117, 189, 7, 238, 61, 0, 0, 0, 0, 133, 211, 13, 0, 0,
+    0, 0, 83, 189, 0, 0, 157, 55, 0, 0, 125, 147, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 34, 74, 0, 0, 18, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 250, 50, 0, 0, 162, 137, 0,
+    0, 64, 255, 137, 3, 7, 158, 176, 0, 0, 67, 229, 1, 0, 0, 84,
+    63, 0, 21, 252, 63, 0, 24, 217, 218, 0, 32, 238, 2, 0, 0, 14,
+    46, 0, 0, 0, 199, 94, 0, 0, 74, 226, 0, 0, 0, 171, 197, 0,
+    8, 255, 157, 1, 0, 159, 171, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 243, 7, 179, 182, 8, 0, 0, 15, 255, 27, 0, 8, 255, 34,
+    0, 0, 209, 87, 0, 0, 156, 140, 0, 8, 255, 34, 0, 0, 104, 189,
+    0, 46, 245, 7, 0, 0, 110, 189, 0, 0, 64, 255, 51, 0, 0, 67,
+    235, 3, 0, 88, 222, 0, 0, 0, 148, 218, 0, 11, 255, 30, 0, 0,
+    0, 20, 30, 0, 5, 83, 251, 41, 0, 0, 210, 83, 0, 0, 26, 255,
+    13, 0, 0, 171, 172, 0, 0, 49, 245, 70, 228, 3, 0, 0, 0, 137,
+    156, 238, 27, 74, 213, 181, 103, 0, 0, 0, 26, 234, 155, 216, 9, 0,
+    0, 0, 32, 251, 103, 221, 1, 0, 0, 0, 91, 235, 34, 0, 0, 0,
+    0, 0, 103, 176, 0, 0, 157, 55, 0, 0, 110, 166, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 71, 235, 7, 0, 37, 243, 143, 0,
+    0, 64, 255, 38, 0, 0, 60, 244, 8, 0, 5, 239, 94, 2, 25, 241,
+    47, 0, 96, 212, 0, 0, 0, 141, 218, 0, 0, 206, 134, 12, 3, 172,
+    142, 0, 0, 0, 199, 94, 0, 0, 8, 243, 90, 1, 50, 237, 196, 0,
+    8, 255, 69, 0, 0, 107, 186, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 245, 179, 255, 50, 0, 0, 0, 15, 255, 27, 0, 8, 255, 34,
+    0, 0, 209, 87, 0, 0, 156, 140, 0, 8, 255, 34, 0, 0, 104, 189,
+    0, 0, 224, 116, 4, 32, 203, 109, 0, 0, 64, 255, 163, 15, 22, 178,
+    159, 0, 0, 16, 250, 97, 3, 49, 227, 218, 0, 11, 255, 30, 0, 0,
+    0, 66, 237, 16, 0, 29, 242, 35, 0, 0, 210, 83, 0, 0, 12, 245,
+    76, 0, 37, 241, 172, 0, 0, 0, 214, 221, 133, 0, 0, 0, 0, 63,
+    245, 219, 0, 13, 250, 245, 29, 0, 0, 1, 184, 139, 2, 195, 140, 0,
+    0, 0, 0, 201, 241, 128, 0, 0, 0, 55, 242, 67, 3, 3, 3, 1,
+    0, 19, 189, 120, 0, 0, 157, 55, 0, 0, 48, 223, 42, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 199, 228, 198, 165, 153, 249, 71,
+    0, 64, 245, 1, 0, 0, 10, 254, 41, 0, 0, 85, 209, 222, 240, 149,
+    0, 0, 143, 162, 0, 0, 0, 93, 218, 0, 0, 62, 190, 233, 234, 199,
+    18, 0, 0, 0, 199, 94, 0, 0, 0, 90, 221, 224, 234, 161, 184, 0,
+    8, 255, 30, 0, 0, 107, 186, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 255, 160, 169, 194, 1, 0, 0, 15, 255, 27, 0, 8, 255, 34,
+    0, 0, 209, 87, 0, 0, 156, 140, 0, 8, 255, 34, 0, 0, 104, 189,
+    0, 0, 74, 198, 227, 237, 149, 18, 0, 0, 64, 238, 134, 223, 243, 176,
+    39, 0, 0, 0, 102, 222, 228, 199, 138, 218, 0, 11, 255, 30, 0, 0,
+    0, 1, 183, 245, 208, 238, 136, 0, 0, 0, 210, 83, 0, 0, 0, 137,
+    248, 202, 231, 141, 172, 0, 0, 0, 125, 254, 36, 0, 0, 0, 0, 5,
+    240, 156, 0, 0, 197, 209, 0, 0, 0, 107, 216, 9, 0, 39, 244, 58,
+    0, 0, 0, 115, 254, 35, 0, 0, 0, 146, 255, 255, 255, 255, 255, 84,
+    0, 101, 220, 7, 0, 0, 157, 55, 0, 0, 0, 160, 158, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 27, 0, 6, 64, 23,
+    0, 64, 255, 48, 0, 0, 69, 228, 1, 0, 0, 0, 0, 53, 13, 0,
+    0, 0, 79, 222, 0, 0, 0, 148, 218, 0, 0, 0, 0, 42, 29, 0,
+    0, 0, 0, 0, 199, 94, 0, 0, 14, 37, 4, 60, 13, 164, 159, 0,
+    8, 255, 30, 0, 0, 107, 186, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 245, 2, 24, 239, 100, 0, 0, 15, 255, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 15, 0, 0, 0, 0, 64, 232, 0, 17, 38, 0,
+    0, 0, 0, 0, 0, 3, 50, 0, 75, 218, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 62, 8, 0, 0, 0, 0, 210, 87, 0, 0, 0, 0,
+    25, 62, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 116, 196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 169, 126, 0, 0, 157, 55, 0, 0, 62, 216, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 255, 160, 14, 23, 180, 154, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 12, 248, 97, 3, 49, 227, 218, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 199, 94, 0, 0, 18, 237, 78, 9, 84, 233, 77, 0,
+    8, 255, 30, 0, 0, 107, 186, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 243, 0, 0, 105, 237, 22, 0, 15, 255, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 232, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 218, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 219, 95, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 47, 225, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 97, 180, 0, 0, 157, 55, 0, 0, 116, 160, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 210, 185, 236, 242, 167, 34, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 93, 216, 228, 250, 137, 218, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 199, 94, 0, 0, 0, 79, 185, 242, 216, 112, 0, 0,
+    8, 255, 30, 0, 0, 107, 186, 0, 18, 255, 20, 0, 0, 8, 255, 30,
+    0, 50, 243, 0, 0, 2, 199, 163, 0, 15, 255, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 232, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 218, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 67, 33, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 56, 242, 157, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 83, 189, 0, 0, 157, 55, 0, 0, 125, 147, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 46, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 59, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 2, 0, 0, 8, 255, 30,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 83, 189, 0, 0, 157, 55, 0, 0, 125, 147, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 252, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 54, 216, 8, 0, 157, 55, 0, 2, 160, 117, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 218, 0, 0, 0, 114, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 235, 137, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 164, 192, 0, 147, 51, 0, 140, 190, 30, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 18, 252, 237, 237, 237, 245, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
@@ -0,0 +1,147 @@
+/*
+ * Vulkan
+ *
+ * Copyright (C) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures what the overlay layer adds to vkCreateDevice and vkDestroyDevice,
+ * where it builds its pipeline and font atlas, by timing device creation on
+ * the first GPU with and without the layer enabled.  The layer must be
+ * findable by the loader, e.g. through VK_LAYER_PATH.
+ *
+ * Usage: overlay_startup_bench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+namespace {
+
+const char *const overlay_layer = "VK_LAYER_LUNARG_overlay";
+
+bool have_overlay_layer() {
+    uint32_t count = 0;
+    if (vkEnumerateInstanceLayerProperties(&count, nullptr) != VK_SUCCESS) return false;
+
+    std::vector<VkLayerProperties> layers(count);
+    if (count && vkEnumerateInstanceLayerProperties(&count, &layers[0]) != VK_SUCCESS) return false;
+
+    for (const auto &layer : layers) {
+        if (!strcmp(layer.layerName, overlay_layer)) return true;
+    }
+    return false;
+}
+
+/* Returns the average milliseconds per vkCreateDevice/vkDestroyDevice pair,
+ * or a negative value on failure. */
+double time_device_creation(bool with_overlay, int iterations) {
+    VkApplicationInfo app = {};
+    app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app.pApplicationName = "overlay_startup_bench";
+    app.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo ici = {};
+    ici.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    ici.pApplicationInfo = &app;
+    ici.enabledLayerCount = with_overlay ? 1 : 0;
+    ici.ppEnabledLayerNames = with_overlay ? &overlay_layer : nullptr;
+
+    VkInstance instance;
+    if (vkCreateInstance(&ici, nullptr, &instance) != VK_SUCCESS) return -1.0;
+
+    uint32_t gpuCount = 1;
+    VkPhysicalDevice gpu;
+    VkResult err = vkEnumeratePhysicalDevices(instance, &gpuCount, &gpu);
+    if ((err != VK_SUCCESS && err != VK_INCOMPLETE) || !gpuCount) {
+        vkDestroyInstance(instance, nullptr);
+        return -1.0;
+    }
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &familyCount, families.data());
+
+    uint32_t family = 0;
+    while (family < familyCount && !(families[family].queueFlags & VK_QUEUE_GRAPHICS_BIT)) family++;
+    if (family == familyCount) {
+        vkDestroyInstance(instance, nullptr);
+        return -1.0;
+    }
+
+    const float priority = 0.0f;
+    VkDeviceQueueCreateInfo qci = {};
+    qci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    qci.queueFamilyIndex = family;
+    qci.queueCount = 1;
+    qci.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo dci = {};
+    dci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    dci.queueCreateInfoCount = 1;
+    dci.pQueueCreateInfos = &qci;
+
+    double ms = 0.0;
+    for (int i = 0; i < iterations && ms >= 0.0; i++) {
+        auto start = std::chrono::steady_clock::now();
+
+        VkDevice device;
+        if (vkCreateDevice(gpu, &dci, nullptr, &device) != VK_SUCCESS) {
+            ms = -1.0;
+            break;
+        }
+        vkDestroyDevice(device, nullptr);
+
+        auto end = std::chrono::steady_clock::now();
+        ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    vkDestroyInstance(instance, nullptr);
+    return ms < 0.0 ? ms : ms / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const int iterations = (argc > 1) ? atoi(argv[1]) : 20;
+    if (iterations <= 0) {
+        printf("usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    if (!have_overlay_layer()) {
+        printf("%s not found, set VK_LAYER_PATH to the directory holding its manifest\n", overlay_layer);
+        return 0;
+    }
+
+    const double without = time_device_creation(false, iterations);
+    const double with = time_device_creation(true, iterations);
+    if (without < 0.0 || with < 0.0) {
+        printf("failed to create a device\n");
+        return 1;
+    }
+
+    printf("vkCreateDevice + vkDestroyDevice, average of %d (ms)\n", iterations);
+    printf("  without overlay: %8.3f\n", without);
+    printf("  with overlay:    %8.3f\n", with);
+    printf("  overlay cost:    %8.3f\n", with - without);
+
+    return 0;
+}
@@ -44,6 +44,26 @@ class Game {
         bool no_tick;
         bool no_render;
         bool no_present;
+
+        // on_tick may only queue the tick; it then runs concurrently with
+        // the next on_frame, which draws the state of the previous ticks
+        bool pipelined;
+
+        // advance game time by exactly one tick per frame regardless of the
+        // wall clock, so that a run can be reproduced
+        bool fixed_timestep;
+
+        // render offscreen with one tick per frame and quit after
+        // max_frame_count frames (or a default count when not positive),
+        // optionally dumping every frame
+        bool headless;
+        int max_frame_count;
+        bool dump_frames;
+
+        // report CPU and GPU time spans periodically, and write them to
+        // trace_file as a Chrome trace when it is not empty
+        bool profile;
+        std::string trace_file;
     };
     const Settings &settings() const { return settings_; }
 
@@ -87,6 +107,15 @@ class Game {
         settings_.no_render = false;
         settings_.no_present = false;
 
+        settings_.pipelined = false;
+        settings_.fixed_timestep = false;
+
+        settings_.headless = false;
+        settings_.max_frame_count = 0;
+        settings_.dump_frames = false;
+
+        settings_.profile = false;
+
         parse_args(args);
     }
 
@@ -115,8 +144,28 @@ class Game {
                 settings_.no_render = true;
             } else if (*it == "-np") {
                 settings_.no_present = true;
+            } else if (*it == "--pipelined") {
+                settings_.pipelined = true;
+            } else if (*it == "--fixed-timestep") {
+                settings_.fixed_timestep = true;
+            } else if (*it == "--headless") {
+                settings_.headless = true;
+            } else if (*it == "--frames") {
+                ++it;
+                settings_.max_frame_count = std::stoi(*it);
+            } else if (*it == "--dump-frames") {
+                settings_.dump_frames = true;
+            } else if (*it == "--profile") {
+                settings_.profile = true;
+            } else if (*it == "--trace") {
+                ++it;
+                settings_.profile = true;
+                settings_.trace_file = *it;
             }
         }
+
+        // queued ticks are run by on_frame
+        if (settings_.no_render) settings_.pipelined = false;
     }
 };
 
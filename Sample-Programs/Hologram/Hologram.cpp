@@ -15,15 +15,24 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <random>
+#include <sstream>
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "Helpers.h"
 #include "Hologram.h"
+#include "MemoryAllocator.h"
 #include "Meshes.h"
+#include "PipelineCache.h"
 #include "Shell.h"
+#include "UploadRing.h"
 
 namespace {
 
@@ -37,16 +46,93 @@ struct ShaderParamBlock {
     float alpha;
 };
 
+// per-instance vertex attributes of Hologram.instanced.vert
+struct InstanceData {
+    float model[4 * 4];
+    float light_pos[3];
+    float light_color[3];
+    float alpha;
+};
+
+bool has_arg(const std::vector<std::string> &args, const std::string &arg) {
+    return std::find(args.begin(), args.end(), arg) != args.end();
+}
+
+int object_count(const std::vector<std::string> &args) {
+    auto it = std::find(args.begin(), args.end(), "--objects");
+    if (it != args.end() && ++it != args.end()) return std::stoi(*it);
+
+    return 5000;
+}
+
+const char *arg_value(const std::vector<std::string> &args, const std::string &arg) {
+    auto it = std::find(args.begin(), args.end(), arg);
+    if (it != args.end() && ++it != args.end()) return it->c_str();
+
+    return nullptr;
+}
+
+// used when a run should be reproducible but no seed is given
+const unsigned int default_seed = 5489;
+
+unsigned int simulation_seed(const std::vector<std::string> &args, const Game::Settings &settings) {
+    const char *seed = arg_value(args, "--seed");
+    if (seed) return static_cast<unsigned int>(std::stoul(seed));
+
+    // a replay starts with the seed it was recorded with
+    const char *replay = arg_value(args, "--replay");
+    if (replay) {
+        std::ifstream file(replay);
+        std::string key;
+        unsigned int replay_seed;
+        if (file >> key >> replay_seed && key == "seed") return replay_seed;
+    }
+
+    if (settings.headless || settings.fixed_timestep || has_arg(args, "--record")) return default_seed;
+
+    return std::random_device()();
+}
+
+// the batched path has its own sincos, so its transforms do not depend on the
+// libm of the machine; recordings and replays always use it
+bool use_batched_simulation(const std::vector<std::string> &args) {
+    return has_arg(args, "--soa") || has_arg(args, "--record") || has_arg(args, "--replay");
+}
+
+// objects per scheduler chunk; a multiple of the SIMD width of Simulation
+const int object_chunk_size = 64;
+
+// frames per frame time report
+const size_t frame_time_report_interval = 300;
+
+float percentile(const std::vector<float> &sorted, float p) {
+    size_t idx = static_cast<size_t>(p * static_cast<float>(sorted.size() - 1) + 0.5f);
+    return sorted[idx];
+}
+
 }  // namespace
 
 Hologram::Hologram(const std::vector<std::string> &args)
     : Game("Hologram", args),
       multithread_(true),
       use_push_constants_(false),
+      use_instancing_(false),
+      fixed_workers_(false),
+      frames_in_flight_(2),
       sim_paused_(false),
       sim_fade_(false),
-      sim_(5000),
+      sim_seed_(simulation_seed(args, settings_)),
+      sim_(object_count(args), use_batched_simulation(args), sim_seed_),
       camera_(2.5f),
+      worker_count_(0),
+      queued_ticks_(0),
+      frame_ticks_(0),
+      tick_time_(0.0),
+      sim_ticks_(0),
+      last_hashed_tick_(-1),
+      replay_mismatch_tick_(-1),
+      profiler_(nullptr),
+      timestamp_mask_(0),
       frame_data_(),
       render_pass_clear_value_({{0.0f, 0.1f, 0.2f, 1.0f}}),
       render_pass_begin_info_(),
@@ -57,8 +143,38 @@ Hologram::Hologram(const std::vector<std::string> &args)
             multithread_ = false;
         else if (*it == "-p")
             use_push_constants_ = true;
+        else if (*it == "-i")
+            use_instancing_ = true;
+        else if (*it == "--fixed-workers")
+            fixed_workers_ = true;
+        else if (*it == "--frames-in-flight" && it + 1 != args.end())
+            frames_in_flight_ = std::max(std::stoi(*++it), 1);
+        else if (*it == "--pipeline-cache" && it + 1 != args.end())
+            pipeline_cache_dir_ = *++it;
+    }
+
+    const char *record = arg_value(args, "--record");
+    const char *replay = arg_value(args, "--replay");
+    if (record) {
+        record_file_.open(record);
+        record_file_ << "seed " << sim_seed_ << "\n";
+    } else if (replay) {
+        replay_file_.open(replay);
+        std::string line;
+        std::getline(replay_file_, line);
     }
 
+    // transform hashes are only comparable when the ticks do not depend on
+    // the wall clock
+    if (record_file_.is_open() || replay_file_.is_open()) settings_.fixed_timestep = true;
+
+    // instancing passes the per-object data as vertex attributes instead
+    if (use_instancing_) use_push_constants_ = false;
+
+    // pipelining is implemented on top of the scheduler
+    if (fixed_workers_) settings_.pipelined = false;
+    sim_.set_double_buffered(settings_.pipelined);
+
     init_workers();
 }
 
@@ -73,6 +189,14 @@ void Hologram::init_workers() {
         worker_count = 1;
     }
 
+    worker_count_ = worker_count;
+    frame_times_.reserve(frame_time_report_interval);
+
+    if (!fixed_workers_) {
+        scheduler_.reset(new TaskScheduler(worker_count));
+        return;
+    }
+
     assert(sim_.objects().size() <= INT32_MAX);
     const int object_per_worker = static_cast<int>(sim_.objects().size() / worker_count);
     int object_begin = 0, object_end = 0;
@@ -93,6 +217,10 @@ void Hologram::init_workers() {
 void Hologram::attach_shell(Shell &sh) {
     Game::attach_shell(sh);
 
+    std::stringstream ss;
+    ss << "simulation seed " << sim_seed_;
+    shell_->log(Shell::LOG_INFO, ss.str().c_str());
+
     const Shell::Context &ctx = sh.context();
     physical_dev_ = ctx.physical_dev;
     dev_ = ctx.dev;
@@ -112,7 +240,30 @@ void Hologram::attach_shell(Shell &sh) {
     mem_flags_.reserve(mem_props.memoryTypeCount);
     for (uint32_t i = 0; i < mem_props.memoryTypeCount; i++) mem_flags_.push_back(mem_props.memoryTypes[i].propertyFlags);
 
-    meshes_ = new Meshes(dev_, mem_flags_);
+    profiler_ = sh.profiler();
+    if (profiler_) {
+        uint32_t family_count;
+        vk::GetPhysicalDeviceQueueFamilyProperties(physical_dev_, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vk::GetPhysicalDeviceQueueFamilyProperties(physical_dev_, &family_count, families.data());
+
+        const uint32_t valid_bits = families[queue_family_].timestampValidBits;
+        if (valid_bits)
+            timestamp_mask_ = (valid_bits >= 64) ? ~0ull : (1ull << valid_bits) - 1;
+        else
+            shell_->log(Shell::LOG_WARN, "no GPU timestamps on the game queue");
+    }
+
+    allocator_.reset(new MemoryAllocator(dev_, mem_props, physical_dev_props_.limits.bufferImageGranularity));
+    meshes_ = new Meshes(dev_, *allocator_);
+
+    if (!pipeline_cache_dir_.empty()) {
+        pipeline_cache_.reset(new PipelineCache(dev_, physical_dev_props_, pipeline_cache_dir_, "hologram_pipeline_cache"));
+        if (pipeline_cache_->loaded())
+            shell_->log(Shell::LOG_INFO, ("pipeline cache loaded from " + pipeline_cache_->path()).c_str());
+        else
+            shell_->log(Shell::LOG_INFO, pipeline_cache_->load_error().c_str());
+    }
 
     create_render_pass();
     create_shader_modules();
@@ -120,7 +271,7 @@ void Hologram::attach_shell(Shell &sh) {
     create_pipeline_layout();
     create_pipeline();
 
-    create_frame_data(2);
+    create_frame_data(frames_in_flight_);
 
     render_pass_begin_info_.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
     render_pass_begin_info_.renderPass = render_pass_;
@@ -145,6 +296,8 @@ void Hologram::attach_shell(Shell &sh) {
 }
 
 void Hologram::detach_shell() {
+    if (scheduler_) scheduler_->wait();
+
     if (multithread_) {
         for (auto &worker : workers_) worker->stop();
     }
@@ -153,12 +306,28 @@ void Hologram::detach_shell() {
 
     vk::DestroyPipeline(dev_, pipeline_, nullptr);
     vk::DestroyPipelineLayout(dev_, pipeline_layout_, nullptr);
-    if (!use_push_constants_) vk::DestroyDescriptorSetLayout(dev_, desc_set_layout_, nullptr);
+
+    if (pipeline_cache_) {
+        if (!pipeline_cache_->save()) shell_->log(Shell::LOG_WARN, ("cannot save " + pipeline_cache_->path()).c_str());
+        pipeline_cache_.reset();
+    }
+
+    if (!use_push_constants_ && !use_instancing_) vk::DestroyDescriptorSetLayout(dev_, desc_set_layout_, nullptr);
     vk::DestroyShaderModule(dev_, fs_, nullptr);
     vk::DestroyShaderModule(dev_, vs_, nullptr);
     vk::DestroyRenderPass(dev_, render_pass_, nullptr);
 
     delete meshes_;
+    allocator_.reset();
+
+    if (replay_file_.is_open()) {
+        std::stringstream ss;
+        if (replay_mismatch_tick_ >= 0)
+            ss << "replay diverged at tick " << replay_mismatch_tick_;
+        else
+            ss << "replay matched through tick " << sim_ticks_;
+        shell_->log(replay_mismatch_tick_ >= 0 ? Shell::LOG_ERR : Shell::LOG_INFO, ss.str().c_str());
+    }
 
     Game::detach_shell();
 }
@@ -170,7 +339,7 @@ void Hologram::create_render_pass() {
     attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
     attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
     attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    attachment.finalLayout = shell_->context().present_layout;
 
     VkAttachmentReference attachment_ref = {};
     attachment_ref.attachment = 0;
@@ -206,7 +375,11 @@ void Hologram::create_render_pass() {
 void Hologram::create_shader_modules() {
     VkShaderModuleCreateInfo sh_info = {};
     sh_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    if (use_push_constants_) {
+    if (use_instancing_) {
+#include "Hologram.instanced.vert.h"
+        sh_info.codeSize = sizeof(Hologram_instanced_vert);
+        sh_info.pCode = Hologram_instanced_vert;
+    } else if (use_push_constants_) {
 #include "Hologram.push_constant.vert.h"
         sh_info.codeSize = sizeof(Hologram_push_constant_vert);
         sh_info.pCode = Hologram_push_constant_vert;
@@ -224,7 +397,7 @@ void Hologram::create_shader_modules() {
 }
 
 void Hologram::create_descriptor_set_layout() {
-    if (use_push_constants_) return;
+    if (use_push_constants_ || use_instancing_) return;
 
     VkDescriptorSetLayoutBinding layout_binding = {};
     layout_binding.binding = 0;
@@ -246,10 +419,11 @@ void Hologram::create_pipeline_layout() {
     VkPipelineLayoutCreateInfo pipeline_layout_info = {};
     pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 
-    if (use_push_constants_) {
+    if (use_push_constants_ || use_instancing_) {
         push_const_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         push_const_range.offset = 0;
-        push_const_range.size = sizeof(ShaderParamBlock);
+        // only view_projection when instancing
+        push_const_range.size = use_instancing_ ? sizeof(camera_.view_projection) : sizeof(ShaderParamBlock);
 
         pipeline_layout_info.pushConstantRangeCount = 1;
         pipeline_layout_info.pPushConstantRanges = &push_const_range;
@@ -313,6 +487,49 @@ void Hologram::create_pipeline() {
     blend_info.attachmentCount = 1;
     blend_info.pAttachments = &blend_attachment;
 
+    // append the per-instance attributes to the mesh vertex input
+    VkPipelineVertexInputStateCreateInfo vertex_input_info = meshes_->vertex_input_state();
+    std::vector<VkVertexInputBindingDescription> vi_bindings(
+        vertex_input_info.pVertexBindingDescriptions,
+        vertex_input_info.pVertexBindingDescriptions + vertex_input_info.vertexBindingDescriptionCount);
+    std::vector<VkVertexInputAttributeDescription> vi_attrs(
+        vertex_input_info.pVertexAttributeDescriptions,
+        vertex_input_info.pVertexAttributeDescriptions + vertex_input_info.vertexAttributeDescriptionCount);
+    if (use_instancing_) {
+        const uint32_t binding = static_cast<uint32_t>(vi_bindings.size());
+
+        VkVertexInputBindingDescription vi_binding = {};
+        vi_binding.binding = binding;
+        vi_binding.stride = sizeof(InstanceData);
+        vi_binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        vi_bindings.push_back(vi_binding);
+
+        VkVertexInputAttributeDescription vi_attr = {};
+        vi_attr.binding = binding;
+        // model, one column per location
+        for (uint32_t i = 0; i < 4; i++) {
+            vi_attr.location = 2 + i;
+            vi_attr.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            vi_attr.offset = static_cast<uint32_t>(offsetof(InstanceData, model) + sizeof(float) * 4 * i);
+            vi_attrs.push_back(vi_attr);
+        }
+        vi_attr.location = 6;
+        vi_attr.format = VK_FORMAT_R32G32B32_SFLOAT;
+        vi_attr.offset = offsetof(InstanceData, light_pos);
+        vi_attrs.push_back(vi_attr);
+        vi_attr.location = 7;
+        vi_attr.offset = offsetof(InstanceData, light_color);
+        vi_attrs.push_back(vi_attr);
+        vi_attr.location = 8;
+        vi_attr.format = VK_FORMAT_R32_SFLOAT;
+        vi_attr.offset = offsetof(InstanceData, alpha);
+        vi_attrs.push_back(vi_attr);
+    }
+    vertex_input_info.vertexBindingDescriptionCount = static_cast<uint32_t>(vi_bindings.size());
+    vertex_input_info.pVertexBindingDescriptions = vi_bindings.data();
+    vertex_input_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(vi_attrs.size());
+    vertex_input_info.pVertexAttributeDescriptions = vi_attrs.data();
+
     std::array<VkDynamicState, 2> dynamic_states = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
     struct VkPipelineDynamicStateCreateInfo dynamic_info = {};
     dynamic_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
@@ -323,7 +540,7 @@ void Hologram::create_pipeline() {
     pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
     pipeline_info.stageCount = 2;
     pipeline_info.pStages = stage_info;
-    pipeline_info.pVertexInputState = &meshes_->vertex_input_state();
+    pipeline_info.pVertexInputState = &vertex_input_info;
     pipeline_info.pInputAssemblyState = &meshes_->input_assembly_state();
     pipeline_info.pTessellationState = nullptr;
     pipeline_info.pViewportState = &viewport_info;
@@ -335,7 +552,15 @@ void Hologram::create_pipeline() {
     pipeline_info.layout = pipeline_layout_;
     pipeline_info.renderPass = render_pass_;
     pipeline_info.subpass = 0;
-    vk::assert_success(vk::CreateGraphicsPipelines(dev_, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline_));
+
+    const VkPipelineCache cache = pipeline_cache_ ? pipeline_cache_->handle() : VK_NULL_HANDLE;
+    const auto start = std::chrono::steady_clock::now();
+    vk::assert_success(vk::CreateGraphicsPipelines(dev_, cache, 1, &pipeline_info, nullptr, &pipeline_));
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::stringstream ss;
+    ss << "pipeline created in " << elapsed.count() << " ms";
+    shell_->log(Shell::LOG_INFO, ss.str().c_str());
 }
 
 void Hologram::create_frame_data(int count) {
@@ -345,33 +570,45 @@ void Hologram::create_frame_data(int count) {
     create_command_buffers();
 
     if (!use_push_constants_) {
-        create_buffers();
-        create_buffer_memory();
-        create_descriptor_sets();
+        create_upload_ring(count);
+        if (!use_instancing_) create_descriptor_sets();
     }
 
+    if (timestamp_mask_) create_query_pools();
+
     frame_data_index_ = 0;
 }
 
 void Hologram::destroy_frame_data() {
     if (!use_push_constants_) {
-        vk::DestroyDescriptorPool(dev_, desc_pool_, nullptr);
-
-        vk::UnmapMemory(dev_, frame_data_mem_);
-        vk::FreeMemory(dev_, frame_data_mem_, nullptr);
-
-        for (auto &data : frame_data_) vk::DestroyBuffer(dev_, data.buf, nullptr);
+        if (!use_instancing_) vk::DestroyDescriptorPool(dev_, desc_pool_, nullptr);
+        ring_.reset();
     }
 
     for (auto cmd_pool : worker_cmd_pools_) vk::DestroyCommandPool(dev_, cmd_pool, nullptr);
     worker_cmd_pools_.clear();
     vk::DestroyCommandPool(dev_, primary_cmd_pool_, nullptr);
 
-    for (auto &data : frame_data_) vk::DestroyFence(dev_, data.fence, nullptr);
+    for (auto &data : frame_data_) {
+        if (data.query_pool != VK_NULL_HANDLE) vk::DestroyQueryPool(dev_, data.query_pool, nullptr);
+        vk::DestroyFence(dev_, data.fence, nullptr);
+    }
 
     frame_data_.clear();
 }
 
+void Hologram::create_query_pools() {
+    VkQueryPoolCreateInfo query_pool_info = {};
+    query_pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_pool_info.queryCount = 2;
+
+    for (auto &data : frame_data_) {
+        vk::assert_success(vk::CreateQueryPool(dev_, &query_pool_info, nullptr, &data.query_pool));
+        data.queries_pending = false;
+    }
+}
+
 void Hologram::create_fences() {
     VkFenceCreateInfo fence_info = {};
     fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -391,8 +628,8 @@ void Hologram::create_command_buffers() {
     cmd_info.commandBufferCount = static_cast<uint32_t>(frame_data_.size());
 
     // create command pools and buffers
-    std::vector<VkCommandPool> cmd_pools(workers_.size() + 1, VK_NULL_HANDLE);
-    std::vector<std::vector<VkCommandBuffer>> cmds_vec(workers_.size() + 1,
+    std::vector<VkCommandPool> cmd_pools(worker_count_ + 1, VK_NULL_HANDLE);
+    std::vector<std::vector<VkCommandBuffer>> cmds_vec(worker_count_ + 1,
                                                        std::vector<VkCommandBuffer>(frame_data_.size(), VK_NULL_HANDLE));
     for (size_t i = 0; i < cmd_pools.size(); i++) {
         auto &cmd_pool = cmd_pools[i];
@@ -408,6 +645,8 @@ void Hologram::create_command_buffers() {
 
     // update frame_data_
     for (size_t i = 0; i < frame_data_.size(); i++) {
+        frame_data_[i].worker_cmds_begun.assign(worker_count_, 0);
+
         for (const auto &cmds : cmds_vec) {
             if (cmds == cmds_vec.back()) {
                 frame_data_[i].primary_cmd = cmds[i];
@@ -422,119 +661,111 @@ void Hologram::create_command_buffers() {
     worker_cmd_pools_ = cmd_pools;
 }
 
-void Hologram::create_buffers() {
-    // align object data to device limit
-    const VkDeviceSize &alignment = physical_dev_props_.limits.minUniformBufferOffsetAlignment;
+void Hologram::create_upload_ring(int frame_count) {
+    VkBufferUsageFlags usage;
+    VkDeviceSize frame_size;
+    VkDeviceSize alignment;
 
-    aligned_object_data_size = sizeof(ShaderParamBlock);
-    if (aligned_object_data_size % alignment) aligned_object_data_size += alignment - (aligned_object_data_size % alignment);
+    if (use_instancing_) {
+        prepare_instance_draws();
 
-    // update simulation
-    assert(aligned_object_data_size <= UINT32_MAX);
-    sim_.set_frame_data_size(static_cast<uint32_t>(aligned_object_data_size));
+        usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        frame_size = indirect_draw_offset_ + sizeof(VkDrawIndexedIndirectCommand) * indirect_draws_.size();
+        // for the indirect draw offset
+        alignment = 4;
+    } else {
+        // align object data to device limit
+        alignment = physical_dev_props_.limits.minUniformBufferOffsetAlignment;
 
-    VkBufferCreateInfo buf_info = {};
-    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    buf_info.size = aligned_object_data_size * sim_.objects().size();
-    buf_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        aligned_object_data_size = sizeof(ShaderParamBlock);
+        if (aligned_object_data_size % alignment) aligned_object_data_size += alignment - (aligned_object_data_size % alignment);
 
-    for (auto &data : frame_data_) vk::assert_success(vk::CreateBuffer(dev_, &buf_info, nullptr, &data.buf));
-}
+        usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        frame_size = aligned_object_data_size * sim_.objects().size();
+    }
 
-void Hologram::create_buffer_memory() {
-    VkMemoryRequirements mem_reqs;
-    vk::GetBufferMemoryRequirements(dev_, frame_data_[0].buf, &mem_reqs);
+    ring_.reset(new UploadRing(dev_, mem_flags_, usage, frame_size, alignment, frame_count));
 
-    VkDeviceSize aligned_size = mem_reqs.size;
-    if (aligned_size % mem_reqs.alignment) aligned_size += mem_reqs.alignment - (aligned_size % mem_reqs.alignment);
+    // dynamic offsets are 32-bit
+    assert(use_instancing_ || ring_->frame_size() * frame_count <= UINT32_MAX);
 
-    // allocate memory
-    VkMemoryAllocateInfo mem_info = {};
-    mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_info.allocationSize = aligned_size * (frame_data_.size() - 1) + mem_reqs.size;
+    if (!ring_->device_local()) shell_->log(Shell::LOG_DEBUG, "upload ring is not in device-local memory");
+}
 
-    for (uint32_t idx = 0; idx < mem_flags_.size(); idx++) {
-        if ((mem_reqs.memoryTypeBits & (1 << idx)) && (mem_flags_[idx] & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
-            (mem_flags_[idx] & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
-            // TODO is this guaranteed to exist?
-            mem_info.memoryTypeIndex = idx;
-            break;
-        }
+void Hologram::prepare_instance_draws() {
+    // group the instances by mesh so that each mesh is drawn with one
+    // indirect draw covering a contiguous range of instances
+    sim_.set_frame_data_size(sizeof(InstanceData), true);
+
+    std::array<uint32_t, Meshes::MESH_COUNT> instance_counts = {};
+    for (const auto &obj : sim_.objects()) instance_counts[obj.mesh]++;
+
+    // a non-zero firstInstance needs drawIndirectFirstInstance, which is
+    // optional, so each draw starts at instance 0 and the instance buffer is
+    // bound at the first instance of the mesh instead
+    indirect_draws_.clear();
+    indirect_instance_offsets_.clear();
+    uint32_t first_instance = 0;
+    for (int i = 0; i < Meshes::MESH_COUNT; i++) {
+        if (!instance_counts[i]) continue;
+
+        VkDrawIndexedIndirectCommand draw = meshes_->draw_command(static_cast<Meshes::Type>(i));
+        draw.instanceCount = instance_counts[i];
+        draw.firstInstance = 0;
+        indirect_draws_.push_back(draw);
+        indirect_instance_offsets_.push_back(sizeof(InstanceData) * first_instance);
+
+        first_instance += instance_counts[i];
     }
 
-    vk::AllocateMemory(dev_, &mem_info, nullptr, &frame_data_mem_);
-
-    void *ptr;
-    vk::MapMemory(dev_, frame_data_mem_, 0, VK_WHOLE_SIZE, 0, &ptr);
-
-    VkDeviceSize offset = 0;
-    for (auto &data : frame_data_) {
-        vk::BindBufferMemory(dev_, data.buf, frame_data_mem_, offset);
-        data.base = reinterpret_cast<uint8_t *>(ptr) + offset;
-        offset += aligned_size;
-    }
+    // instances followed by indirect draws
+    indirect_draw_offset_ = sizeof(InstanceData) * sim_.objects().size();
 }
 
 void Hologram::create_descriptor_sets() {
     VkDescriptorPoolSize desc_pool_size = {};
     desc_pool_size.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-    assert(frame_data_.size() <= UINT32_MAX);
-    desc_pool_size.descriptorCount = static_cast<uint32_t>(frame_data_.size());
+    desc_pool_size.descriptorCount = 1;
 
     VkDescriptorPoolCreateInfo desc_pool_info = {};
     desc_pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    desc_pool_info.maxSets = static_cast<uint32_t>(frame_data_.size());
+    desc_pool_info.maxSets = 1;
     desc_pool_info.poolSizeCount = 1;
     desc_pool_info.pPoolSizes = &desc_pool_size;
 
     // create descriptor pool
     vk::assert_success(vk::CreateDescriptorPool(dev_, &desc_pool_info, nullptr, &desc_pool_));
 
-    std::vector<VkDescriptorSetLayout> set_layouts(frame_data_.size(), desc_set_layout_);
+    // all frames share the ring and differ only in the dynamic offsets
     VkDescriptorSetAllocateInfo set_info = {};
     set_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     set_info.descriptorPool = desc_pool_;
-    set_info.descriptorSetCount = static_cast<uint32_t>(set_layouts.size());
-    set_info.pSetLayouts = set_layouts.data();
-
-    // create descriptor sets
-    std::vector<VkDescriptorSet> desc_sets(frame_data_.size(), VK_NULL_HANDLE);
-    vk::assert_success(vk::AllocateDescriptorSets(dev_, &set_info, desc_sets.data()));
-
-    std::vector<VkDescriptorBufferInfo> desc_bufs(frame_data_.size());
-    std::vector<VkWriteDescriptorSet> desc_writes(frame_data_.size());
-
-    for (size_t i = 0; i < frame_data_.size(); i++) {
-        auto &data = frame_data_[i];
-
-        data.desc_set = desc_sets[i];
-
-        VkDescriptorBufferInfo desc_buf = {};
-        desc_buf.buffer = data.buf;
-        desc_buf.offset = 0;
-        desc_buf.range = VK_WHOLE_SIZE;
-        desc_bufs[i] = desc_buf;
-
-        VkWriteDescriptorSet desc_write = {};
-        desc_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        desc_write.dstSet = data.desc_set;
-        desc_write.dstBinding = 0;
-        desc_write.dstArrayElement = 0;
-        desc_write.descriptorCount = 1;
-        desc_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-        desc_write.pBufferInfo = &desc_bufs[i];
-        desc_writes[i] = desc_write;
-    }
-
-    vk::UpdateDescriptorSets(dev_, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, nullptr);
+    set_info.descriptorSetCount = 1;
+    set_info.pSetLayouts = &desc_set_layout_;
+    vk::assert_success(vk::AllocateDescriptorSets(dev_, &set_info, &desc_set_));
+
+    VkDescriptorBufferInfo desc_buf = {};
+    desc_buf.buffer = ring_->buffer();
+    desc_buf.offset = 0;
+    desc_buf.range = sizeof(ShaderParamBlock);
+
+    VkWriteDescriptorSet desc_write = {};
+    desc_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    desc_write.dstSet = desc_set_;
+    desc_write.dstBinding = 0;
+    desc_write.dstArrayElement = 0;
+    desc_write.descriptorCount = 1;
+    desc_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    desc_write.pBufferInfo = &desc_buf;
+
+    vk::UpdateDescriptorSets(dev_, 1, &desc_write, 0, nullptr);
 }
 
 void Hologram::attach_swapchain() {
     const Shell::Context &ctx = shell_->context();
 
     prepare_viewport(ctx.extent);
-    prepare_framebuffers(ctx.swapchain);
+    prepare_framebuffers(ctx.images);
 
     update_camera();
 }
@@ -562,9 +793,8 @@ void Hologram::prepare_viewport(const VkExtent2D &extent) {
     scissor_.extent = extent_;
 }
 
-void Hologram::prepare_framebuffers(VkSwapchainKHR swapchain) {
-    // get swapchain images
-    vk::get(dev_, swapchain, images_);
+void Hologram::prepare_framebuffers(const std::vector<VkImage> &images) {
+    images_ = images;
 
     assert(framebuffers_.empty());
     image_views_.reserve(images_.size());
@@ -612,43 +842,52 @@ void Hologram::update_camera() {
     camera_.view_projection = clip * projection * view;
 }
 
-void Hologram::draw_object(const Simulation::Object &obj, FrameData &data, VkCommandBuffer cmd) const {
+void Hologram::draw_object(const Simulation::Object &obj, const Simulation::Transform &xform, const UploadRing::Allocation &dst,
+                           VkCommandBuffer cmd) const {
+    if (use_instancing_) {
+        // drawn by draw_instances
+        InstanceData *inst = reinterpret_cast<InstanceData *>(dst.ptr);
+        memcpy(inst->model, glm::value_ptr(xform.model), sizeof(xform.model));
+        memcpy(inst->light_pos, glm::value_ptr(obj.light_pos), sizeof(obj.light_pos));
+        memcpy(inst->light_color, glm::value_ptr(obj.light_color), sizeof(obj.light_color));
+        inst->alpha = sim_fade_ ? xform.alpha : 0.5f;
+        return;
+    }
+
     if (use_push_constants_) {
         ShaderParamBlock params;
         memcpy(params.light_pos, glm::value_ptr(obj.light_pos), sizeof(obj.light_pos));
         memcpy(params.light_color, glm::value_ptr(obj.light_color), sizeof(obj.light_color));
-        memcpy(params.model, glm::value_ptr(obj.model), sizeof(obj.model));
+        memcpy(params.model, glm::value_ptr(xform.model), sizeof(xform.model));
         memcpy(params.view_projection, glm::value_ptr(camera_.view_projection), sizeof(camera_.view_projection));
-        params.alpha = sim_fade_ ? obj.alpha : 0.5f;
+        params.alpha = sim_fade_ ? xform.alpha : 0.5f;
 
         vk::CmdPushConstants(cmd, pipeline_layout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(params), &params);
     } else {
-        ShaderParamBlock *params = reinterpret_cast<ShaderParamBlock *>(data.base + obj.frame_data_offset);
+        ShaderParamBlock *params = reinterpret_cast<ShaderParamBlock *>(dst.ptr);
         memcpy(params->light_pos, glm::value_ptr(obj.light_pos), sizeof(obj.light_pos));
         memcpy(params->light_color, glm::value_ptr(obj.light_color), sizeof(obj.light_color));
-        memcpy(params->model, glm::value_ptr(obj.model), sizeof(obj.model));
+        memcpy(params->model, glm::value_ptr(xform.model), sizeof(xform.model));
         memcpy(params->view_projection, glm::value_ptr(camera_.view_projection), sizeof(camera_.view_projection));
-        params->alpha = sim_fade_ ? obj.alpha : 0.5f;
+        params->alpha = sim_fade_ ? xform.alpha : 0.5f;
 
-        vk::CmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout_, 0, 1, &data.desc_set, 1,
-                                  &obj.frame_data_offset);
+        const uint32_t dynamic_offset = static_cast<uint32_t>(dst.offset);
+        vk::CmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout_, 0, 1, &desc_set_, 1, &dynamic_offset);
     }
 
     meshes_->cmd_draw(cmd, obj.mesh);
 }
 
 void Hologram::update_simulation(const Worker &worker) {
+    Profiler::Scope scope(profiler_, Profiler::SPAN_TICK, worker.index_ + 1);
     sim_.update(worker.tick_interval_, worker.object_begin_, worker.object_end_);
 }
 
-void Hologram::draw_objects(Worker &worker) {
-    auto &data = frame_data_[frame_data_index_];
-    auto cmd = data.worker_cmds[worker.index_];
-
+void Hologram::begin_worker_cmd(VkCommandBuffer cmd, VkFramebuffer fb) const {
     VkCommandBufferInheritanceInfo inherit_info = {};
     inherit_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
     inherit_info.renderPass = render_pass_;
-    inherit_info.framebuffer = worker.fb_;
+    inherit_info.framebuffer = fb;
 
     VkCommandBufferBeginInfo begin_info = {};
     begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -663,14 +902,158 @@ void Hologram::draw_objects(Worker &worker) {
     vk::CmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
 
     meshes_->cmd_bind_buffers(cmd);
+}
 
-    for (int i = worker.object_begin_; i < worker.object_end_; i++) {
+void Hologram::draw_instances(const FrameData &data, VkCommandBuffer cmd) const {
+    vk::CmdSetViewport(cmd, 0, 1, &viewport_);
+    vk::CmdSetScissor(cmd, 0, 1, &scissor_);
+
+    vk::CmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
+
+    meshes_->cmd_bind_buffers(cmd);
+    const VkBuffer buf = ring_->buffer();
+
+    vk::CmdPushConstants(cmd, pipeline_layout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(camera_.view_projection),
+                         glm::value_ptr(camera_.view_projection));
+
+    // one draw per mesh; multiDrawIndirect is optional
+    for (size_t i = 0; i < indirect_draws_.size(); i++) {
+        const VkDeviceSize instance_offset = data.instances.offset + indirect_instance_offsets_[i];
+        vk::CmdBindVertexBuffers(cmd, 1, 1, &buf, &instance_offset);
+
+        const VkDeviceSize offset = data.instances.offset + indirect_draw_offset_ + sizeof(VkDrawIndexedIndirectCommand) * i;
+        vk::CmdDrawIndexedIndirect(cmd, buf, offset, 1, sizeof(VkDrawIndexedIndirectCommand));
+    }
+}
+
+void Hologram::draw_objects(Worker &worker) {
+    // the main thread is slot 0
+    Profiler::Scope scope(profiler_, Profiler::SPAN_RECORD, worker.index_ + 1);
+
+    auto &data = frame_data_[frame_data_index_];
+    auto cmd = data.worker_cmds[worker.index_];
+
+    if (!use_instancing_) begin_worker_cmd(cmd, worker.fb_);
+
+    draw_object_range(worker.object_begin_, worker.object_end_, data, cmd);
+
+    if (!use_instancing_) vk::EndCommandBuffer(cmd);
+}
+
+void Hologram::draw_objects(int thread, int begin, int end) {
+    // scheduler thread 0 is the main thread, which is profiler slot 0
+    Profiler::Scope scope(profiler_, Profiler::SPAN_RECORD, thread);
+
+    auto &data = frame_data_[frame_data_index_];
+    auto cmd = data.worker_cmds[thread];
+
+    // each thread records into its own command buffer, begun on its first chunk
+    if (!use_instancing_ && !data.worker_cmds_begun[thread]) {
+        begin_worker_cmd(cmd, draw_fb_);
+        data.worker_cmds_begun[thread] = true;
+    }
+
+    draw_object_range(begin, end, data, cmd);
+}
+
+void Hologram::draw_object_range(int begin, int end, const FrameData &data, VkCommandBuffer cmd) {
+    // instances have fixed slots for the indirect draws, while uniforms are
+    // bump allocated for the whole range
+    UploadRing::Allocation dst = {nullptr, 0};
+    VkDeviceSize stride = 0;
+    if (!use_push_constants_ && !use_instancing_) {
+        stride = aligned_object_data_size;
+        dst = ring_->allocate(stride * (end - begin));
+        assert(dst.ptr);
+    }
+
+    for (int i = begin; i < end; i++) {
         auto &obj = sim_.objects()[i];
+        auto &xform = sim_.transforms()[i];
+
+        if (use_instancing_) dst.ptr = data.instances.ptr + obj.frame_data_offset;
+
+        draw_object(obj, xform, dst, cmd);
 
-        draw_object(obj, data, cmd);
+        dst.ptr += stride;
+        dst.offset += stride;
     }
+}
+
+void Hologram::run_frame_chunk(int thread, int begin, int end) {
+    const int object_count = static_cast<int>(sim_.objects().size());
+
+    // chunks [0, object_count) draw and the rest run the queued ticks
+    if (begin < object_count) draw_objects(thread, begin, std::min(end, object_count));
+
+    if (end > object_count) {
+        const float tick_interval = 1.0f / settings_.ticks_per_second;
+        const int tick_begin = std::max(begin, object_count) - object_count;
+        const int tick_end = end - object_count;
+
+        Profiler::Scope scope(profiler_, Profiler::SPAN_TICK, thread);
+        for (int i = 0; i < frame_ticks_; i++) sim_.update(tick_interval, tick_begin, tick_end);
+    }
+}
+
+void Hologram::read_timestamps(FrameData &data) {
+    data.queries_pending = false;
+
+    // the fence is signaled, so this does not stall
+    uint64_t timestamps[2];
+    VkResult res = vk::GetQueryPoolResults(dev_, data.query_pool, 0, 2, sizeof(timestamps), timestamps, sizeof(timestamps[0]),
+                                           VK_QUERY_RESULT_64_BIT);
+    if (res != VK_SUCCESS) return;
+
+    const uint64_t ticks = (timestamps[1] - timestamps[0]) & timestamp_mask_;
+    profiler_->add_gpu(data.submit_time, static_cast<double>(ticks) * physical_dev_props_.limits.timestampPeriod * 1e-9);
+}
+
+void Hologram::report_frame_time(double frame_time) {
+    frame_times_.push_back(static_cast<float>(frame_time * 1000.0));
+    if (frame_times_.size() < frame_time_report_interval) return;
+
+    std::sort(frame_times_.begin(), frame_times_.end());
+
+    std::stringstream ss;
+    ss << (scheduler_ ? "work-stealing" : "fixed workers") << " (" << worker_count_ << " threads) frame CPU time: "
+       << "p50 " << percentile(frame_times_, 0.5f) << " ms, "
+       << "p90 " << percentile(frame_times_, 0.9f) << " ms, "
+       << "p99 " << percentile(frame_times_, 0.99f) << " ms, "
+       << "max " << frame_times_.back() << " ms";
+    shell_->log(Shell::LOG_INFO, ss.str().c_str());
 
-    vk::EndCommandBuffer(cmd);
+    frame_times_.clear();
+}
+
+void Hologram::check_replay() {
+    // sim_ticks_ counts queued ticks, which are not visible yet
+    const int64_t tick = sim_ticks_ - queued_ticks_;
+    if (tick == last_hashed_tick_) return;
+    last_hashed_tick_ = tick;
+
+    const uint64_t hash = sim_.transforms_hash();
+
+    if (record_file_.is_open()) {
+        record_file_ << tick << " " << std::hex << hash << std::dec << "\n";
+        return;
+    }
+
+    if (replay_mismatch_tick_ >= 0) return;
+
+    // with a fixed timestep, the hashed ticks match the recording as well
+    int64_t recorded_tick;
+    uint64_t recorded_hash;
+    if (!(replay_file_ >> recorded_tick >> std::hex >> recorded_hash >> std::dec)) return;
+
+    if (recorded_tick != tick || recorded_hash != hash) {
+        replay_mismatch_tick_ = tick;
+
+        std::stringstream ss;
+        ss << "replay mismatch at tick " << tick << ": recorded tick " << recorded_tick << " hash 0x" << std::hex
+           << recorded_hash << ", got 0x" << hash;
+        shell_->log(Shell::LOG_ERR, ss.str().c_str());
+    }
 }
 
 void Hologram::on_key(Key key) {
@@ -701,46 +1084,139 @@ void Hologram::on_key(Key key) {
 void Hologram::on_tick() {
     if (sim_paused_) return;
 
-    for (auto &worker : workers_) worker->update_simulation();
+    sim_ticks_++;
+
+    // run by on_frame alongside the draw
+    if (settings_.pipelined) {
+        queued_ticks_++;
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    if (scheduler_) {
+        const float tick_interval = 1.0f / settings_.ticks_per_second;
+
+        // runs until on_frame waits for it
+        scheduler_->dispatch(static_cast<int>(sim_.objects().size()), object_chunk_size,
+                             [this, tick_interval](int begin, int end, int thread) {
+                                 Profiler::Scope scope(profiler_, Profiler::SPAN_TICK, thread);
+                                 sim_.update(tick_interval, begin, end);
+                             });
+    } else {
+        for (auto &worker : workers_) worker->update_simulation();
+    }
+
+    tick_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 }
 
 void Hologram::on_frame(float frame_pred) {
+    const auto start = std::chrono::steady_clock::now();
+
     auto &data = frame_data_[frame_data_index_];
 
     // wait for the last submission since we reuse frame data
     vk::assert_success(vk::WaitForFences(dev_, 1, &data.fence, true, UINT64_MAX));
     vk::assert_success(vk::ResetFences(dev_, 1, &data.fence));
 
+    if (data.queries_pending) read_timestamps(data);
+
+    // the fence also retires the region of the ring used by this frame data
+    if (ring_) {
+        ring_->begin_frame(frame_data_index_);
+
+        if (use_instancing_) {
+            data.instances = ring_->allocate(ring_->frame_size());
+            memcpy(data.instances.ptr + indirect_draw_offset_, indirect_draws_.data(),
+                   sizeof(VkDrawIndexedIndirectCommand) * indirect_draws_.size());
+        }
+    }
+
     const Shell::BackBuffer &back = shell_->context().acquired_back_buffer;
 
     // ignore frame_pred
-    for (auto &worker : workers_) worker->draw_objects(framebuffers_[back.image_index]);
+    if (scheduler_) {
+        // finish the simulation before drawing
+        scheduler_->wait();
+
+        draw_fb_ = framebuffers_[back.image_index];
+        std::fill(data.worker_cmds_begun.begin(), data.worker_cmds_begun.end(), 0);
+
+        // when pipelined, the queued ticks write the back snapshot while the
+        // draw reads the front one
+        frame_ticks_ = queued_ticks_;
+        queued_ticks_ = 0;
+
+        const int object_count = static_cast<int>(sim_.objects().size());
+        scheduler_->dispatch(frame_ticks_ ? object_count * 2 : object_count, object_chunk_size,
+                             [this](int begin, int end, int thread) { run_frame_chunk(thread, begin, end); });
+    } else {
+        for (auto &worker : workers_) worker->draw_objects(framebuffers_[back.image_index]);
+    }
 
     VkResult res = vk::BeginCommandBuffer(data.primary_cmd, &primary_cmd_begin_info_);
 
+    if (timestamp_mask_) {
+        vk::CmdResetQueryPool(data.primary_cmd, data.query_pool, 0, 2);
+        vk::CmdWriteTimestamp(data.primary_cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, data.query_pool, 0);
+    }
+
     if (!use_push_constants_) {
+        const VkAccessFlags dst_access = use_instancing_
+                                             ? VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT
+                                             : VK_ACCESS_SHADER_READ_BIT;
+        const VkPipelineStageFlags dst_stages = use_instancing_
+                                                    ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
+                                                    : VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+
         VkBufferMemoryBarrier buf_barrier = {};
         buf_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
         buf_barrier.srcAccessMask = VK_ACCESS_HOST_WRITE_BIT;
-        buf_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        buf_barrier.dstAccessMask = dst_access;
         buf_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         buf_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        buf_barrier.buffer = data.buf;
-        buf_barrier.offset = 0;
-        buf_barrier.size = VK_WHOLE_SIZE;
-        vk::CmdPipelineBarrier(data.primary_cmd, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 0, nullptr, 1,
-                               &buf_barrier, 0, nullptr);
+        buf_barrier.buffer = ring_->buffer();
+        buf_barrier.offset = ring_->frame_offset();
+        buf_barrier.size = ring_->frame_size();
+        vk::CmdPipelineBarrier(data.primary_cmd, VK_PIPELINE_STAGE_HOST_BIT, dst_stages, 0, 0, nullptr, 1, &buf_barrier, 0,
+                               nullptr);
     }
 
     render_pass_begin_info_.framebuffer = framebuffers_[back.image_index];
     render_pass_begin_info_.renderArea.extent = extent_;
-    vk::CmdBeginRenderPass(data.primary_cmd, &render_pass_begin_info_, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    vk::CmdBeginRenderPass(data.primary_cmd, &render_pass_begin_info_,
+                           use_instancing_ ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+    // wait for the workers
+    if (scheduler_) {
+        scheduler_->wait();
+        if (frame_ticks_) sim_.swap_snapshots();
+    } else {
+        for (auto &worker : workers_) worker->wait_idle();
+    }
+
+    if (record_file_.is_open() || replay_file_.is_open()) check_replay();
 
     // record render pass commands
-    for (auto &worker : workers_) worker->wait_idle();
-    vk::CmdExecuteCommands(data.primary_cmd, static_cast<uint32_t>(data.worker_cmds.size()), data.worker_cmds.data());
+    if (use_instancing_) {
+        draw_instances(data, data.primary_cmd);
+    } else if (scheduler_) {
+        std::vector<VkCommandBuffer> &cmds = data.executed_cmds;
+        cmds.clear();
+        for (size_t i = 0; i < data.worker_cmds.size(); i++) {
+            if (!data.worker_cmds_begun[i]) continue;
+
+            vk::EndCommandBuffer(data.worker_cmds[i]);
+            cmds.push_back(data.worker_cmds[i]);
+        }
+
+        if (!cmds.empty()) vk::CmdExecuteCommands(data.primary_cmd, static_cast<uint32_t>(cmds.size()), cmds.data());
+    } else {
+        vk::CmdExecuteCommands(data.primary_cmd, static_cast<uint32_t>(data.worker_cmds.size()), data.worker_cmds.data());
+    }
 
     vk::CmdEndRenderPass(data.primary_cmd);
+    if (timestamp_mask_) vk::CmdWriteTimestamp(data.primary_cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, data.query_pool, 1);
     vk::EndCommandBuffer(data.primary_cmd);
 
     // wait for the image to be owned and signal for render completion
@@ -748,10 +1224,21 @@ void Hologram::on_frame(float frame_pred) {
     primary_cmd_submit_info_.pCommandBuffers = &data.primary_cmd;
     primary_cmd_submit_info_.pSignalSemaphores = &back.render_semaphore;
 
-    res = vk::QueueSubmit(queue_, 1, &primary_cmd_submit_info_, data.fence);
+    {
+        Profiler::Scope scope(profiler_, Profiler::SPAN_SUBMIT, 0);
+        res = vk::QueueSubmit(queue_, 1, &primary_cmd_submit_info_, data.fence);
+    }
+
+    if (timestamp_mask_) {
+        data.queries_pending = true;
+        data.submit_time = Profiler::Clock::now();
+    }
 
     frame_data_index_ = (frame_data_index_ + 1) % frame_data_.size();
 
+    report_frame_time(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() + tick_time_);
+    tick_time_ = 0.0;
+
     (void)res;
 }
 
@@ -18,6 +18,7 @@
 #define HOLOGRAM_H
 
 #include <condition_variable>
+#include <fstream>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,8 +30,13 @@
 
 #include "Simulation.h"
 #include "Game.h"
+#include "Profiler.h"
+#include "TaskScheduler.h"
+#include "UploadRing.h"
 
 class Meshes;
+class MemoryAllocator;
+class PipelineCache;
 
 class Hologram : public Game {
    public:
@@ -100,10 +106,18 @@ class Hologram : public Game {
 
         VkCommandBuffer primary_cmd;
         std::vector<VkCommandBuffer> worker_cmds;
-
-        VkBuffer buf;
-        uint8_t *base;
-        VkDescriptorSet desc_set;
+        // the worker_cmds that were recorded this frame
+        std::vector<uint8_t> worker_cmds_begun;
+        std::vector<VkCommandBuffer> executed_cmds;
+
+        // the instances and indirect draws of this frame when instancing
+        UploadRing::Allocation instances;
+
+        // render pass timestamps when profiling, read back once fence is
+        // signaled
+        VkQueryPool query_pool;
+        bool queries_pending;
+        Profiler::Clock::time_point submit_time;
     };
 
     // called by the constructor
@@ -111,16 +125,43 @@ class Hologram : public Game {
 
     bool multithread_;
     bool use_push_constants_;
+    bool use_instancing_;
+    bool fixed_workers_;
+    int frames_in_flight_;
 
     // called mostly by on_key
     void update_camera();
 
     bool sim_paused_;
     bool sim_fade_;
+    unsigned int sim_seed_;
     Simulation sim_;
     Camera camera_;
 
+    // either a fixed slice of objects per Worker, or a work-stealing scheduler
     std::vector<std::unique_ptr<Worker>> workers_;
+    std::unique_ptr<TaskScheduler> scheduler_;
+    int worker_count_;
+
+    // ticks queued by on_tick and run by on_frame when pipelined
+    int queued_ticks_;
+    int frame_ticks_;
+
+    // CPU time of on_tick and on_frame, reported periodically as percentiles
+    void report_frame_time(double frame_time);
+
+    double tick_time_;
+    std::vector<float> frame_times_;
+
+    // --record writes the transform hash after every tick, and --replay
+    // compares against such a recording
+    void check_replay();
+
+    int64_t sim_ticks_;
+    int64_t last_hashed_tick_;
+    int64_t replay_mismatch_tick_;
+    std::ofstream record_file_;
+    std::ifstream replay_file_;
 
     // called by attach_shell
     void create_render_pass();
@@ -133,9 +174,10 @@ class Hologram : public Game {
     void destroy_frame_data();
     void create_fences();
     void create_command_buffers();
-    void create_buffers();
-    void create_buffer_memory();
+    void create_upload_ring(int frame_count);
+    void prepare_instance_draws();
     void create_descriptor_sets();
+    void create_query_pools();
 
     VkPhysicalDevice physical_dev_;
     VkDevice dev_;
@@ -143,12 +185,27 @@ class Hologram : public Game {
     uint32_t queue_family_;
     VkFormat format_;
     VkDeviceSize aligned_object_data_size;
+    std::vector<VkDrawIndexedIndirectCommand> indirect_draws_;
+    // where the instances of each indirect draw start in the frame's instances
+    std::vector<VkDeviceSize> indirect_instance_offsets_;
+    VkDeviceSize indirect_draw_offset_;
 
     VkPhysicalDeviceProperties physical_dev_props_;
     std::vector<VkMemoryPropertyFlags> mem_flags_;
 
+    // the shell's profiler, and the valid bits of the timestamps of queue_
+    // (none when GPU timestamps are not used)
+    Profiler *profiler_;
+    uint64_t timestamp_mask_;
+
+    std::unique_ptr<MemoryAllocator> allocator_;
     const Meshes *meshes_;
 
+    // directory of the on-disk pipeline cache given with --pipeline-cache;
+    // none is kept when empty, as by default
+    std::string pipeline_cache_dir_;
+    std::unique_ptr<PipelineCache> pipeline_cache_;
+
     VkRenderPass render_pass_;
     VkShaderModule vs_;
     VkShaderModule fs_;
@@ -159,7 +216,11 @@ class Hologram : public Game {
     VkCommandPool primary_cmd_pool_;
     std::vector<VkCommandPool> worker_cmd_pools_;
     VkDescriptorPool desc_pool_;
-    VkDeviceMemory frame_data_mem_;
+    VkDescriptorSet desc_set_;
+
+    // per-object uniforms, or instances and indirect draws, of all frames in
+    // flight
+    std::unique_ptr<UploadRing> ring_;
     std::vector<FrameData> frame_data_;
     int frame_data_index_;
 
@@ -172,7 +233,7 @@ class Hologram : public Game {
 
     // called by attach_swapchain
     void prepare_viewport(const VkExtent2D &extent);
-    void prepare_framebuffers(VkSwapchainKHR swapchain);
+    void prepare_framebuffers(const std::vector<VkImage> &images);
 
     VkExtent2D extent_;
     VkViewport viewport_;
@@ -184,8 +245,21 @@ class Hologram : public Game {
 
     // called by workers
     void update_simulation(const Worker &worker);
-    void draw_object(const Simulation::Object &obj, FrameData &data, VkCommandBuffer cmd) const;
+    void begin_worker_cmd(VkCommandBuffer cmd, VkFramebuffer fb) const;
+    void draw_object(const Simulation::Object &obj, const Simulation::Transform &xform, const UploadRing::Allocation &dst,
+                     VkCommandBuffer cmd) const;
+    void draw_object_range(int begin, int end, const FrameData &data, VkCommandBuffer cmd);
     void draw_objects(Worker &worker);
+    void draw_instances(const FrameData &data, VkCommandBuffer cmd) const;
+
+    // called by on_frame
+    void read_timestamps(FrameData &data);
+
+    // called by scheduler threads
+    void run_frame_chunk(int thread, int begin, int end);
+    void draw_objects(int thread, int begin, int end);
+
+    VkFramebuffer draw_fb_;
 };
 
 #endif  // HOLOGRAM_H
@@ -0,0 +1,32 @@
+#version 310 es
+
+layout(location = 0) in vec3 in_pos;
+layout(location = 1) in vec3 in_normal;
+
+// per-instance
+layout(location = 2) in mat4 in_model;
+layout(location = 6) in vec3 in_light_pos;
+layout(location = 7) in vec3 in_light_color;
+layout(location = 8) in float in_alpha;
+
+layout(std140, push_constant) uniform param_block {
+	mat4 view_projection;
+} params;
+
+layout(location = 0) out vec3 color;
+layout(location = 1) out float alpha;
+
+void main()
+{
+	vec3 world_light = vec3(in_model * vec4(in_light_pos, 1.0));
+	vec3 world_pos = vec3(in_model * vec4(in_pos, 1.0));
+	vec3 world_normal = vec3(in_model * vec4(in_normal, 0.0));
+
+	vec3 light_dir = world_light - world_pos;
+	float brightness = dot(light_dir, world_normal) / length(light_dir) / length(world_normal);
+	brightness = abs(brightness);
+
+	gl_Position = params.view_projection * vec4(world_pos, 1.0);
+	color = in_light_color * brightness;
+	alpha = in_alpha;
+}
@@ -30,13 +30,32 @@ Game *create_game(int argc, char **argv) {
 
 }  // namespace
 
+#ifndef VK_USE_PLATFORM_ANDROID_KHR
+
+#include "ShellHeadless.h"
+
+namespace {
+
+bool run_headless(Game &game) {
+    if (!game.settings().headless) return false;
+
+    ShellHeadless shell(game);
+    shell.run();
+
+    return true;
+}
+
+}  // namespace
+
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+
 #if defined(VK_USE_PLATFORM_XCB_KHR)
 
 #include "ShellXcb.h"
 
 int main(int argc, char **argv) {
     Game *game = create_game(argc, argv);
-    {
+    if (!run_headless(*game)) {
         ShellXcb shell(*game);
         shell.run();
     }
@@ -51,7 +70,7 @@ int main(int argc, char **argv) {
 
 int main(int argc, char **argv) {
     Game *game = create_game(argc, argv);
-    {
+    if (!run_headless(*game)) {
         ShellWayland shell(*game);
         shell.run();
     }
@@ -83,7 +102,7 @@ void android_main(android_app *app) {
 
 int main(int argc, char **argv) {
     Game *game = create_game(argc, argv);
-    {
+    if (!run_headless(*game)) {
         ShellWin32 shell(*game);
         shell.run();
     }
@@ -92,4 +111,18 @@ int main(int argc, char **argv) {
     return 0;
 }
 
+#else
+
+// no window system; always headless
+int main(int argc, char **argv) {
+    Game *game = create_game(argc, argv);
+    {
+        ShellHeadless shell(*game);
+        shell.run();
+    }
+    delete game;
+
+    return 0;
+}
+
 #endif  // VK_USE_PLATFORM_XCB_KHR
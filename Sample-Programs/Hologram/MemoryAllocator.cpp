@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "Helpers.h"
+#include "MemoryAllocator.h"
+
+namespace {
+
+const uint32_t dedicated_pool = ~0u;
+
+}  // namespace
+
+MemoryAllocator::MemoryAllocator(VkDevice dev, const VkPhysicalDeviceMemoryProperties &mem_props,
+                                 VkDeviceSize buffer_image_granularity, VkDeviceSize block_size)
+    : dev_(dev), mem_props_(mem_props), separate_optimal_(buffer_image_granularity > 1), pools_(mem_props.memoryTypeCount * 2),
+      stats_() {
+    for (uint32_t i = 0; i < pools_.size(); i++) {
+        Pool &pool = pools_[i];
+        pool.type_index = i / 2;
+
+        const VkDeviceSize heap_size = mem_props_.memoryHeaps[mem_props_.memoryTypes[pool.type_index].heapIndex].size;
+        init_buddy_pool(pool.buddy, block_size, heap_size);
+    }
+}
+
+MemoryAllocator::~MemoryAllocator() {
+    assert(!stats_.allocation_count);
+
+    // freeing mapped memory implicitly unmaps it
+    for (auto &pool : pools_) {
+        for (auto &block : pool.blocks) {
+            if (block.mem != VK_NULL_HANDLE) vk::FreeMemory(dev_, block.mem, nullptr);
+        }
+    }
+}
+
+uint32_t MemoryAllocator::find_type(uint32_t type_bits, VkMemoryPropertyFlags flags) const {
+    for (uint32_t idx = 0; idx < mem_props_.memoryTypeCount; idx++) {
+        if ((type_bits & (1 << idx)) && (mem_props_.memoryTypes[idx].propertyFlags & flags) == flags) return idx;
+    }
+
+    throw std::runtime_error("no memory type has the requested properties");
+}
+
+VkResult MemoryAllocator::allocate_memory(uint32_t type_index, VkDeviceSize size, VkDeviceMemory &mem, uint8_t *&ptr) {
+    VkMemoryAllocateInfo mem_info = {};
+    mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mem_info.allocationSize = size;
+    mem_info.memoryTypeIndex = type_index;
+
+    VkResult res = vk::AllocateMemory(dev_, &mem_info, nullptr, &mem);
+    if (res != VK_SUCCESS) return res;
+
+    ptr = nullptr;
+    if (mem_props_.memoryTypes[type_index].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        res = vk::MapMemory(dev_, mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&ptr));
+        if (res != VK_SUCCESS) {
+            vk::FreeMemory(dev_, mem, nullptr);
+            mem = VK_NULL_HANDLE;
+        }
+    }
+
+    return res;
+}
+
+bool MemoryAllocator::allocate_from(Pool &pool, uint32_t order, Allocation &alloc) {
+    uint32_t b;
+    uint64_t offset;
+    if (!execute_buddy_allocate(pool.buddy, order, b, offset)) {
+        Block block;
+        const VkDeviceSize block_size = VkDeviceSize(1) << pool.buddy.order;
+        if (allocate_memory(pool.type_index, block_size, block.mem, block.ptr) != VK_SUCCESS) return false;
+
+        b = execute_buddy_add_block(pool.buddy);
+        pool.blocks.resize(pool.buddy.blocks.size());
+        pool.blocks[b] = block;
+
+        const bool found = execute_buddy_allocate(pool.buddy, order, b, offset);
+        assert(found);
+        (void)found;
+
+        stats_.block_count++;
+        stats_.block_bytes += block_size;
+    }
+
+    const Block &block = pool.blocks[b];
+    alloc.mem = block.mem;
+    alloc.offset = offset;
+    alloc.ptr = block.ptr ? block.ptr + offset : nullptr;
+    alloc.block = b;
+    alloc.order = order;
+
+    return true;
+}
+
+MemoryAllocator::Allocation MemoryAllocator::allocate(const VkMemoryRequirements &reqs, VkMemoryPropertyFlags flags,
+                                                      bool optimal_image) {
+    const uint32_t type_index = find_type(reqs.memoryTypeBits, flags);
+    const uint32_t pool_index = type_index * 2 + ((optimal_image && separate_optimal_) ? 1 : 0);
+    const uint32_t order = get_buddy_order(std::max(reqs.size, reqs.alignment));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Allocation alloc = {};
+    alloc.size = reqs.size;
+
+    // the heap may be too full for another block but not for this
+    if (order < pools_[pool_index].buddy.order && allocate_from(pools_[pool_index], order, alloc)) {
+        alloc.pool = pool_index;
+        stats_.wasted_bytes += (VkDeviceSize(1) << order) - reqs.size;
+    } else {
+        vk::assert_success(allocate_memory(type_index, reqs.size, alloc.mem, alloc.ptr));
+        alloc.pool = dedicated_pool;
+        stats_.dedicated_count++;
+        stats_.dedicated_bytes += reqs.size;
+    }
+
+    stats_.allocation_count++;
+    stats_.used_bytes += reqs.size;
+
+    return alloc;
+}
+
+void MemoryAllocator::free(Allocation &alloc) {
+    if (alloc.mem == VK_NULL_HANDLE) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    stats_.allocation_count--;
+    stats_.used_bytes -= alloc.size;
+
+    if (alloc.pool == dedicated_pool) {
+        vk::FreeMemory(dev_, alloc.mem, nullptr);
+        stats_.dedicated_count--;
+        stats_.dedicated_bytes -= alloc.size;
+    } else {
+        Pool &pool = pools_[alloc.pool];
+        Block &block = pool.blocks[alloc.block];
+        assert(block.mem == alloc.mem);
+
+        stats_.wasted_bytes -= (VkDeviceSize(1) << alloc.order) - alloc.size;
+        if (execute_buddy_free(pool.buddy, alloc.block, alloc.order, alloc.offset)) {
+            vk::FreeMemory(dev_, block.mem, nullptr);
+            block.mem = VK_NULL_HANDLE;
+            block.ptr = nullptr;
+
+            stats_.block_count--;
+            stats_.block_bytes -= VkDeviceSize(1) << pool.buddy.order;
+        }
+    }
+
+    alloc.mem = VK_NULL_HANDLE;
+    alloc.ptr = nullptr;
+}
+
+MemoryAllocator::Allocation MemoryAllocator::allocate(VkBuffer buf, VkMemoryPropertyFlags flags) {
+    VkMemoryRequirements mem_reqs;
+    vk::GetBufferMemoryRequirements(dev_, buf, &mem_reqs);
+
+    Allocation alloc = allocate(mem_reqs, flags, false);
+    vk::BindBufferMemory(dev_, buf, alloc.mem, alloc.offset);
+
+    return alloc;
+}
+
+MemoryAllocator::Allocation MemoryAllocator::allocate(VkImage img, VkImageTiling tiling, VkMemoryPropertyFlags flags) {
+    VkMemoryRequirements mem_reqs;
+    vk::GetImageMemoryRequirements(dev_, img, &mem_reqs);
+
+    Allocation alloc = allocate(mem_reqs, flags, tiling == VK_IMAGE_TILING_OPTIMAL);
+    vk::BindImageMemory(dev_, img, alloc.mem, alloc.offset);
+
+    return alloc;
+}
+
+MemoryAllocator::Stats MemoryAllocator::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MEMORY_ALLOCATOR_H
+#define MEMORY_ALLOCATOR_H
+
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "util_buddy.hpp"
+
+// Suballocates device memory from large blocks, one list of blocks per memory
+// type, with the buddy allocator of the sample utilities (util_buddy.hpp).
+// Unless bufferImageGranularity is 1, optimal images get blocks of their own
+// so they never neighbor buffers or linear images.  Requests of more than
+// half a block, or that fail to get a new block, get dedicated allocations.
+//
+// This is util_memory.cpp of the sample utilities for Hologram, which calls
+// Vulkan through its dispatch table and throws on errors.
+//
+// Host visible blocks stay mapped for their lifetime.  allocate() and free()
+// may be called from several threads at once.
+class MemoryAllocator {
+   public:
+    MemoryAllocator(VkDevice dev, const VkPhysicalDeviceMemoryProperties &mem_props, VkDeviceSize buffer_image_granularity,
+                    VkDeviceSize block_size = 64 * 1024 * 1024);
+    ~MemoryAllocator();
+
+    MemoryAllocator(const MemoryAllocator &allocator) = delete;
+    MemoryAllocator &operator=(const MemoryAllocator &allocator) = delete;
+
+    struct Allocation {
+        VkDeviceMemory mem;
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        // null unless the memory is host visible
+        uint8_t *ptr;
+
+        uint32_t pool;
+        uint32_t block;
+        uint32_t order;
+    };
+
+    // throws when no memory type has all of flags or the memory runs out
+    Allocation allocate(const VkMemoryRequirements &reqs, VkMemoryPropertyFlags flags, bool optimal_image);
+    void free(Allocation &alloc);
+
+    // allocate and bind
+    Allocation allocate(VkBuffer buf, VkMemoryPropertyFlags flags);
+    Allocation allocate(VkImage img, VkImageTiling tiling, VkMemoryPropertyFlags flags);
+
+    struct Stats {
+        uint32_t block_count;
+        uint32_t dedicated_count;
+        uint32_t allocation_count;
+
+        // allocated from the driver
+        VkDeviceSize block_bytes;
+        VkDeviceSize dedicated_bytes;
+        // as requested, and lost to rounding up
+        VkDeviceSize used_bytes;
+        VkDeviceSize wasted_bytes;
+    };
+    Stats stats() const;
+
+   private:
+    // the memory behind a block of a buddy_pool
+    struct Block {
+        VkDeviceMemory mem;
+        uint8_t *ptr;
+    };
+
+    struct Pool {
+        uint32_t type_index;
+        buddy_pool buddy;
+        // indexed like buddy.blocks
+        std::vector<Block> blocks;
+    };
+
+    uint32_t find_type(uint32_t type_bits, VkMemoryPropertyFlags flags) const;
+    VkResult allocate_memory(uint32_t type_index, VkDeviceSize size, VkDeviceMemory &mem, uint8_t *&ptr);
+    bool allocate_from(Pool &pool, uint32_t order, Allocation &alloc);
+
+    VkDevice dev_;
+    VkPhysicalDeviceMemoryProperties mem_props_;
+    bool separate_optimal_;
+
+    mutable std::mutex mutex_;
+    // indexed by memory type * 2 + optimal
+    std::vector<Pool> pools_;
+    Stats stats_;
+};
+
+#endif  // MEMORY_ALLOCATOR_H
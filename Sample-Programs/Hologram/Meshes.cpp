@@ -372,8 +372,9 @@ void build_meshes(std::array<Mesh, Meshes::MESH_COUNT> &meshes) {
 
 }  // namespace
 
-Meshes::Meshes(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags)
+Meshes::Meshes(VkDevice dev, MemoryAllocator &allocator)
     : dev_(dev),
+      allocator_(allocator),
       vertex_input_binding_(Mesh::vertex_input_binding()),
       vertex_input_attrs_(Mesh::vertex_input_attributes()),
       vertex_input_state_(),
@@ -409,11 +410,11 @@ Meshes::Meshes(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags
         ib_size += mesh.index_buffer_size();
     }
 
-    allocate_resources(vb_size, ib_size, mem_flags);
+    allocate_resources(vb_size, ib_size);
 
-    uint8_t *vb_data, *ib_data;
-    vk::assert_success(vk::MapMemory(dev_, mem_, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&vb_data)));
-    ib_data = vb_data + ib_mem_offset_;
+    // the allocator keeps mappable memory mapped
+    uint8_t *vb_data = vb_mem_.ptr;
+    uint8_t *ib_data = ib_mem_.ptr;
 
     for (const auto &mesh : meshes) {
         mesh.vertex_buffer_write(vb_data);
@@ -421,14 +422,13 @@ Meshes::Meshes(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags
         vb_data += mesh.vertex_buffer_size();
         ib_data += mesh.index_buffer_size();
     }
-
-    vk::UnmapMemory(dev_, mem_);
 }
 
 Meshes::~Meshes() {
-    vk::FreeMemory(dev_, mem_, nullptr);
     vk::DestroyBuffer(dev_, vb_, nullptr);
     vk::DestroyBuffer(dev_, ib_, nullptr);
+    allocator_.free(vb_mem_);
+    allocator_.free(ib_mem_);
 }
 
 void Meshes::cmd_bind_buffers(VkCommandBuffer cmd) const {
@@ -443,7 +443,7 @@ void Meshes::cmd_draw(VkCommandBuffer cmd, Type type) const {
     vk::CmdDrawIndexed(cmd, draw.indexCount, draw.instanceCount, draw.firstIndex, draw.vertexOffset, draw.firstInstance);
 }
 
-void Meshes::allocate_resources(VkDeviceSize vb_size, VkDeviceSize ib_size, const std::vector<VkMemoryPropertyFlags> &mem_flags) {
+void Meshes::allocate_resources(VkDeviceSize vb_size, VkDeviceSize ib_size) {
     VkBufferCreateInfo buf_info = {};
     buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buf_info.size = vb_size;
@@ -455,30 +455,8 @@ void Meshes::allocate_resources(VkDeviceSize vb_size, VkDeviceSize ib_size, cons
     buf_info.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
     vk::CreateBuffer(dev_, &buf_info, nullptr, &ib_);
 
-    VkMemoryRequirements vb_mem_reqs, ib_mem_reqs;
-    vk::GetBufferMemoryRequirements(dev_, vb_, &vb_mem_reqs);
-    vk::GetBufferMemoryRequirements(dev_, ib_, &ib_mem_reqs);
-
-    // indices follow vertices
-    ib_mem_offset_ = vb_mem_reqs.size + (ib_mem_reqs.alignment - (vb_mem_reqs.size % ib_mem_reqs.alignment));
-
-    VkMemoryAllocateInfo mem_info = {};
-    mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    mem_info.allocationSize = ib_mem_offset_ + ib_mem_reqs.size;
-
-    // find any supported and mappable memory type
-    uint32_t mem_types = (vb_mem_reqs.memoryTypeBits & ib_mem_reqs.memoryTypeBits);
-    for (uint32_t idx = 0; idx < mem_flags.size(); idx++) {
-        if ((mem_types & (1 << idx)) && (mem_flags[idx] & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
-            (mem_flags[idx] & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
-            // TODO this may not be reachable
-            mem_info.memoryTypeIndex = idx;
-            break;
-        }
-    }
-
-    vk::AllocateMemory(dev_, &mem_info, nullptr, &mem_);
-
-    vk::BindBufferMemory(dev_, vb_, mem_, 0);
-    vk::BindBufferMemory(dev_, ib_, mem_, ib_mem_offset_);
+    // both are suballocated, likely from the same block
+    const VkMemoryPropertyFlags mappable = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vb_mem_ = allocator_.allocate(vb_, mappable);
+    ib_mem_ = allocator_.allocate(ib_, mappable);
 }
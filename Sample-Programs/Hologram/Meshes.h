@@ -20,9 +20,11 @@
 #include <vulkan/vulkan.h>
 #include <vector>
 
+#include "MemoryAllocator.h"
+
 class Meshes {
    public:
-    Meshes(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags);
+    Meshes(VkDevice dev, MemoryAllocator &allocator);
     ~Meshes();
 
     const VkPipelineVertexInputStateCreateInfo &vertex_input_state() const { return vertex_input_state_; }
@@ -39,10 +41,14 @@ class Meshes {
     void cmd_bind_buffers(VkCommandBuffer cmd) const;
     void cmd_draw(VkCommandBuffer cmd, Type type) const;
 
+    // a single-instance draw of the mesh
+    const VkDrawIndexedIndirectCommand &draw_command(Type type) const { return draw_commands_[type]; }
+
    private:
-    void allocate_resources(VkDeviceSize vb_size, VkDeviceSize ib_size, const std::vector<VkMemoryPropertyFlags> &mem_flags);
+    void allocate_resources(VkDeviceSize vb_size, VkDeviceSize ib_size);
 
     VkDevice dev_;
+    MemoryAllocator &allocator_;
 
     VkVertexInputBindingDescription vertex_input_binding_;
     std::vector<VkVertexInputAttributeDescription> vertex_input_attrs_;
@@ -54,8 +60,8 @@ class Meshes {
 
     VkBuffer vb_;
     VkBuffer ib_;
-    VkDeviceMemory mem_;
-    VkDeviceSize ib_mem_offset_;
+    MemoryAllocator::Allocation vb_mem_;
+    MemoryAllocator::Allocation ib_mem_;
 };
 
 #endif  // MESHES_H
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Helpers.h"
+#include "PipelineCache.h"
+#include "util_pipeline_cache_file.hpp"
+
+PipelineCache::PipelineCache(VkDevice dev, const VkPhysicalDeviceProperties &props, const std::string &dir,
+                             const std::string &name)
+    : dev_(dev), props_(props), cache_(VK_NULL_HANDLE), loaded_(false) {
+    path_ = get_pipeline_cache_file_path(dir.empty() ? name : dir + "/" + name, props_);
+
+    std::vector<uint8_t> data;
+    if (read_pipeline_cache_file(path_, data)) {
+        loaded_ = validate(data);
+        if (!loaded_) data.clear();
+    } else {
+        load_error_ = "no cache at " + path_;
+    }
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.initialDataSize = data.size();
+    cache_info.pInitialData = data.data();
+    vk::assert_success(vk::CreatePipelineCache(dev_, &cache_info, nullptr, &cache_));
+}
+
+PipelineCache::~PipelineCache() { vk::DestroyPipelineCache(dev_, cache_, nullptr); }
+
+bool PipelineCache::validate(const std::vector<uint8_t> &data) {
+    pipeline_cache_header header;
+    if (!read_pipeline_cache_header(data.data(), data.size(), header)) {
+        load_error_ = path_ + " is too short for a pipeline cache";
+        return false;
+    }
+
+    const uint32_t errors = get_pipeline_cache_header_errors(header, data.size(), props_);
+    if (errors & (PIPELINE_CACHE_BAD_LENGTH | PIPELINE_CACHE_BAD_VERSION)) {
+        load_error_ = path_ + " has an unsupported pipeline cache header";
+        return false;
+    }
+    if (errors) {
+        load_error_ = path_ + " was written for another device or driver";
+        return false;
+    }
+
+    return true;
+}
+
+bool PipelineCache::save() const {
+    size_t size = 0;
+    if (vk::GetPipelineCacheData(dev_, cache_, &size, nullptr) != VK_SUCCESS) return false;
+
+    std::vector<uint8_t> data(size);
+    if (vk::GetPipelineCacheData(dev_, cache_, &size, data.data()) != VK_SUCCESS) return false;
+
+    return write_pipeline_cache_file(path_, data.data(), size);
+}
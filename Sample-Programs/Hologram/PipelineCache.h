@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PIPELINE_CACHE_H
+#define PIPELINE_CACHE_H
+
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+// A pipeline cache kept on disk between runs, in a file per device under
+// dir as util_pipeline_cache_file.hpp describes.  Data whose header does not
+// match the device is not handed to the driver; the next save() replaces it.
+class PipelineCache {
+   public:
+    PipelineCache(VkDevice dev, const VkPhysicalDeviceProperties &props, const std::string &dir, const std::string &name);
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache &cache) = delete;
+    PipelineCache &operator=(const PipelineCache &cache) = delete;
+
+    VkPipelineCache handle() const { return cache_; }
+    const std::string &path() const { return path_; }
+
+    // whether valid data was loaded, and why not otherwise
+    bool loaded() const { return loaded_; }
+    const std::string &load_error() const { return load_error_; }
+
+    bool save() const;
+
+   private:
+    bool validate(const std::vector<uint8_t> &data);
+
+    VkDevice dev_;
+    VkPhysicalDeviceProperties props_;
+    std::string path_;
+
+    VkPipelineCache cache_;
+    bool loaded_;
+    std::string load_error_;
+};
+
+#endif  // PIPELINE_CACHE_H
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+
+#include "Profiler.h"
+
+namespace {
+
+const char *span_names[Profiler::SPAN_COUNT] = {
+    "tick", "record", "submit", "acquire", "present", "gpu",
+};
+
+// bound the memory of long traces
+const size_t max_trace_events_per_thread = 1 << 20;
+
+}  // namespace
+
+Profiler::Profiler(int thread_count, int report_interval, bool trace)
+    : start_(Clock::now()),
+      report_interval_(static_cast<size_t>(std::max(report_interval, 1))),
+      trace_(trace),
+      threads_(std::max(thread_count, 1)),
+      frame_count_(0) {
+    for (auto &thread : threads_) {
+        std::fill(thread.seconds, thread.seconds + SPAN_COUNT, 0.0);
+        std::fill(thread.counts, thread.counts + SPAN_COUNT, 0);
+    }
+
+    for (int i = 0; i < SPAN_COUNT; i++) frames_[i].reserve(report_interval_);
+}
+
+void Profiler::add(Span span, int thread, Clock::time_point begin, Clock::time_point end) {
+    assert(thread >= 0 && thread < thread_count());
+    Thread &t = threads_[thread];
+
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+    t.seconds[span] += seconds;
+    t.counts[span]++;
+
+    if (trace_ && t.events.size() < max_trace_events_per_thread) {
+        Event ev;
+        ev.span = span;
+        ev.begin = std::chrono::duration<double, std::micro>(begin - start_).count();
+        ev.duration = seconds * 1e6;
+        t.events.push_back(ev);
+    }
+}
+
+void Profiler::add_gpu(Clock::time_point cpu_time, double seconds) {
+    add(SPAN_GPU, 0, cpu_time, cpu_time + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds)));
+}
+
+bool Profiler::end_frame() {
+    for (int i = 0; i < SPAN_COUNT; i++) {
+        double seconds = 0.0;
+        int count = 0;
+        for (auto &thread : threads_) {
+            seconds += thread.seconds[i];
+            count += thread.counts[i];
+            thread.seconds[i] = 0.0;
+            thread.counts[i] = 0;
+        }
+
+        if (count) frames_[i].push_back(static_cast<float>(seconds * 1000.0));
+    }
+
+    if (++frame_count_ < report_interval_) return false;
+
+    update_report();
+    frame_count_ = 0;
+
+    return true;
+}
+
+void Profiler::update_report() {
+    std::stringstream ss;
+    ss.precision(3);
+    ss << std::fixed << "last " << frame_count_ << " frames (ms per frame, min/avg/p99):";
+
+    for (int i = 0; i < SPAN_COUNT; i++) {
+        std::vector<float> &frames = frames_[i];
+        if (frames.empty()) continue;
+
+        std::sort(frames.begin(), frames.end());
+
+        double sum = 0.0;
+        for (auto ms : frames) sum += ms;
+
+        const size_t p99 = static_cast<size_t>(0.99f * static_cast<float>(frames.size() - 1) + 0.5f);
+        ss << "\n  " << span_names[i] << ": " << frames.front() << " / " << sum / frames.size() << " / " << frames[p99];
+
+        frames.clear();
+    }
+
+    report_ = ss.str();
+}
+
+bool Profiler::write_trace(const std::string &filename) const {
+    std::ofstream file(filename);
+    if (!file) return false;
+
+    // GPU spans are shown on a thread of their own
+    const int gpu_tid = thread_count();
+
+    file << "{\"traceEvents\":[\n";
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"main\"}},\n";
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << gpu_tid << ",\"args\":{\"name\":\"gpu\"}}";
+
+    file.precision(3);
+    file << std::fixed;
+    for (int tid = 0; tid < thread_count(); tid++) {
+        for (const auto &ev : threads_[tid].events) {
+            file << ",\n{\"name\":\"" << span_names[ev.span] << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                 << (ev.span == SPAN_GPU ? gpu_tid : tid) << ",\"ts\":" << ev.begin << ",\"dur\":" << ev.duration << "}";
+        }
+    }
+
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
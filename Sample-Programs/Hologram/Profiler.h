@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Collects CPU and GPU time spans.  The time of each span is summed per
+// frame, and every report_interval frames the min/avg/p99 of the per-frame
+// sums are made available as a report.  Optionally every span is kept for a
+// Chrome trace (chrome://tracing).
+//
+// Spans are added to per-thread slots without locking.  Slot 0 belongs to
+// the main thread, and a slot must not be used by two threads at once.
+class Profiler {
+   public:
+    typedef std::chrono::steady_clock Clock;
+
+    enum Span {
+        SPAN_TICK,
+        SPAN_RECORD,
+        SPAN_SUBMIT,
+        SPAN_ACQUIRE,
+        SPAN_PRESENT,
+        SPAN_GPU,
+        SPAN_COUNT,
+    };
+
+    Profiler(int thread_count, int report_interval, bool trace);
+
+    int thread_count() const { return static_cast<int>(threads_.size()); }
+
+    void add(Span span, int thread, Clock::time_point begin, Clock::time_point end);
+
+    // GPU time of a frame.  The GPU clock is not calibrated against the CPU
+    // clock, so the span is placed at cpu_time in the trace.
+    void add_gpu(Clock::time_point cpu_time, double seconds);
+
+    // called by the main thread while no other thread adds spans; returns
+    // true when a new report is available
+    bool end_frame();
+    const std::string &report() const { return report_; }
+
+    bool write_trace(const std::string &filename) const;
+
+    // adds a span from construction to destruction, unless profiler is null
+    class Scope {
+       public:
+        Scope(Profiler *profiler, Span span, int thread) : profiler_(profiler), span_(span), thread_(thread) {
+            if (profiler_) begin_ = Clock::now();
+        }
+        ~Scope() {
+            if (profiler_) profiler_->add(span_, thread_, begin_, Clock::now());
+        }
+
+       private:
+        Profiler *profiler_;
+        Span span_;
+        int thread_;
+        Clock::time_point begin_;
+    };
+
+   private:
+    struct Event {
+        Span span;
+        // microseconds since start_
+        double begin;
+        double duration;
+    };
+
+    struct Thread {
+        double seconds[SPAN_COUNT];
+        int counts[SPAN_COUNT];
+        std::vector<Event> events;
+
+        // keep the slots of different threads on different cache lines
+        char padding[64];
+    };
+
+    void update_report();
+
+    const Clock::time_point start_;
+    const size_t report_interval_;
+    const bool trace_;
+
+    std::vector<Thread> threads_;
+
+    // per-frame sums in milliseconds, of the frames a span occurred in
+    std::vector<float> frames_[SPAN_COUNT];
+    size_t frame_count_;
+
+    std::string report_;
+};
+
+#endif  // PROFILER_H
@@ -20,12 +20,20 @@
 #include <string>
 #include <sstream>
 #include <set>
+#include <thread>
 #include "Helpers.h"
 #include "Shell.h"
 #include "Game.h"
 
+namespace {
+
+// frames per profiler report
+const int profiler_report_interval = 300;
+
+}  // namespace
+
 Shell::Shell(Game &game)
-    : game_(game), settings_(game.settings()), ctx_(), game_tick_(1.0f / settings_.ticks_per_second), game_time_(game_tick_) {
+    : ctx_(), game_(game), settings_(game.settings()), game_tick_(1.0f / settings_.ticks_per_second), game_time_(game_tick_) {
     // require generic WSI extensions
     instance_extensions_.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
     device_extensions_.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
@@ -35,6 +43,16 @@ Shell::Shell(Game &game)
         instance_layers_.push_back("VK_LAYER_KHRONOS_validation");
         instance_extensions_.push_back(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
     }
+
+    // the main thread plus one slot for each thread games may start
+    if (settings_.profile)
+        profiler_.reset(new Profiler(static_cast<int>(std::thread::hardware_concurrency()) + 1, profiler_report_interval,
+                                     !settings_.trace_file.empty()));
+}
+
+Shell::~Shell() {
+    if (profiler_ && !settings_.trace_file.empty() && !profiler_->write_trace(settings_.trace_file))
+        log(LOG_ERR, "failed to write the trace");
 }
 
 void Shell::log(LogPriority priority, const char *msg) const {
@@ -326,6 +344,7 @@ void Shell::create_swapchain() {
     std::vector<VkSurfaceFormatKHR> formats;
     vk::get(ctx_.physical_dev, ctx_.surface, formats);
     ctx_.format = formats[0];
+    ctx_.present_layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
     // defer to resize_swapchain()
     ctx_.swapchain = VK_NULL_HANDLE;
@@ -339,6 +358,7 @@ void Shell::destroy_swapchain() {
 
         vk::DestroySwapchainKHR(ctx_.dev, ctx_.swapchain, nullptr);
         ctx_.swapchain = VK_NULL_HANDLE;
+        ctx_.images.clear();
     }
 
     vk::DestroySurfaceKHR(ctx_.instance, ctx_.surface, nullptr);
@@ -432,14 +452,19 @@ void Shell::resize_swapchain(uint32_t width_hint, uint32_t height_hint) {
         vk::DestroySwapchainKHR(ctx_.dev, swapchain_info.oldSwapchain, nullptr);
     }
 
+    vk::assert_success(vk::get(ctx_.dev, ctx_.swapchain, ctx_.images));
+
     game_.attach_swapchain();
 }
 
 void Shell::add_game_time(float time) {
     int max_ticks = 3;
 
+    if (settings_.fixed_timestep) time = game_tick_;
+
     if (!settings_.no_tick) game_time_ += time;
 
+    // when settings_.pipelined, the ticks run during the following on_frame
     while (game_time_ >= game_tick_ && max_ticks--) {
         game_.on_tick();
         game_time_ -= game_tick_;
@@ -450,6 +475,8 @@ void Shell::acquire_back_buffer() {
     // acquire just once when not presenting
     if (settings_.no_present && ctx_.acquired_back_buffer.acquire_semaphore != VK_NULL_HANDLE) return;
 
+    Profiler::Scope scope(profiler_.get(), Profiler::SPAN_ACQUIRE, 0);
+
     auto &buf = ctx_.back_buffers.front();
 
     // wait until acquire and render semaphores are waited/unsignaled
@@ -457,6 +484,13 @@ void Shell::acquire_back_buffer() {
     // reset the fence
     vk::assert_success(vk::ResetFences(ctx_.dev, 1, &buf.present_fence));
 
+    acquire_image(buf);
+
+    ctx_.acquired_back_buffer = buf;
+    ctx_.back_buffers.pop();
+}
+
+void Shell::acquire_image(BackBuffer &buf) {
     VkResult res = VK_TIMEOUT; // Anything but VK_SUCCESS
     while (res != VK_SUCCESS) {
         res = vk::AcquireNextImageKHR(ctx_.dev, ctx_.swapchain, UINT64_MAX, buf.acquire_semaphore, VK_NULL_HANDLE, &buf.image_index);
@@ -468,9 +502,6 @@ void Shell::acquire_back_buffer() {
             assert(!res);
         }
     }
-
-    ctx_.acquired_back_buffer = buf;
-    ctx_.back_buffers.pop();
 }
 
 void Shell::present_back_buffer() {
@@ -480,9 +511,16 @@ void Shell::present_back_buffer() {
 
     if (settings_.no_present) {
         fake_present();
-        return;
+    } else {
+        Profiler::Scope scope(profiler_.get(), Profiler::SPAN_PRESENT, 0);
+        present_image(buf);
+        ctx_.back_buffers.push(buf);
     }
 
+    if (profiler_ && profiler_->end_frame()) log(LOG_INFO, profiler_->report().c_str());
+}
+
+void Shell::present_image(const BackBuffer &buf) {
     VkPresentInfoKHR present_info = {};
     present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     present_info.waitSemaphoreCount = 1;
@@ -501,7 +539,6 @@ void Shell::present_back_buffer() {
     }
 
     vk::assert_success(vk::QueueSubmit(ctx_.present_queue, 0, nullptr, buf.present_fence));
-    ctx_.back_buffers.push(buf);
 }
 
 void Shell::fake_present() {
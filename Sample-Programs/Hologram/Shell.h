@@ -17,12 +17,14 @@
 #ifndef SHELL_H
 #define SHELL_H
 
+#include <memory>
 #include <queue>
 #include <vector>
 #include <stdexcept>
 #include <vulkan/vulkan.h>
 
 #include "Game.h"
+#include "Profiler.h"
 
 class Game;
 
@@ -30,7 +32,7 @@ class Shell {
    public:
     Shell(const Shell &sh) = delete;
     Shell &operator=(const Shell &sh) = delete;
-    virtual ~Shell() {}
+    virtual ~Shell();
 
     struct BackBuffer {
         uint32_t image_index;
@@ -62,10 +64,18 @@ class Shell {
         VkSwapchainKHR swapchain;
         VkExtent2D extent;
 
+        // the images of the swapchain, or of the headless image ring, and
+        // the layout games leave them in for presentation
+        std::vector<VkImage> images;
+        VkImageLayout present_layout;
+
         BackBuffer acquired_back_buffer;
     };
     const Context &context() const { return ctx_; }
 
+    // null unless settings().profile
+    Profiler *profiler() const { return profiler_.get(); }
+
     enum LogPriority {
         LOG_DEBUG,
         LOG_INFO,
@@ -93,6 +103,16 @@ class Shell {
     void acquire_back_buffer();
     void present_back_buffer();
 
+    // called by create_context and destroy_context
+    virtual void create_swapchain();
+    virtual void destroy_swapchain();
+
+    // called by acquire_back_buffer and present_back_buffer
+    virtual void acquire_image(BackBuffer &buf);
+    virtual void present_image(const BackBuffer &buf);
+
+    Context ctx_;
+
     Game &game_;
     const Game::Settings &settings_;
 
@@ -101,6 +121,8 @@ class Shell {
 
     std::vector<const char *> device_extensions_;
 
+    std::unique_ptr<Profiler> profiler_;
+
    private:
     bool debug_report_callback(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT obj_type, uint64_t object, size_t location,
                                int32_t msg_code, const char *layer_prefix, const char *msg);
@@ -129,13 +151,9 @@ class Shell {
     void create_back_buffers();
     void destroy_back_buffers();
     virtual VkSurfaceKHR create_surface(VkInstance instance) = 0;
-    void create_swapchain();
-    void destroy_swapchain();
 
     void fake_present();
 
-    Context ctx_;
-
     const float game_tick_;
     float game_time_;
 };
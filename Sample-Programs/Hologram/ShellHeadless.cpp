@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "Helpers.h"
+#include "Game.h"
+#include "ShellHeadless.h"
+
+namespace {
+
+// frames to run when Game::Settings::max_frame_count is not set
+const int default_frame_count = 1000;
+
+bool is_wsi_extension(const char *name) {
+    return !strcmp(name, VK_KHR_SURFACE_EXTENSION_NAME) || !strcmp(name, VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+}
+
+}  // namespace
+
+ShellHeadless::ShellHeadless(Game &game) : Shell(game), lib_handle_(nullptr), next_image_(0), frame_count_(0), quit_(false) {
+    // no surface and no swapchain
+    instance_extensions_.erase(std::remove_if(instance_extensions_.begin(), instance_extensions_.end(), is_wsi_extension),
+                               instance_extensions_.end());
+    device_extensions_.erase(std::remove_if(device_extensions_.begin(), device_extensions_.end(), is_wsi_extension),
+                             device_extensions_.end());
+
+    init_vk();
+}
+
+ShellHeadless::~ShellHeadless() {
+    cleanup_vk();
+
+#ifdef _WIN32
+    FreeLibrary(reinterpret_cast<HMODULE>(lib_handle_));
+#else
+    dlclose(lib_handle_);
+#endif
+}
+
+PFN_vkGetInstanceProcAddr ShellHeadless::load_vk() {
+#ifdef _WIN32
+    const char filename[] = "vulkan-1.dll";
+    HMODULE mod = LoadLibrary(filename);
+    PFN_vkGetInstanceProcAddr get_proc = nullptr;
+    if (mod) get_proc = reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(mod, "vkGetInstanceProcAddr"));
+
+    if (!mod || !get_proc) {
+        std::stringstream ss;
+        ss << "failed to load " << filename;
+
+        if (mod) FreeLibrary(mod);
+
+        throw std::runtime_error(ss.str());
+    }
+
+    lib_handle_ = mod;
+
+    return get_proc;
+#else
+    const char filename[] = "libvulkan.so.1";
+    void *handle, *symbol = nullptr;
+
+#ifdef UNINSTALLED_LOADER
+    handle = dlopen(UNINSTALLED_LOADER, RTLD_LAZY);
+    if (!handle) handle = dlopen(filename, RTLD_LAZY);
+#else
+    handle = dlopen(filename, RTLD_LAZY);
+#endif
+
+    if (handle) symbol = dlsym(handle, "vkGetInstanceProcAddr");
+
+    if (!handle || !symbol) {
+        std::stringstream ss;
+        ss << "failed to load " << dlerror();
+
+        if (handle) dlclose(handle);
+
+        throw std::runtime_error(ss.str());
+    }
+
+    lib_handle_ = handle;
+
+    return reinterpret_cast<PFN_vkGetInstanceProcAddr>(symbol);
+#endif
+}
+
+void ShellHeadless::create_swapchain() {
+    // pick a format that can be rendered to and blended
+    const VkFormat formats[] = {VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_R8G8B8A8_UNORM};
+    const VkFormatFeatureFlags features = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT;
+
+    ctx_.format.format = VK_FORMAT_UNDEFINED;
+    for (auto format : formats) {
+        VkFormatProperties props;
+        vk::GetPhysicalDeviceFormatProperties(ctx_.physical_dev, format, &props);
+        if ((props.optimalTilingFeatures & features) == features) {
+            ctx_.format.format = format;
+            break;
+        }
+    }
+    if (ctx_.format.format == VK_FORMAT_UNDEFINED) throw std::runtime_error("failed to find a renderable image format");
+
+    ctx_.format.colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    // images are copied from rather than presented
+    ctx_.present_layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+    ctx_.surface = VK_NULL_HANDLE;
+    ctx_.swapchain = VK_NULL_HANDLE;
+    ctx_.extent.width = settings_.initial_width;
+    ctx_.extent.height = settings_.initial_height;
+}
+
+void ShellHeadless::destroy_swapchain() {
+    if (images_.empty()) return;
+
+    game_.detach_swapchain();
+    destroy_images();
+}
+
+uint32_t ShellHeadless::find_memory_type(uint32_t type_bits, VkMemoryPropertyFlags flags) const {
+    VkPhysicalDeviceMemoryProperties mem_props;
+    vk::GetPhysicalDeviceMemoryProperties(ctx_.physical_dev, &mem_props);
+
+    for (uint32_t i = 0; i < mem_props.memoryTypeCount; i++) {
+        if ((type_bits & (1 << i)) && (mem_props.memoryTypes[i].propertyFlags & flags) == flags) return i;
+    }
+
+    throw std::runtime_error("failed to find a suitable memory type");
+}
+
+void ShellHeadless::create_images() {
+    VkCommandPoolCreateInfo cmd_pool_info = {};
+    cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    cmd_pool_info.queueFamilyIndex = ctx_.game_queue_family;
+    vk::assert_success(vk::CreateCommandPool(ctx_.dev, &cmd_pool_info, nullptr, &cmd_pool_));
+
+    VkImageCreateInfo image_info = {};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = ctx_.format.format;
+    image_info.extent.width = ctx_.extent.width;
+    image_info.extent.height = ctx_.extent.height;
+    image_info.extent.depth = 1;
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.size = static_cast<VkDeviceSize>(ctx_.extent.width) * ctx_.extent.height * 4;
+    buf_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkFenceCreateInfo fence_info = {};
+    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+    VkMemoryAllocateInfo mem_info = {};
+    mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+
+    // at least double buffered, like a FIFO swapchain
+    images_.resize(std::max(settings_.back_buffer_count, 2));
+    for (auto &img : images_) {
+        img = Image();
+        img.dump_frame = -1;
+
+        vk::assert_success(vk::CreateImage(ctx_.dev, &image_info, nullptr, &img.image));
+
+        VkMemoryRequirements mem_reqs;
+        vk::GetImageMemoryRequirements(ctx_.dev, img.image, &mem_reqs);
+        mem_info.allocationSize = mem_reqs.size;
+        mem_info.memoryTypeIndex = find_memory_type(mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        vk::assert_success(vk::AllocateMemory(ctx_.dev, &mem_info, nullptr, &img.mem));
+        vk::assert_success(vk::BindImageMemory(ctx_.dev, img.image, img.mem, 0));
+
+        vk::assert_success(vk::CreateFence(ctx_.dev, &fence_info, nullptr, &img.fence));
+
+        if (settings_.dump_frames) {
+            vk::assert_success(vk::CreateBuffer(ctx_.dev, &buf_info, nullptr, &img.dump_buf));
+
+            vk::GetBufferMemoryRequirements(ctx_.dev, img.dump_buf, &mem_reqs);
+            mem_info.allocationSize = mem_reqs.size;
+            mem_info.memoryTypeIndex = find_memory_type(
+                mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            vk::assert_success(vk::AllocateMemory(ctx_.dev, &mem_info, nullptr, &img.dump_mem));
+            vk::assert_success(vk::BindBufferMemory(ctx_.dev, img.dump_buf, img.dump_mem, 0));
+
+            void *ptr;
+            vk::assert_success(vk::MapMemory(ctx_.dev, img.dump_mem, 0, VK_WHOLE_SIZE, 0, &ptr));
+            img.dump_data = reinterpret_cast<const uint8_t *>(ptr);
+
+            record_dump_cmd(img);
+        }
+
+        ctx_.images.push_back(img.image);
+    }
+
+    next_image_ = 0;
+}
+
+void ShellHeadless::destroy_images() {
+    for (auto &img : images_) {
+        // write out the last frames
+        vk::assert_success(vk::WaitForFences(ctx_.dev, 1, &img.fence, true, UINT64_MAX));
+        if (img.dump_frame >= 0) write_dump(img);
+
+        if (settings_.dump_frames) {
+            vk::UnmapMemory(ctx_.dev, img.dump_mem);
+            vk::FreeMemory(ctx_.dev, img.dump_mem, nullptr);
+            vk::DestroyBuffer(ctx_.dev, img.dump_buf, nullptr);
+        }
+
+        vk::DestroyFence(ctx_.dev, img.fence, nullptr);
+        vk::DestroyImage(ctx_.dev, img.image, nullptr);
+        vk::FreeMemory(ctx_.dev, img.mem, nullptr);
+    }
+
+    vk::DestroyCommandPool(ctx_.dev, cmd_pool_, nullptr);
+
+    images_.clear();
+    ctx_.images.clear();
+}
+
+void ShellHeadless::record_dump_cmd(Image &img) {
+    VkCommandBufferAllocateInfo cmd_info = {};
+    cmd_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmd_info.commandPool = cmd_pool_;
+    cmd_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmd_info.commandBufferCount = 1;
+    vk::assert_success(vk::AllocateCommandBuffers(ctx_.dev, &cmd_info, &img.dump_cmd));
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vk::assert_success(vk::BeginCommandBuffer(img.dump_cmd, &begin_info));
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent.width = ctx_.extent.width;
+    region.imageExtent.height = ctx_.extent.height;
+    region.imageExtent.depth = 1;
+    vk::CmdCopyImageToBuffer(img.dump_cmd, img.image, ctx_.present_layout, img.dump_buf, 1, &region);
+
+    // make the copy visible to the host
+    VkBufferMemoryBarrier buf_barrier = {};
+    buf_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buf_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buf_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    buf_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buf_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buf_barrier.buffer = img.dump_buf;
+    buf_barrier.offset = 0;
+    buf_barrier.size = VK_WHOLE_SIZE;
+    vk::CmdPipelineBarrier(img.dump_cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &buf_barrier,
+                           0, nullptr);
+
+    vk::assert_success(vk::EndCommandBuffer(img.dump_cmd));
+}
+
+void ShellHeadless::write_dump(Image &img) {
+    const uint32_t width = ctx_.extent.width;
+    const uint32_t height = ctx_.extent.height;
+    const bool bgra = (ctx_.format.format == VK_FORMAT_B8G8R8A8_UNORM);
+
+    std::stringstream ss;
+    ss << settings_.name << "-" << std::setw(5) << std::setfill('0') << img.dump_frame << ".ppm";
+
+    std::ofstream out(ss.str().c_str(), std::ios::binary);
+    out << "P6\n" << width << " " << height << "\n255\n";
+
+    std::vector<char> row(width * 3);
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t *src = img.dump_data + static_cast<size_t>(y) * width * 4;
+        for (uint32_t x = 0; x < width; x++) {
+            row[x * 3 + 0] = src[x * 4 + (bgra ? 2 : 0)];
+            row[x * 3 + 1] = src[x * 4 + 1];
+            row[x * 3 + 2] = src[x * 4 + (bgra ? 0 : 2)];
+        }
+        out.write(row.data(), row.size());
+    }
+
+    if (!out) log(LOG_WARN, ("failed to write " + ss.str()).c_str());
+
+    img.dump_frame = -1;
+}
+
+void ShellHeadless::acquire_image(BackBuffer &buf) {
+    buf.image_index = next_image_;
+    next_image_ = (next_image_ + 1) % images_.size();
+
+    Image &img = images_[buf.image_index];
+
+    // wait for the last present of the image; its dump is ready by now
+    vk::assert_success(vk::WaitForFences(ctx_.dev, 1, &img.fence, true, UINT64_MAX));
+    if (img.dump_frame >= 0) write_dump(img);
+
+    // signal acquire_semaphore as the presentation engine would
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &buf.acquire_semaphore;
+    vk::assert_success(vk::QueueSubmit(ctx_.game_queue, 1, &submit_info, VK_NULL_HANDLE));
+}
+
+void ShellHeadless::present_image(const BackBuffer &buf) {
+    Image &img = images_[buf.image_index];
+    const bool dump = (settings_.dump_frames && !settings_.no_render);
+
+    VkPipelineStageFlags stage = dump ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = (settings_.no_render) ? &buf.acquire_semaphore : &buf.render_semaphore;
+    submit_info.pWaitDstStageMask = &stage;
+    if (dump) {
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &img.dump_cmd;
+    }
+
+    vk::assert_success(vk::ResetFences(ctx_.dev, 1, &img.fence));
+    vk::assert_success(vk::QueueSubmit(ctx_.game_queue, 1, &submit_info, img.fence));
+    vk::assert_success(vk::QueueSubmit(ctx_.game_queue, 0, nullptr, buf.present_fence));
+
+    if (dump) img.dump_frame = frame_count_;
+}
+
+void ShellHeadless::run() {
+    create_context();
+    create_images();
+    game_.attach_swapchain();
+
+    const float game_tick = 1.0f / settings_.ticks_per_second;
+    const int max_frame_count = (settings_.max_frame_count > 0) ? settings_.max_frame_count : default_frame_count;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const std::clock_t start_cpu_time = std::clock();
+
+    quit_ = false;
+    frame_count_ = 0;
+    while (!quit_ && frame_count_ < max_frame_count) {
+        acquire_back_buffer();
+
+        // one tick per frame regardless of how long the frame took
+        add_game_time(game_tick);
+
+        present_back_buffer();
+
+        frame_count_++;
+    }
+
+    vk::DeviceWaitIdle(ctx_.dev);
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    const double cpu_time = static_cast<double>(std::clock() - start_cpu_time) / CLOCKS_PER_SEC;
+
+    std::stringstream ss;
+    ss << frame_count_ << " frames in " << elapsed << " seconds "
+       << "(FPS: " << frame_count_ / elapsed << ", process CPU time: " << cpu_time * 1000.0 / frame_count_ << " ms per frame)";
+    log(LOG_INFO, ss.str().c_str());
+
+    destroy_context();
+}
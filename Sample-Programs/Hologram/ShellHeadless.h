@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHELL_HEADLESS_H
+#define SHELL_HEADLESS_H
+
+#include "Shell.h"
+
+// A Shell without a window.  Games render into a ring of internally
+// allocated images that stands in for the swapchain.  Each image has a fence
+// that is signaled when its "present" completes, and the image is only handed
+// out again after its fence is signaled.  Game time advances by exactly one
+// tick per frame so that runs are reproducible.
+class ShellHeadless : public Shell {
+   public:
+    ShellHeadless(Game &game);
+    ~ShellHeadless();
+
+    void run();
+    void quit() { quit_ = true; }
+
+   private:
+    struct Image {
+        VkImage image;
+        VkDeviceMemory mem;
+
+        // signaled when the image is ready for reuse
+        VkFence fence;
+
+        // frame dumping
+        VkBuffer dump_buf;
+        VkDeviceMemory dump_mem;
+        const uint8_t *dump_data;
+        VkCommandBuffer dump_cmd;
+        int dump_frame;
+    };
+
+    PFN_vkGetInstanceProcAddr load_vk();
+    bool can_present(VkPhysicalDevice phy, uint32_t queue_family) { return true; }
+    VkSurfaceKHR create_surface(VkInstance instance) { return VK_NULL_HANDLE; }
+
+    void create_swapchain();
+    void destroy_swapchain();
+    void acquire_image(BackBuffer &buf);
+    void present_image(const BackBuffer &buf);
+
+    void create_images();
+    void destroy_images();
+    uint32_t find_memory_type(uint32_t type_bits, VkMemoryPropertyFlags flags) const;
+    void record_dump_cmd(Image &img);
+    void write_dump(Image &img);
+
+    void *lib_handle_;
+
+    std::vector<Image> images_;
+    uint32_t next_image_;
+    VkCommandPool cmd_pool_;
+
+    int frame_count_;
+    bool quit_;
+};
+
+#endif  // SHELL_HEADLESS_H
@@ -17,7 +17,6 @@
 #ifndef SIMULATION_H
 #define SIMULATION_H
 
-#include <memory>
 #include <random>
 #include <vector>
 
@@ -45,13 +44,32 @@ class Animation {
     };
 
     std::mt19937 rng_;
-    std::uniform_real_distribution<float> dir_;
-    std::uniform_real_distribution<float> speed_;
 
     Data current_;
 };
 
-class Curve;
+// A subpath of a Path, stored by value.  Both types are evaluated as
+//
+//   position = p0 * A + p1 * B
+//
+// the same way as the curves of Simulation::Batch.  A random curve is made of
+// straight segments and draws them from the rng of its Path.
+struct Curve {
+    enum Type {
+        RANDOM,
+        CIRCLE,
+        TYPE_COUNT,
+    };
+
+    Type type;
+    glm::vec3 p0;
+    glm::vec3 p1;
+
+    // the current segment of a random curve
+    glm::vec3 seg_direction;
+    float seg_start;
+    float seg_end;
+};
 
 class Path {
    public:
@@ -66,46 +84,125 @@ class Path {
         float end;
         float now;
 
-        std::shared_ptr<Curve> curve;
+        bool has_curve;
+        Curve curve;
     };
 
+    glm::vec3 evaluate(float t);
     void generate_subpath();
+    void new_segment(float time_start);
 
     std::mt19937 rng_;
-    std::uniform_int_distribution<> type_;
-    std::uniform_real_distribution<float> duration_;
 
     Subpath current_;
 };
 
 class Simulation {
    public:
-    Simulation(int object_count);
+    // the same seed and ticks produce the same transforms on all platforms,
+    // given IEEE-754 float math without contraction
+    Simulation(int object_count, bool batched, unsigned int seed);
 
     struct Object {
         Meshes::Type mesh;
         glm::vec3 light_pos;
         glm::vec3 light_color;
 
-        Animation animation;
-        Path path;
-
         uint32_t frame_data_offset;
+    };
 
+    // the output of update()
+    struct Transform {
         glm::mat4 model;
         float alpha;
     };
 
     const std::vector<Object> &objects() const { return objects_; }
 
-    unsigned int rng_seed() { return random_dev_(); }
+    // the transforms of the last completed tick
+    const std::vector<Transform> &transforms() const { return snapshots_[front_]; }
+
+    unsigned int rng_seed() { return seed_rng_(); }
+
+    // FNV-1a of transforms(), for comparing runs
+    uint64_t transforms_hash() const;
+
+    // group_by_mesh lays out the frame data of objects of the same mesh
+    // contiguously, in Meshes::Type order
+    void set_frame_data_size(uint32_t size, bool group_by_mesh = false);
+
+    // When double buffered, update() writes a back snapshot so that
+    // transforms() can be read while a tick is in progress.  The back
+    // snapshot becomes visible with swap_snapshots().
+    void set_double_buffered(bool enable);
+    void swap_snapshots();
 
-    void set_frame_data_size(uint32_t size);
     void update(float time, int begin, int end);
 
    private:
-    std::random_device random_dev_;
+    // Structure-of-arrays object state used when batched is set.  Hot
+    // per-tick data lives in contiguous arrays so that update_batched() can
+    // step several objects per SIMD instruction.  Circle and random curves
+    // share p0/p1 and are evaluated as
+    //
+    //   position = origin + p0 * A + p1 * B
+    //
+    // with (A, B) = (cos(u) - 1, sin(u)) for circles, where p0/p1 are the
+    // radius-scaled basis vectors, and (A, B) = (1, u - seg_start) for random
+    // curves, where p0/p1 are the segment start and velocity.
+    struct Batch {
+        // Animation
+        std::vector<float> axis_x, axis_y, axis_z;
+        std::vector<float> speed;
+        std::vector<float> scale;
+        std::vector<float> angle;
+        std::vector<float> alpha;
+        std::vector<float> alpha_inc;
+
+        // Path
+        std::vector<float> now;
+        std::vector<float> start;
+        std::vector<float> end;
+        std::vector<float> origin_x, origin_y, origin_z;
+
+        // Curve
+        std::vector<uint32_t> circle_mask;
+        std::vector<float> p0_x, p0_y, p0_z;
+        std::vector<float> p1_x, p1_y, p1_z;
+        std::vector<float> seg_start;
+        std::vector<float> seg_end;
+
+        // touched only by the scalar event path
+        struct Cold {
+            std::minstd_rand rng;
+            glm::vec3 seg_direction;
+            bool has_curve;
+        };
+        std::vector<Cold> cold;
+
+        void resize(int count);
+    };
+
+    void init_batch(int index, unsigned int rng_seed, float scale);
+    void update_batched(float time, int begin, int end);
+
+    // rare per-object events of the batched path, handled one object at a time
+    void handle_events(int index);
+    void generate_subpath(int index);
+    void generate_segment(int index, float time_start);
+    glm::vec3 curve_position(int index, float t);
+
+    std::mt19937 seed_rng_;
     std::vector<Object> objects_;
+
+    std::vector<Transform> snapshots_[2];
+    int front_;
+    int back_;
+
+    bool batched_;
+    std::vector<Animation> animations_;
+    std::vector<Path> paths_;
+    Batch batch_;
 };
 
 #endif  // SIMULATION_H
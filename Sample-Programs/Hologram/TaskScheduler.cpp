@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include "TaskScheduler.h"
+
+namespace {
+
+// how many times an idle thread polls for a new job before sleeping
+const int spin_count = 4096;
+
+}  // namespace
+
+TaskScheduler::TaskScheduler(int thread_count)
+    : thread_count_(std::max(thread_count, 1)),
+      queues_(new Queue[thread_count_]),
+      count_(0),
+      chunk_size_(1),
+      pending_chunks_(0),
+      epoch_(0),
+      active_(0),
+      sleepers_(0),
+      quit_(false) {
+    for (int i = 0; i < thread_count_; i++) queues_[i].range.store(pack(0, 0), std::memory_order_relaxed);
+
+    threads_.reserve(thread_count_ - 1);
+    for (int i = 1; i < thread_count_; i++) threads_.emplace_back(&TaskScheduler::thread_loop, this, i);
+}
+
+TaskScheduler::~TaskScheduler() {
+    wait();
+
+    quit_.store(true);
+    epoch_.fetch_add(2);
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    sleep_cv_.notify_all();
+
+    for (auto &thread : threads_) thread.join();
+}
+
+void TaskScheduler::dispatch(int count, int chunk_size, const RangeFunc &func) {
+    wait();
+
+    if (count <= 0) return;
+
+    assert(chunk_size > 0);
+    const int chunk_count = (count + chunk_size - 1) / chunk_size;
+
+    // A worker can still be in run_chunks after the last chunk of the
+    // previous job is done.  Make the epoch odd so that workers yet to start
+    // on the previous job back off, and wait for the rest to leave before
+    // touching the job or the queues.
+    epoch_.fetch_add(1);
+    while (active_.load() > 0) std::this_thread::yield();
+
+    func_ = func;
+    count_ = count;
+    chunk_size_ = chunk_size;
+    pending_chunks_.store(chunk_count, std::memory_order_relaxed);
+
+    // deal the chunks out evenly; stealing takes care of the imbalance
+    int chunk_begin = 0;
+    for (int i = 0; i < thread_count_; i++) {
+        const int chunk_end = static_cast<int>(static_cast<int64_t>(chunk_count) * (i + 1) / thread_count_);
+        queues_[i].range.store(pack(chunk_begin, chunk_end), std::memory_order_release);
+        chunk_begin = chunk_end;
+    }
+
+    // publish the job; the lock is only needed when somebody sleeps
+    epoch_.fetch_add(1);
+    if (thread_count_ == 1) return;
+
+    if (sleepers_.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        sleep_cv_.notify_all();
+    }
+}
+
+void TaskScheduler::wait() {
+    if (pending_chunks_.load(std::memory_order_acquire) == 0) return;
+
+    run_chunks(0);
+
+    // the last chunks may still be running on other threads
+    while (pending_chunks_.load(std::memory_order_acquire) > 0) std::this_thread::yield();
+}
+
+bool TaskScheduler::pop(int thread, uint32_t &chunk) {
+    std::atomic<uint64_t> &range = queues_[thread].range;
+
+    uint64_t r = range.load(std::memory_order_acquire);
+    while (front(r) < back(r)) {
+        if (range.compare_exchange_weak(r, pack(front(r) + 1, back(r)), std::memory_order_acq_rel, std::memory_order_acquire)) {
+            chunk = front(r);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TaskScheduler::steal(int thread) {
+    for (int i = 1; i < thread_count_; i++) {
+        std::atomic<uint64_t> &victim = queues_[(thread + i) % thread_count_].range;
+
+        uint64_t r = victim.load(std::memory_order_acquire);
+        while (front(r) < back(r)) {
+            // take the back half, rounded up
+            const uint32_t stolen = (back(r) - front(r) + 1) / 2;
+            const uint32_t new_back = back(r) - stolen;
+            if (victim.compare_exchange_weak(r, pack(front(r), new_back), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                // our queue is empty and no job is dealt while we are in
+                // run_chunks, so nobody else can modify it meanwhile
+                queues_[thread].range.store(pack(new_back, new_back + stolen), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void TaskScheduler::run_chunks(int thread) {
+    while (true) {
+        uint32_t chunk;
+        if (!pop(thread, chunk)) {
+            if (!steal(thread)) break;
+            continue;
+        }
+
+        const int begin = static_cast<int>(chunk) * chunk_size_;
+        const int end = std::min(begin + chunk_size_, count_);
+        func_(begin, end, thread);
+
+        pending_chunks_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+uint32_t TaskScheduler::wait_for_job(uint32_t seen_epoch) {
+    for (int i = 0; i < spin_count; i++) {
+        const uint32_t epoch = epoch_.load(std::memory_order_acquire);
+        if (epoch != seen_epoch && !(epoch & 1)) return epoch;
+
+        std::this_thread::yield();
+    }
+
+    sleepers_.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.wait(lock, [this, seen_epoch] {
+            const uint32_t epoch = epoch_.load();
+            return epoch != seen_epoch && !(epoch & 1);
+        });
+    }
+    sleepers_.fetch_sub(1);
+
+    return wait_for_job(seen_epoch);
+}
+
+void TaskScheduler::thread_loop(int thread) {
+    uint32_t epoch = 0;
+
+    while (true) {
+        epoch = wait_for_job(epoch);
+        if (quit_.load()) break;
+
+        // dispatch either sees us active, or has made the epoch odd
+        // before we check it again and does not expect us
+        active_.fetch_add(1);
+        if (epoch_.load() == epoch) run_chunks(thread);
+        active_.fetch_sub(1);
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A work-stealing range scheduler.  A job splits [0, count) into chunks which
+// are dealt out to per-thread queues.  Each thread drains its own queue from
+// the front and, once empty, steals half of the remaining chunks from the
+// back of another queue.  Queues are single 64-bit atomics and idle threads
+// are woken without taking a lock unless they have gone to sleep.
+class TaskScheduler {
+   public:
+    // func(begin, end, thread_index)
+    typedef std::function<void(int, int, int)> RangeFunc;
+
+    // thread_count includes the calling thread, which always has index 0
+    TaskScheduler(int thread_count);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    int thread_count() const { return thread_count_; }
+
+    // queue a job and return without waiting; a pending job is waited first
+    void dispatch(int count, int chunk_size, const RangeFunc &func);
+    // help with and wait for the pending job
+    void wait();
+
+    void parallel_for(int count, int chunk_size, const RangeFunc &func) {
+        dispatch(count, chunk_size, func);
+        wait();
+    }
+
+   private:
+    struct Queue {
+        // [front, back) chunk indices, front in the low 32 bits
+        std::atomic<uint64_t> range;
+        char padding[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static uint64_t pack(uint32_t front, uint32_t back) { return (static_cast<uint64_t>(back) << 32) | front; }
+    static uint32_t front(uint64_t range) { return static_cast<uint32_t>(range); }
+    static uint32_t back(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+
+    bool pop(int thread, uint32_t &chunk);
+    bool steal(int thread);
+    void run_chunks(int thread);
+
+    void thread_loop(int thread);
+    uint32_t wait_for_job(uint32_t seen_epoch);
+
+    const int thread_count_;
+    std::unique_ptr<Queue[]> queues_;
+    std::vector<std::thread> threads_;
+
+    // the current job; written only while no worker is in run_chunks
+    RangeFunc func_;
+    int count_;
+    int chunk_size_;
+    std::atomic<int> pending_chunks_;
+
+    // odd while a job is being dealt, even once it is published
+    std::atomic<uint32_t> epoch_;
+    // workers inside run_chunks
+    std::atomic<int> active_;
+    std::atomic<int> sleepers_;
+    std::atomic<bool> quit_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+};
+
+#endif  // TASK_SCHEDULER_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cassert>
+#include <stdexcept>
+
+#include "Helpers.h"
+#include "UploadRing.h"
+
+namespace {
+
+VkDeviceSize align(VkDeviceSize size, VkDeviceSize alignment) {
+    return (size % alignment) ? size + alignment - (size % alignment) : size;
+}
+
+}  // namespace
+
+UploadRing::UploadRing(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags, VkBufferUsageFlags usage,
+                       VkDeviceSize frame_size, VkDeviceSize alignment, int frame_count)
+    : dev_(dev),
+      alignment_(alignment ? alignment : 1),
+      frame_size_(align(frame_size, alignment_)),
+      frame_count_(frame_count),
+      buf_(VK_NULL_HANDLE),
+      mem_(VK_NULL_HANDLE),
+      base_(nullptr),
+      device_local_(false),
+      frame_offset_(0),
+      head_(0) {
+    assert(frame_count_ > 0);
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.size = frame_size_ * frame_count_;
+    buf_info.usage = usage;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    vk::assert_success(vk::CreateBuffer(dev_, &buf_info, nullptr, &buf_));
+
+    allocate_memory(mem_flags);
+
+    vk::assert_success(vk::BindBufferMemory(dev_, buf_, mem_, 0));
+    vk::assert_success(vk::MapMemory(dev_, mem_, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&base_)));
+}
+
+UploadRing::~UploadRing() {
+    vk::UnmapMemory(dev_, mem_);
+    vk::FreeMemory(dev_, mem_, nullptr);
+    vk::DestroyBuffer(dev_, buf_, nullptr);
+}
+
+void UploadRing::allocate_memory(const std::vector<VkMemoryPropertyFlags> &mem_flags) {
+    VkMemoryRequirements mem_reqs;
+    vk::GetBufferMemoryRequirements(dev_, buf_, &mem_reqs);
+
+    VkMemoryAllocateInfo mem_info = {};
+    mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mem_info.allocationSize = mem_reqs.size;
+
+    const VkMemoryPropertyFlags mappable = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    const VkMemoryPropertyFlags preferences[] = {mappable | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mappable};
+
+    // device-local mappable heaps can be small, so fall back on failures too
+    for (auto flags : preferences) {
+        for (uint32_t idx = 0; idx < mem_flags.size(); idx++) {
+            if (!(mem_reqs.memoryTypeBits & (1 << idx)) || (mem_flags[idx] & flags) != flags) continue;
+
+            mem_info.memoryTypeIndex = idx;
+            if (vk::AllocateMemory(dev_, &mem_info, nullptr, &mem_) == VK_SUCCESS) {
+                device_local_ = (mem_flags[idx] & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0;
+                return;
+            }
+        }
+    }
+
+    vk::DestroyBuffer(dev_, buf_, nullptr);
+    throw std::runtime_error("failed to allocate mappable memory for the upload ring");
+}
+
+void UploadRing::begin_frame(int frame) {
+    assert(frame >= 0 && frame < frame_count_);
+
+    frame_offset_ = frame_size_ * frame;
+    head_.store(0, std::memory_order_relaxed);
+}
+
+UploadRing::Allocation UploadRing::allocate(VkDeviceSize size) {
+    size = align(size, alignment_);
+
+    const VkDeviceSize offset = head_.fetch_add(size, std::memory_order_relaxed);
+    if (offset + size > frame_size_) {
+        Allocation none = {nullptr, 0};
+        return none;
+    }
+
+    Allocation alloc = {base_ + frame_offset_ + offset, frame_offset_ + offset};
+    return alloc;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UPLOAD_RING_H
+#define UPLOAD_RING_H
+
+#include <atomic>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+// A persistently mapped buffer with one region per frame in flight.  Each
+// frame bump-allocates from its own region, which is reused by begin_frame
+// once the caller has waited for the fence of the frame that last used it.
+// allocate() is lock-free and may be called from several threads at once.
+//
+// DEVICE_LOCAL|HOST_VISIBLE|HOST_COHERENT memory is preferred, falling back
+// to any HOST_VISIBLE|HOST_COHERENT memory.
+class UploadRing {
+   public:
+    UploadRing(VkDevice dev, const std::vector<VkMemoryPropertyFlags> &mem_flags, VkBufferUsageFlags usage,
+               VkDeviceSize frame_size, VkDeviceSize alignment, int frame_count);
+    ~UploadRing();
+
+    UploadRing(const UploadRing &ring) = delete;
+    UploadRing &operator=(const UploadRing &ring) = delete;
+
+    VkBuffer buffer() const { return buf_; }
+    bool device_local() const { return device_local_; }
+    int frame_count() const { return frame_count_; }
+
+    // the region of the current frame
+    VkDeviceSize frame_offset() const { return frame_offset_; }
+    VkDeviceSize frame_size() const { return frame_size_; }
+
+    void begin_frame(int frame);
+
+    struct Allocation {
+        uint8_t *ptr;
+        // from the start of buffer()
+        VkDeviceSize offset;
+    };
+
+    // returns a null ptr when the region of the current frame is full
+    Allocation allocate(VkDeviceSize size);
+
+   private:
+    void allocate_memory(const std::vector<VkMemoryPropertyFlags> &mem_flags);
+
+    VkDevice dev_;
+    const VkDeviceSize alignment_;
+    const VkDeviceSize frame_size_;
+    const int frame_count_;
+
+    VkBuffer buf_;
+    VkDeviceMemory mem_;
+    uint8_t *base_;
+    bool device_local_;
+
+    VkDeviceSize frame_offset_;
+    std::atomic<VkDeviceSize> head_;
+};
+
+#endif  // UPLOAD_RING_H
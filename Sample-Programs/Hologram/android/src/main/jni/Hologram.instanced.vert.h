@@ -0,0 +1,143 @@
+#include <stdint.h>
+
+#if 0
+Hologram.instanced.vert
+Capability Shader
+%1 = ExtInstImport "GLSL.std.450"
+MemoryModel Logical GLSL450
+EntryPoint Vertex %4 "main" %22 %23 %24 %25 %26 %27 %29 %30 %31
+Source ESSL 310
+Name %4 "main"
+Name %15 "param_block"
+MemberName %15 0 "view_projection"
+Name %22 "in_pos"
+Name %23 "in_normal"
+Name %24 "in_model"
+Name %25 "in_light_pos"
+Name %26 "in_light_color"
+Name %27 "in_alpha"
+Name %28 "params"
+Name %30 "color"
+Name %31 "alpha"
+MemberDecorate %15 0 ColMajor
+MemberDecorate %15 0 Offset 0
+MemberDecorate %15 0 MatrixStride 16
+Decorate %15 Block
+Decorate %22 Location 0
+Decorate %23 Location 1
+Decorate %24 Location 2
+Decorate %25 Location 6
+Decorate %26 Location 7
+Decorate %27 Location 8
+Decorate %29 BuiltIn Position
+Decorate %30 Location 0
+Decorate %31 Location 1
+%2 = TypeVoid
+%3 = TypeFunction %2
+%5 = TypeFloat 32
+%6 = TypeVector %5 3
+%7 = TypeVector %5 4
+%8 = TypeMatrix %7 4
+%9 = TypePointer Input %6
+%10 = TypePointer Input %8
+%11 = TypePointer Input %5
+%12 = TypePointer Output %7
+%13 = TypePointer Output %6
+%14 = TypePointer Output %5
+%15 = TypeStruct %8
+%16 = TypePointer PushConstant %15
+%17 = TypePointer PushConstant %8
+%18 = TypeInt 32 1
+%19 = Constant %18 0
+%20 = Constant %5 f:1.0
+%21 = Constant %5 f:0.0
+%22 = Variable %9 Input
+%23 = Variable %9 Input
+%24 = Variable %10 Input
+%25 = Variable %9 Input
+%26 = Variable %9 Input
+%27 = Variable %11 Input
+%28 = Variable %16 PushConstant
+%29 = Variable %12 Output
+%30 = Variable %13 Output
+%31 = Variable %14 Output
+%4 = Function %2 None_ %3
+%32 = Label
+%33 = Load %8 %24
+%34 = Load %6 %25
+%38 = CompositeConstruct %7 %34 %20
+%39 = MatrixTimesVector %7 %33 %38
+%40 = VectorShuffle %6 %39 %39 0 1 2
+%41 = Load %6 %22
+%45 = CompositeConstruct %7 %41 %20
+%46 = MatrixTimesVector %7 %33 %45
+%47 = VectorShuffle %6 %46 %46 0 1 2
+%48 = Load %6 %23
+%52 = CompositeConstruct %7 %48 %21
+%53 = MatrixTimesVector %7 %33 %52
+%54 = VectorShuffle %6 %53 %53 0 1 2
+%55 = FSub %6 %40 %47
+%56 = Dot %5 %55 %54
+%57 = ExtInst %5 %1 Length %55
+%58 = FDiv %5 %56 %57
+%59 = ExtInst %5 %1 Length %54
+%60 = FDiv %5 %58 %59
+%61 = ExtInst %5 %1 FAbs %60
+%62 = AccessChain %17 %28 %19
+%63 = Load %8 %62
+%67 = CompositeConstruct %7 %47 %20
+%68 = MatrixTimesVector %7 %63 %67
+Store %29 %68
+%69 = Load %6 %26
+%70 = VectorTimesScalar %6 %69 %61
+Store %30 %70
+%71 = Load %5 %27
+Store %31 %71
+Return
+FunctionEnd
+#endif
+
+static const uint32_t Hologram_instanced_vert[414] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000048, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
+    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x000e000f, 0x00000000, 0x00000004, 0x6e69616d,
+    0x00000000, 0x00000016, 0x00000017, 0x00000018, 0x00000019, 0x0000001a, 0x0000001b, 0x0000001d, 0x0000001e, 0x0000001f,
+    0x00030003, 0x00000001, 0x00000136, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00050005, 0x0000000f, 0x61726170,
+    0x6c625f6d, 0x006b636f, 0x00070006, 0x0000000f, 0x00000000, 0x77656976, 0x6f72705f, 0x7463656a, 0x006e6f69, 0x00040005,
+    0x00000016, 0x705f6e69, 0x0000736f, 0x00050005, 0x00000017, 0x6e5f6e69, 0x616d726f, 0x0000006c, 0x00050005, 0x00000018,
+    0x6d5f6e69, 0x6c65646f, 0x00000000, 0x00060005, 0x00000019, 0x6c5f6e69, 0x74686769, 0x736f705f, 0x00000000, 0x00060005,
+    0x0000001a, 0x6c5f6e69, 0x74686769, 0x6c6f635f, 0x0000726f, 0x00050005, 0x0000001b, 0x615f6e69, 0x6168706c, 0x00000000,
+    0x00040005, 0x0000001c, 0x61726170, 0x0000736d, 0x00040005, 0x0000001e, 0x6f6c6f63, 0x00000072, 0x00040005, 0x0000001f,
+    0x68706c61, 0x00000061, 0x00040048, 0x0000000f, 0x00000000, 0x00000005, 0x00050048, 0x0000000f, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x0000000f, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x0000000f, 0x00000002, 0x00040047,
+    0x00000016, 0x0000001e, 0x00000000, 0x00040047, 0x00000017, 0x0000001e, 0x00000001, 0x00040047, 0x00000018, 0x0000001e,
+    0x00000002, 0x00040047, 0x00000019, 0x0000001e, 0x00000006, 0x00040047, 0x0000001a, 0x0000001e, 0x00000007, 0x00040047,
+    0x0000001b, 0x0000001e, 0x00000008, 0x00040047, 0x0000001d, 0x0000000b, 0x00000000, 0x00040047, 0x0000001e, 0x0000001e,
+    0x00000000, 0x00040047, 0x0000001f, 0x0000001e, 0x00000001, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
+    0x00030016, 0x00000005, 0x00000020, 0x00040017, 0x00000006, 0x00000005, 0x00000003, 0x00040017, 0x00000007, 0x00000005,
+    0x00000004, 0x00040018, 0x00000008, 0x00000007, 0x00000004, 0x00040020, 0x00000009, 0x00000001, 0x00000006, 0x00040020,
+    0x0000000a, 0x00000001, 0x00000008, 0x00040020, 0x0000000b, 0x00000001, 0x00000005, 0x00040020, 0x0000000c, 0x00000003,
+    0x00000007, 0x00040020, 0x0000000d, 0x00000003, 0x00000006, 0x00040020, 0x0000000e, 0x00000003, 0x00000005, 0x0003001e,
+    0x0000000f, 0x00000008, 0x00040020, 0x00000010, 0x00000009, 0x0000000f, 0x00040020, 0x00000011, 0x00000009, 0x00000008,
+    0x00040015, 0x00000012, 0x00000020, 0x00000001, 0x0004002b, 0x00000012, 0x00000013, 0x00000000, 0x0004002b, 0x00000005,
+    0x00000014, 0x3f800000, 0x0004002b, 0x00000005, 0x00000015, 0x00000000, 0x0004003b, 0x00000009, 0x00000016, 0x00000001,
+    0x0004003b, 0x00000009, 0x00000017, 0x00000001, 0x0004003b, 0x0000000a, 0x00000018, 0x00000001, 0x0004003b, 0x00000009,
+    0x00000019, 0x00000001, 0x0004003b, 0x00000009, 0x0000001a, 0x00000001, 0x0004003b, 0x0000000b, 0x0000001b, 0x00000001,
+    0x0004003b, 0x00000010, 0x0000001c, 0x00000009, 0x0004003b, 0x0000000c, 0x0000001d, 0x00000003, 0x0004003b, 0x0000000d,
+    0x0000001e, 0x00000003, 0x0004003b, 0x0000000e, 0x0000001f, 0x00000003, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
+    0x00000003, 0x000200f8, 0x00000020, 0x0004003d, 0x00000008, 0x00000021, 0x00000018, 0x0004003d, 0x00000006, 0x00000022,
+    0x00000019, 0x00050050, 0x00000007, 0x00000026, 0x00000022, 0x00000014, 0x00050091, 0x00000007, 0x00000027, 0x00000021,
+    0x00000026, 0x0008004f, 0x00000006, 0x00000028, 0x00000027, 0x00000027, 0x00000000, 0x00000001, 0x00000002, 0x0004003d,
+    0x00000006, 0x00000029, 0x00000016, 0x00050050, 0x00000007, 0x0000002d, 0x00000029, 0x00000014, 0x00050091, 0x00000007,
+    0x0000002e, 0x00000021, 0x0000002d, 0x0008004f, 0x00000006, 0x0000002f, 0x0000002e, 0x0000002e, 0x00000000, 0x00000001,
+    0x00000002, 0x0004003d, 0x00000006, 0x00000030, 0x00000017, 0x00050050, 0x00000007, 0x00000034, 0x00000030, 0x00000015,
+    0x00050091, 0x00000007, 0x00000035, 0x00000021, 0x00000034, 0x0008004f, 0x00000006, 0x00000036, 0x00000035, 0x00000035,
+    0x00000000, 0x00000001, 0x00000002, 0x00050083, 0x00000006, 0x00000037, 0x00000028, 0x0000002f, 0x00050094, 0x00000005,
+    0x00000038, 0x00000037, 0x00000036, 0x0006000c, 0x00000005, 0x00000039, 0x00000001, 0x00000042, 0x00000037, 0x00050088,
+    0x00000005, 0x0000003a, 0x00000038, 0x00000039, 0x0006000c, 0x00000005, 0x0000003b, 0x00000001, 0x00000042, 0x00000036,
+    0x00050088, 0x00000005, 0x0000003c, 0x0000003a, 0x0000003b, 0x0006000c, 0x00000005, 0x0000003d, 0x00000001, 0x00000004,
+    0x0000003c, 0x00050041, 0x00000011, 0x0000003e, 0x0000001c, 0x00000013, 0x0004003d, 0x00000008, 0x0000003f, 0x0000003e,
+    0x00050050, 0x00000007, 0x00000043, 0x0000002f, 0x00000014, 0x00050091, 0x00000007, 0x00000044, 0x0000003f, 0x00000043,
+    0x0003003e, 0x0000001d, 0x00000044, 0x0004003d, 0x00000006, 0x00000045, 0x0000001a, 0x0005008e, 0x00000006, 0x00000046,
+    0x00000045, 0x0000003d, 0x0003003e, 0x0000001e, 0x00000046, 0x0004003d, 0x00000005, 0x00000047, 0x0000001b, 0x0003003e,
+    0x0000001f, 0x00000047, 0x000100fd, 0x00010038,
+};
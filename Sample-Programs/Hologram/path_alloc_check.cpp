@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2016 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that Path does not allocate once constructed: operator new is
+// counted while paths are advanced across many subpaths, each of which goes
+// through Path::generate_subpath.  Exits with 1 when anything was allocated.
+//
+// Usage: hologram_path_alloc_check [paths] [ticks]
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "Simulation.h"
+
+namespace {
+
+std::atomic<long> new_count(0);
+
+// the tick of Hologram::on_tick
+const float tick_interval = 1.0f / 30.0f;
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+    new_count.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+
+int main(int argc, char **argv) {
+    const int path_count = (argc > 1) ? std::atoi(argv[1]) : 64;
+    const int tick_count = (argc > 2) ? std::atoi(argv[2]) : 30 * 60 * 10;
+
+    std::vector<Path> paths;
+    paths.reserve(path_count);
+    for (int i = 0; i < path_count; i++) paths.emplace_back(static_cast<unsigned>(i + 1));
+
+    // subpaths last 5 to 20 seconds, so every path starts many of them
+    const long before = new_count.load();
+    float sum = 0.0f;
+    for (int tick = 0; tick < tick_count; tick++) {
+        for (auto &path : paths) sum += path.position(tick_interval).x;
+    }
+    const long allocations = new_count.load() - before;
+
+    std::printf("%d paths, %d ticks (%.0f s): %ld allocations (checksum %g)\n", path_count, tick_count,
+                tick_count * tick_interval, allocations, sum);
+
+    return allocations ? 1 : 0;
+}